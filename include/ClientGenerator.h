@@ -9,6 +9,8 @@
 #include "RequestLoader.h"
 #include "SchemaLoader.h"
 
+#include <map>
+
 namespace graphql::generator::client {
 
 struct [[nodiscard]] GeneratorPaths
@@ -57,9 +59,18 @@ private:
 		std::ostream& sourceFile, const Operation& operation) const noexcept;
 	bool outputModifiedResponseImplementation(std::ostream& sourceFile,
 		const std::string& outerScope, const ResponseField& responseField) const noexcept;
+	void outputResponseFieldDispatch(std::ostream& sourceFile, const std::string& cppType,
+		const ResponseFieldList& fields) const noexcept;
+	void outputResponseSinkImplementation(std::ostream& sourceFile, const std::string& cppType,
+		const ResponseFieldList& fields) const noexcept;
 	[[nodiscard]] static std::string getTypeModifierList(
 		const TypeModifierStack& modifiers) noexcept;
 
+	// Group the unique field names by length, so the generated code can switch on the length of
+	// each key and only compare it with the names which have the same length.
+	[[nodiscard]] static std::map<size_t, std::vector<const ResponseField*>> getFieldsByLength(
+		const ResponseFieldList& fields) noexcept;
+
 	const SchemaLoader _schemaLoader;
 	const RequestLoader _requestLoader;
 	const GeneratorOptions _options;
@@ -66,6 +66,8 @@ private:
 	[[nodiscard]] std::string getArgumentDeclaration(const InputField& argument,
 		const char* prefixToken, const char* argumentsToken,
 		const char* defaultToken) const noexcept;
+	[[nodiscard]] std::string getInputFieldDeclaration(
+		const InputField& inputField, const char* defaultToken) const noexcept;
 	[[nodiscard]] std::string getArgumentAccessType(const InputField& argument) const noexcept;
 	[[nodiscard]] std::string getResultAccessType(const OutputField& result) const noexcept;
 	[[nodiscard]] std::string getTypeModifiers(const TypeModifierStack& modifiers) const noexcept;
@@ -139,6 +139,7 @@ struct [[nodiscard]] ValidateField
 };
 
 using ValidateTypes = internal::string_view_map<ValidateType>;
+using ValidateHashedTypes = internal::string_view_hash_map<ValidateType>;
 
 // ValidateVariableTypeVisitor visits the AST and builds a ValidateType structure representing
 // a variable type in an operation definition as if it came from an Introspection query.
@@ -146,7 +147,7 @@ class [[nodiscard]] ValidateVariableTypeVisitor
 {
 public:
 	ValidateVariableTypeVisitor(
-		const std::shared_ptr<schema::Schema>& schema, const ValidateTypes& types);
+		const std::shared_ptr<schema::Schema>& schema, const ValidateHashedTypes& types);
 
 	void visit(const peg::ast_node& typeName);
 
@@ -159,12 +160,82 @@ private:
 	void visitNonNullType(const peg::ast_node& nonNullType);
 
 	const std::shared_ptr<schema::Schema>& _schema;
-	const ValidateTypes& _types;
+	const ValidateHashedTypes& _types;
 
 	bool _isInputType = false;
 	ValidateType _variableType;
 };
 
+// ValidateSchema holds the information from the service schema which the validator needs. The
+// schema does not change after it has been constructed, so these tables are shared by every
+// ValidateExecutableVisitor for the same schema, including the copies which validate definitions
+// in parallel. They are still built from the schema at runtime, on first use. The tables which
+// are searched by name for every field, argument, and variable in a query have a hashed index,
+// since large schemas can have thousands of types or hundreds of fields on a single type.
+class [[nodiscard]] ValidateSchema
+{
+public:
+	using FieldTypes = internal::string_view_hash_map<ValidateTypeField>;
+	using TypeFields = internal::string_view_hash_map<FieldTypes>;
+	using InputFieldTypes = ValidateTypeFieldArguments;
+	using InputTypeFields = internal::string_view_hash_map<InputFieldTypes>;
+	using EnumValues = internal::string_view_hash_map<internal::string_view_hash_set>;
+	using MatchingTypes = internal::string_view_hash_map<internal::string_view_hash_set>;
+	using ScalarTypes = internal::string_view_hash_set;
+	using Directives = internal::string_view_hash_map<ValidateDirective>;
+
+	explicit ValidateSchema(schema::Schema& schema);
+
+	[[nodiscard]] static constexpr bool isScalarType(introspection::TypeKind kind) noexcept;
+
+	ValidateTypes operationTypes;
+	ValidateHashedTypes types;
+	MatchingTypes matchingTypes;
+	Directives directives;
+	EnumValues enumValues;
+	ScalarTypes scalarTypes;
+	TypeFields typeFields;
+	InputTypeFields inputTypeFields;
+
+private:
+	[[nodiscard]] static ValidateTypeFieldArguments getArguments(
+		const std::vector<std::shared_ptr<const schema::InputValue>>& args);
+	[[nodiscard]] static FieldTypes getTypeFields(
+		schema::Schema& schema, const schema::BaseType& type, bool isQueryType);
+};
+
+// Persistent worker threads for ValidateExecutableVisitor, so validating each document in
+// parallel does not need to start new threads every time.
+class [[nodiscard]] ValidateThreadPool
+{
+public:
+	explicit ValidateThreadPool(size_t threadCount);
+	~ValidateThreadPool();
+
+	[[nodiscard]] size_t size() const noexcept;
+
+	// Call task(0) through task(taskCount - 1) on the worker threads, up to one task per thread.
+	// The task must remain valid until the call to wait returns.
+	void start(size_t taskCount, const std::function<void(size_t)>& task);
+
+	// Wait for all of the tasks from the last call to start, and rethrow the first exception.
+	void wait();
+
+private:
+	void runTasks();
+
+	std::mutex _mutex {};
+	std::condition_variable _startCv {};
+	std::condition_variable _doneCv {};
+	const std::function<void(size_t)>* _task = nullptr;
+	size_t _taskCount = 0;
+	size_t _nextTask = 0;
+	size_t _runningTasks = 0;
+	std::exception_ptr _exception {};
+	bool _shutdown = false;
+	std::vector<std::thread> _workers;
+};
+
 // ValidateExecutableVisitor visits the AST and validates that it is executable against the service
 // schema.
 class [[nodiscard]] ValidateExecutableVisitor
@@ -176,26 +247,25 @@ public:
 
 	GRAPHQLSERVICE_EXPORT [[nodiscard]] std::list<schema_error> getStructuredErrors();
 
-private:
-	[[nodiscard]] static ValidateTypeFieldArguments getArguments(
-		const std::vector<std::shared_ptr<const schema::InputValue>>& args);
+	GRAPHQLSERVICE_EXPORT void setCostOptions(RequestCostOptions options);
+	GRAPHQLSERVICE_EXPORT void setConcurrency(size_t concurrency);
+	GRAPHQLSERVICE_EXPORT [[nodiscard]] std::map<std::string_view, size_t, std::less<>>
+	getOperationCosts();
 
-	using FieldTypes = internal::string_view_map<ValidateTypeField>;
-	using TypeFields = internal::string_view_map<FieldTypes>;
-	using InputFieldTypes = ValidateTypeFieldArguments;
-	using InputTypeFields = internal::string_view_map<InputFieldTypes>;
-	using EnumValues = internal::string_view_map<internal::string_view_set>;
-
-	[[nodiscard]] constexpr bool isScalarType(introspection::TypeKind kind);
+private:
+	using FieldTypes = ValidateSchema::FieldTypes;
+	using TypeFields = ValidateSchema::TypeFields;
+	using InputFieldTypes = ValidateSchema::InputFieldTypes;
+	using InputTypeFields = ValidateSchema::InputTypeFields;
+	using EnumValues = ValidateSchema::EnumValues;
 
 	[[nodiscard]] bool matchesScopedType(std::string_view name) const;
 
-	[[nodiscard]] TypeFields::const_iterator getScopedTypeFields();
-	[[nodiscard]] InputTypeFields::const_iterator getInputTypeFields(std::string_view name);
-	[[nodiscard]] static const ValidateType& getValidateFieldType(
-		const FieldTypes::mapped_type& value);
-	[[nodiscard]] static const ValidateType& getValidateFieldType(
-		const InputFieldTypes::mapped_type& value);
+	[[nodiscard]] TypeFields::const_iterator getScopedTypeFields() const;
+	[[nodiscard]] InputTypeFields::const_iterator getInputTypeFields(
+		std::string_view name) const;
+	[[nodiscard]] static const ValidateType& getValidateFieldType(const ValidateTypeField& value);
+	[[nodiscard]] static const ValidateType& getValidateFieldType(const ValidateArgument& value);
 	template <class _FieldTypes>
 	[[nodiscard]] static ValidateType getFieldType(
 		const _FieldTypes& fields, std::string_view name);
@@ -203,6 +273,8 @@ private:
 	[[nodiscard]] static ValidateType getWrappedFieldType(
 		const _FieldTypes& fields, std::string_view name);
 
+	void visitDefinition(const peg::ast_node& definition);
+	void visitDefinitionsInParallel(const peg::ast_node& root);
 	void visitFragmentDefinition(const peg::ast_node& fragmentDefinition);
 	void visitOperationDefinition(const peg::ast_node& operationDefinition);
 
@@ -215,6 +287,10 @@ private:
 	void visitDirectives(
 		introspection::DirectiveLocation location, const peg::ast_node& directives);
 
+	[[nodiscard]] size_t getFieldWeight(std::string_view name) const;
+	[[nodiscard]] size_t getFieldMultiplier(
+		const ValidateType& wrappedType, const ValidateFieldArguments& arguments) const;
+
 	[[nodiscard]] bool validateInputValue(bool hasNonNullDefaultValue,
 		const ValidateArgumentValuePtr& argument, const ValidateType& type);
 	[[nodiscard]] bool validateVariableType(bool isNonNull, const ValidateType& variableType,
@@ -223,31 +299,44 @@ private:
 	const std::shared_ptr<schema::Schema> _schema;
 	std::list<schema_error> _errors;
 
-	using Directives = internal::string_view_map<ValidateDirective>;
+	using Directives = ValidateSchema::Directives;
 	using AstNodeRef = std::reference_wrapper<const peg::ast_node>;
 	using ExecutableNodes = internal::string_view_map<AstNodeRef>;
 	using FragmentSet = internal::string_view_set;
-	using MatchingTypes = internal::string_view_map<internal::string_view_set>;
-	using ScalarTypes = internal::string_view_set;
+	// Map each cyclic fragment name to the index of the error reported for it in _errors.
+	using FragmentCycles = internal::string_view_map<size_t>;
+	using MatchingTypes = ValidateSchema::MatchingTypes;
+	using ScalarTypes = ValidateSchema::ScalarTypes;
 	using VariableDefinitions = internal::string_view_map<AstNodeRef>;
 	using VariableTypes = internal::string_view_map<ValidateArgument>;
 	using OperationVariables = std::optional<VariableTypes>;
 	using VariableSet = internal::string_view_set;
 
 	// These members store Introspection schema information which does not change between queries.
-	ValidateTypes _operationTypes;
-	ValidateTypes _types;
-	MatchingTypes _matchingTypes;
-	Directives _directives;
-	EnumValues _enumValues;
-	ScalarTypes _scalarTypes;
+	// The references all point into the ValidateSchema shared with the schema.
+	const std::shared_ptr<const ValidateSchema> _validateSchema;
+	const ValidateTypes& _operationTypes;
+	const ValidateHashedTypes& _types;
+	const MatchingTypes& _matchingTypes;
+	const Directives& _directives;
+	const EnumValues& _enumValues;
+	const ScalarTypes& _scalarTypes;
+	const TypeFields& _typeFields;
+	const InputTypeFields& _inputTypeFields;
+	RequestCostOptions _costOptions;
+	size_t _concurrency = 1;
+
+	// The copies of the visitor for each worker share the thread pool, but only the visitor which
+	// owns the document uses it.
+	std::shared_ptr<ValidateThreadPool> _threadPool;
 
 	// These members store information that's specific to a single query and changes every time we
 	// visit a new one. They must be reset in between queries.
 	ExecutableNodes _fragmentDefinitions;
 	ExecutableNodes _operationDefinitions;
 	FragmentSet _referencedFragments;
-	FragmentSet _fragmentCycles;
+	FragmentCycles _fragmentCycles;
+	std::map<std::string_view, size_t, std::less<>> _operationCosts;
 
 	// These members store state for the visitor. They implicitly reset each time we call visit.
 	OperationVariables _operationVariables;
@@ -256,8 +345,7 @@ private:
 	FragmentSet _fragmentStack;
 	size_t _fieldCount = 0;
 	size_t _introspectionFieldCount = 0;
-	TypeFields _typeFields;
-	InputTypeFields _inputTypeFields;
+	size_t _selectionCost = 0;
 	ValidateType _scopedType;
 	internal::string_view_map<ValidateField> _selectionFields;
 };
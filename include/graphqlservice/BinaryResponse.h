@@ -0,0 +1,32 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#ifndef BINARYRESPONSE_H
+#define BINARYRESPONSE_H
+
+#include "graphqlservice/GraphQLResponse.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace graphql::response {
+
+using BinaryData = std::vector<std::uint8_t>;
+
+// CBOR (RFC 8949) encoding. ID values holding ByteData are written as byte strings, opaque ID
+// values and EnumValue values are written as tagged text strings so they round trip.
+GRAPHQLRESPONSE_EXPORT [[nodiscard]] BinaryData toCBOR(Value&& response);
+
+GRAPHQLRESPONSE_EXPORT [[nodiscard]] Value parseCBOR(const BinaryData& cbor);
+
+// MessagePack encoding. ID values holding ByteData are written with the bin format family, opaque
+// ID values and EnumValue values are written as ext values so they round trip.
+GRAPHQLRESPONSE_EXPORT [[nodiscard]] BinaryData toMessagePack(Value&& response);
+
+GRAPHQLRESPONSE_EXPORT [[nodiscard]] Value parseMessagePack(const BinaryData& msgpack);
+
+} // namespace graphql::response
+
+#endif // BINARYRESPONSE_H
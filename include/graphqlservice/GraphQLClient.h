@@ -24,8 +24,11 @@
 
 #include <algorithm>
 #include <iterator>
+#include <memory>
 #include <optional>
 #include <stdexcept>
+#include <string>
+#include <string_view>
 #include <type_traits>
 #include <vector>
 
@@ -351,6 +354,376 @@ using IdResponse = ModifiedResponse<response::IdType>;
 using ScalarResponse = ModifiedResponse<response::Value>;
 
 } // namespace
+
+// Receive the SAX-style events for a single value in the response, and store it directly in the
+// target of a generated Response type. The default implementations throw std::logic_error.
+class [[nodiscard]] ValueSink
+{
+public:
+	GRAPHQLCLIENT_EXPORT virtual ~ValueSink();
+
+	GRAPHQLCLIENT_EXPORT virtual void add_null();
+	GRAPHQLCLIENT_EXPORT virtual void add_bool(bool value);
+	GRAPHQLCLIENT_EXPORT virtual void add_int(int value);
+	GRAPHQLCLIENT_EXPORT virtual void add_float(double value);
+	GRAPHQLCLIENT_EXPORT virtual void add_string(std::string&& value);
+
+	// Objects and lists return the sink for their members or elements, which must remain valid
+	// until the matching end_object or end_array.
+	GRAPHQLCLIENT_EXPORT virtual ValueSink& start_object();
+	GRAPHQLCLIENT_EXPORT virtual ValueSink& add_member(std::string_view key);
+	GRAPHQLCLIENT_EXPORT virtual void end_object();
+
+	GRAPHQLCLIENT_EXPORT virtual ValueSink& start_array();
+	GRAPHQLCLIENT_EXPORT virtual ValueSink& add_element();
+	GRAPHQLCLIENT_EXPORT virtual void end_array();
+
+	// Shared sink which ignores everything, e.g. the value of an unexpected member.
+	GRAPHQLCLIENT_EXPORT [[nodiscard]] static ValueSink& skip() noexcept;
+};
+
+// Parse a single response output value straight from the SAX-style events. This is the
+// counterpart of Response<Type>::parse, and by default it just collects the value and passes it
+// to that. The generated code specializes this for each of the Response types.
+template <typename Type>
+class [[nodiscard]] ResponseSink : public ValueSink
+{
+public:
+	using target_type = Type;
+
+	void bind(target_type& target) noexcept
+	{
+		_target = &target;
+	}
+
+	void add_null() final
+	{
+		setValue(response::Value {});
+	}
+
+	void add_bool(bool value) final
+	{
+		setValue(response::Value { value });
+	}
+
+	void add_int(int value) final
+	{
+		setValue(response::Value { value });
+	}
+
+	void add_float(double value) final
+	{
+		setValue(response::Value { value });
+	}
+
+	void add_string(std::string&& value) final
+	{
+		setValue(response::Value { std::move(value) }.from_json());
+	}
+
+	ValueSink& start_object() final
+	{
+		_valueStack.emplace_back(response::Type::Map);
+		return *this;
+	}
+
+	ValueSink& add_member(std::string_view key) final
+	{
+		_keyStack.emplace_back(key);
+		return *this;
+	}
+
+	void end_object() final
+	{
+		popValue();
+	}
+
+	ValueSink& start_array() final
+	{
+		_valueStack.emplace_back(response::Type::List);
+		return *this;
+	}
+
+	ValueSink& add_element() final
+	{
+		return *this;
+	}
+
+	void end_array() final
+	{
+		popValue();
+	}
+
+private:
+	void popValue()
+	{
+		auto value = std::move(_valueStack.back());
+
+		_valueStack.pop_back();
+		setValue(std::move(value));
+	}
+
+	void setValue(response::Value&& value)
+	{
+		if (_valueStack.empty())
+		{
+			*_target = Response<Type>::parse(std::move(value));
+			return;
+		}
+
+		auto& parent = _valueStack.back();
+
+		if (parent.type() == response::Type::Map)
+		{
+			parent.emplace_back(std::move(_keyStack.back()), std::move(value));
+			_keyStack.pop_back();
+		}
+		else
+		{
+			parent.emplace_back(std::move(value));
+		}
+	}
+
+	target_type* _target = nullptr;
+	std::vector<std::string> _keyStack;
+	std::vector<response::Value> _valueStack;
+};
+
+// Base class for the generated ResponseSink specializations of each Response type. Anything
+// besides an object leaves a default constructed result, the same as Response<Type>::parse.
+template <typename Type>
+class [[nodiscard]] ObjectSink : public ValueSink
+{
+public:
+	using target_type = Type;
+
+	void bind(target_type& target) noexcept
+	{
+		_target = &target;
+	}
+
+	void add_null() final
+	{
+		*_target = {};
+	}
+
+	void add_bool(bool /* value */) final
+	{
+		*_target = {};
+	}
+
+	void add_int(int /* value */) final
+	{
+		*_target = {};
+	}
+
+	void add_float(double /* value */) final
+	{
+		*_target = {};
+	}
+
+	void add_string(std::string&& /* value */) final
+	{
+		*_target = {};
+	}
+
+	ValueSink& start_object() final
+	{
+		*_target = {};
+		bindMembers(*_target);
+		return *this;
+	}
+
+	void end_object() final
+	{
+	}
+
+	ValueSink& start_array() final
+	{
+		*_target = {};
+		return skip();
+	}
+
+protected:
+	// Point each of the member sinks at the matching member of the result.
+	virtual void bindMembers(target_type& result) noexcept = 0;
+
+private:
+	target_type* _target = nullptr;
+};
+
+// Wrap a ResponseSink with chained type modifiers that add nullable or list wrappers. This is the
+// counterpart of ModifiedResponse for the SAX-style events.
+template <typename Type, TypeModifier... Modifiers>
+class [[nodiscard]] ModifiedSink : public ResponseSink<Type>
+{
+	static_assert(OnlyNoneModifiers<Modifiers...>, "unexpected TypeModifier");
+};
+
+// Peel off nullable modifiers.
+template <typename Type, TypeModifier... Other>
+class [[nodiscard]] ModifiedSink<Type, TypeModifier::Nullable, Other...> : public ValueSink
+{
+public:
+	using target_type = std::optional<typename ModifiedSink<Type, Other...>::target_type>;
+
+	void bind(target_type& target) noexcept
+	{
+		_target = &target;
+	}
+
+	void add_null() final
+	{
+		_target->reset();
+	}
+
+	void add_bool(bool value) final
+	{
+		emplace().add_bool(value);
+	}
+
+	void add_int(int value) final
+	{
+		emplace().add_int(value);
+	}
+
+	void add_float(double value) final
+	{
+		emplace().add_float(value);
+	}
+
+	void add_string(std::string&& value) final
+	{
+		emplace().add_string(std::move(value));
+	}
+
+	ValueSink& start_object() final
+	{
+		return emplace().start_object();
+	}
+
+	ValueSink& start_array() final
+	{
+		return emplace().start_array();
+	}
+
+private:
+	ValueSink& emplace()
+	{
+		_inner.bind(_target->emplace());
+		return _inner;
+	}
+
+	target_type* _target = nullptr;
+	ModifiedSink<Type, Other...> _inner;
+};
+
+// Peel off list modifiers. Anything besides a list leaves it empty, like ModifiedResponse.
+template <typename Type, TypeModifier... Other>
+class [[nodiscard]] ModifiedSink<Type, TypeModifier::List, Other...> : public ValueSink
+{
+public:
+	using target_type = std::vector<typename ModifiedSink<Type, Other...>::target_type>;
+
+	void bind(target_type& target) noexcept
+	{
+		_target = &target;
+	}
+
+	void add_null() final
+	{
+		_target->clear();
+	}
+
+	void add_bool(bool /* value */) final
+	{
+		_target->clear();
+	}
+
+	void add_int(int /* value */) final
+	{
+		_target->clear();
+	}
+
+	void add_float(double /* value */) final
+	{
+		_target->clear();
+	}
+
+	void add_string(std::string&& /* value */) final
+	{
+		_target->clear();
+	}
+
+	ValueSink& start_object() final
+	{
+		_target->clear();
+		return skip();
+	}
+
+	ValueSink& start_array() final
+	{
+		_target->clear();
+		return *this;
+	}
+
+	ValueSink& add_element() final
+	{
+		_inner.bind(_target->emplace_back());
+		return _inner;
+	}
+
+	void end_array() final
+	{
+	}
+
+private:
+	target_type* _target = nullptr;
+	ModifiedSink<Type, Other...> _inner;
+};
+
+// Drive the ValueSink for the data in a complete service response with the SAX-style events from
+// a parser like response::parseJSON. The errors are collected the same way as
+// parseServiceResponse, and anything else in the response is ignored.
+class [[nodiscard]] ResponseVisitor final : public response::ValueVisitor
+{
+public:
+	GRAPHQLCLIENT_EXPORT explicit ResponseVisitor(std::unique_ptr<ValueSink> data);
+	GRAPHQLCLIENT_EXPORT ~ResponseVisitor() final;
+
+	GRAPHQLCLIENT_EXPORT void add_null() final;
+	GRAPHQLCLIENT_EXPORT void add_bool(bool value) final;
+	GRAPHQLCLIENT_EXPORT void add_int(int value) final;
+	GRAPHQLCLIENT_EXPORT void add_float(double value) final;
+	GRAPHQLCLIENT_EXPORT void add_string(std::string&& value) final;
+
+	GRAPHQLCLIENT_EXPORT void start_object() final;
+	GRAPHQLCLIENT_EXPORT void add_member(std::string_view key) final;
+	GRAPHQLCLIENT_EXPORT void end_object() final;
+
+	GRAPHQLCLIENT_EXPORT void start_array() final;
+	GRAPHQLCLIENT_EXPORT void end_array() final;
+
+	// Parse the errors which were returned alongside the data.
+	GRAPHQLCLIENT_EXPORT [[nodiscard]] std::vector<Error> errors();
+
+private:
+	struct Container
+	{
+		ValueSink* sink;
+		bool list;
+	};
+
+	ValueSink& next();
+
+	const std::unique_ptr<ValueSink> _data;
+	response::Value _errors;
+	ResponseSink<response::Value> _errorsSink;
+	const std::unique_ptr<ValueSink> _document;
+	std::vector<Container> _containers;
+	ValueSink* _member = nullptr;
+};
+
 } // namespace graphql::client
 
 #endif // GRAPHQLCLIENT_H
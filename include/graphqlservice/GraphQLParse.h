@@ -18,7 +18,10 @@
 #endif // !GRAPHQL_DLLEXPORTS
 // clang-format on
 
+#include <functional>
+#include <map>
 #include <memory>
+#include <string>
 #include <string_view>
 
 namespace graphql {
@@ -32,6 +35,16 @@ struct [[nodiscard]] ast
 	std::shared_ptr<ast_input> input;
 	std::shared_ptr<ast_node> root;
 	bool validated = false;
+
+	// Serialized tokens of the parsed document, which ignore whitespace, commas, and comments, and
+	// a hash of them. They're only filled in by normalizeDocument, e.g. when Request looks up a
+	// cached validation result. The hash narrows the lookup and the tokens are compared on a hit.
+	std::string normalized;
+	size_t hash = 0;
+
+	// Estimated cost of each operation in the document, keyed by the operation name (which is
+	// empty for an anonymous operation). This is computed during validation.
+	std::map<std::string_view, size_t, std::less<>> operationCosts;
 };
 
 // By default, we want to limit the depth of nested nodes. You can override this with
@@ -48,6 +61,25 @@ GRAPHQLPEG_EXPORT [[nodiscard]] ast parseString(
 GRAPHQLPEG_EXPORT [[nodiscard]] ast parseFile(
 	std::string_view filename, size_t depthLimit = c_defaultDepthLimit);
 
+// Fill in ast::normalized and ast::hash, unless they have already been computed.
+GRAPHQLPEG_EXPORT void normalizeDocument(ast& query);
+
+// Serialize the tokens the same way as ast::normalized without modifying the ast, e.g. when it
+// might be shared between threads.
+GRAPHQLPEG_EXPORT [[nodiscard]] std::string normalizeDocument(const ast_node& root);
+
+// Parse an executable document one top-level definition (operation or fragment) at a time. The
+// callback receives each definition in its own ast as soon as it has been parsed, so a large
+// batch of operations can be validated or registered in a pipeline without first building a
+// single tree for the whole document. The definitions share the input buffer, and unlike
+// parseString and parseFile, there is no fallback to the mixed document grammar.
+using ast_definition_callback = std::function<void(ast&&)>;
+
+GRAPHQLPEG_EXPORT void parseStringDefinitions(std::string_view input,
+	const ast_definition_callback& callback, size_t depthLimit = c_defaultDepthLimit);
+GRAPHQLPEG_EXPORT void parseFileDefinitions(std::string_view filename,
+	const ast_definition_callback& callback, size_t depthLimit = c_defaultDepthLimit);
+
 } // namespace peg
 
 GRAPHQLPEG_EXPORT [[nodiscard]] peg::ast operator"" _graphql(const char* text, size_t size);
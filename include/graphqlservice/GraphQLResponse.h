@@ -48,6 +48,7 @@ enum class [[nodiscard]] Type : std::uint8_t {
 };
 
 struct Value;
+class Writer;
 
 using MapType = std::vector<std::pair<std::string, Value>>;
 using ListType = std::vector<Value>;
@@ -57,11 +58,22 @@ using IntType = int;
 using FloatType = double;
 using ScalarType = Value;
 
+// Base class for Type::Custom values, which lets large custom scalars skip building a Value tree.
 struct CustomTypeBase
 {
-	//virtual bool operator==(const CustomTypeBase& rhs) const=0;
-	//virtual CustomTypeBase&& clone()const=0;
-	virtual ~CustomTypeBase(){}
+	virtual ~CustomTypeBase() = default;
+
+	// Stream the value directly to the Writer.
+	virtual void write(const Writer& writer) const = 0;
+
+	// Make a deep copy, which is how Value copies Type::Custom values.
+	[[nodiscard]] virtual std::unique_ptr<CustomTypeBase> clone() const = 0;
+
+	// Compare with another custom value, which might be a different derived type.
+	[[nodiscard]] virtual bool equals(const CustomTypeBase& rhs) const noexcept = 0;
+
+	// Hash consistently with equals, e.g. for caching results by their custom scalar arguments.
+	[[nodiscard]] virtual size_t hash() const noexcept = 0;
 };
 
 using CustomType = std::unique_ptr<CustomTypeBase>;
@@ -105,6 +117,7 @@ struct [[nodiscard]] IdType
 
 	// Check the type
 	GRAPHQLRESPONSE_EXPORT [[nodiscard]] bool isBase64() const noexcept;
+	GRAPHQLRESPONSE_EXPORT [[nodiscard]] bool isByteData() const noexcept;
 
 	// Shared accessors
 	GRAPHQLRESPONSE_EXPORT [[nodiscard]] bool empty() const noexcept;
@@ -220,7 +233,12 @@ struct ValueTypeTraits<FloatType>
 	using get_type = FloatType;
 };
 
-
+// Type::EnumValue can borrow its name from a string with static storage duration, e.g. the table of
+// names for each generated enum type, instead of allocating a copy of the name in every Value.
+struct [[nodiscard]] EnumName
+{
+	const StringType& name;
+};
 
 // Represent a discriminated union of GraphQL response value types.
 struct [[nodiscard]] Value
@@ -235,6 +253,7 @@ struct [[nodiscard]] Value
 	GRAPHQLRESPONSE_EXPORT explicit Value(FloatType value);
 	GRAPHQLRESPONSE_EXPORT explicit Value(IdType&& value);
 	GRAPHQLRESPONSE_EXPORT explicit Value(CustomType&& value);
+	GRAPHQLRESPONSE_EXPORT explicit Value(EnumName value) noexcept;
 
 	GRAPHQLRESPONSE_EXPORT Value(Value&& other) noexcept;
 	GRAPHQLRESPONSE_EXPORT explicit Value(const Value& other);
@@ -262,6 +281,10 @@ struct [[nodiscard]] Value
 	GRAPHQLRESPONSE_EXPORT [[nodiscard]] Value&& from_input() noexcept;
 	GRAPHQLRESPONSE_EXPORT [[nodiscard]] bool maybe_id() const noexcept;
 
+	// Valid for Type::EnumValue, returns the name it borrowed from an EnumName or nullptr if it
+	// owns a copy of the name instead.
+	GRAPHQLRESPONSE_EXPORT [[nodiscard]] const StringType* borrowed_enum() const noexcept;
+
 	// Valid for Type::Map or Type::List
 	GRAPHQLRESPONSE_EXPORT void reserve(size_t count);
 	GRAPHQLRESPONSE_EXPORT [[nodiscard]] size_t size() const;
@@ -290,6 +313,8 @@ struct [[nodiscard]] Value
 	[[nodiscard]] typename ValueTypeTraits<ValueType>::release_type release();
 
 private:
+	friend class Writer;
+
 	// Type::Map
 	struct [[nodiscard]] MapData
 	{
@@ -316,7 +341,14 @@ private:
 	};
 
 	// Type::EnumValue
-	using EnumData = StringType;
+	struct [[nodiscard]] EnumData
+	{
+		[[nodiscard]] bool operator==(const EnumData& rhs) const;
+		[[nodiscard]] const StringType& name() const noexcept;
+
+		StringType value;
+		const StringType* borrowed = nullptr;
+	};
 
 	// Type::Scalar
 	struct [[nodiscard]] ScalarData
@@ -395,15 +427,17 @@ private:
 	{
 		virtual ~Concept() = default;
 
-		virtual void start_object() const = 0;
+		virtual void start_object(size_t count) const = 0;
 		virtual void add_member(const std::string& key) const = 0;
 		virtual void end_object() const = 0;
 
-		virtual void start_array() const = 0;
+		virtual void start_array(size_t count) const = 0;
 		virtual void end_arrary() const = 0;
 
 		virtual void write_null() const = 0;
 		virtual void write_string(const std::string& value) const = 0;
+		virtual void write_enum(const std::string& value) const = 0;
+		[[nodiscard]] virtual bool write_id(const IdType& value) const = 0;
 		virtual void write_bool(bool value) const = 0;
 		virtual void write_int(int value) const = 0;
 		virtual void write_float(double value) const = 0;
@@ -417,9 +451,18 @@ private:
 		{
 		}
 
-		void start_object() const final
+		// Writers for formats which encode the length up front can take the count, everyone else
+		// can ignore it.
+		void start_object(size_t count) const final
 		{
-			_pimpl->start_object();
+			if constexpr (requires { _pimpl->start_object(count); })
+			{
+				_pimpl->start_object(count);
+			}
+			else
+			{
+				_pimpl->start_object();
+			}
 		}
 
 		void add_member(const std::string& key) const final
@@ -432,9 +475,16 @@ private:
 			_pimpl->end_object();
 		}
 
-		void start_array() const final
+		void start_array(size_t count) const final
 		{
-			_pimpl->start_array();
+			if constexpr (requires { _pimpl->start_array(count); })
+			{
+				_pimpl->start_array(count);
+			}
+			else
+			{
+				_pimpl->start_array();
+			}
 		}
 
 		void end_arrary() const final
@@ -452,6 +502,32 @@ private:
 			_pimpl->write_string(value);
 		}
 
+		// Enum values and IDs are written as strings unless the writer can tell them apart.
+		void write_enum(const std::string& value) const final
+		{
+			if constexpr (requires { _pimpl->write_enum(value); })
+			{
+				_pimpl->write_enum(value);
+			}
+			else
+			{
+				_pimpl->write_string(value);
+			}
+		}
+
+		bool write_id(const IdType& value) const final
+		{
+			if constexpr (requires { _pimpl->write_id(value); })
+			{
+				_pimpl->write_id(value);
+				return true;
+			}
+			else
+			{
+				return false;
+			}
+		}
+
 		void write_bool(bool value) const final
 		{
 			_pimpl->write_bool(value);
@@ -482,6 +558,91 @@ public:
 	}
 
 	GRAPHQLRESPONSE_EXPORT void write(Value value) const;
+
+	// Write individual tokens, e.g. from CustomTypeBase::write.
+	void start_object(size_t count) const
+	{
+		_concept->start_object(count);
+	}
+
+	void add_member(const std::string& key) const
+	{
+		_concept->add_member(key);
+	}
+
+	void end_object() const
+	{
+		_concept->end_object();
+	}
+
+	void start_array(size_t count) const
+	{
+		_concept->start_array(count);
+	}
+
+	void end_array() const
+	{
+		_concept->end_arrary();
+	}
+
+	void write_null() const
+	{
+		_concept->write_null();
+	}
+
+	void write_string(const std::string& value) const
+	{
+		_concept->write_string(value);
+	}
+
+	void write_enum(const std::string& value) const
+	{
+		_concept->write_enum(value);
+	}
+
+	GRAPHQLRESPONSE_EXPORT void write_id(const IdType& value) const;
+
+	void write_bool(bool value) const
+	{
+		_concept->write_bool(value);
+	}
+
+	void write_int(int value) const
+	{
+		_concept->write_int(value);
+	}
+
+	void write_float(double value) const
+	{
+		_concept->write_float(value);
+	}
+
+private:
+	// Walk a shared subtree by const reference, so serializing it never copies the shared Value.
+	void writeShared(const Value& value) const;
+
+	void writeCustom(const CustomType& custom) const;
+};
+
+// SAX-style events from a parser like parseJSON. Implementing this lets a consumer fill in its own
+// data structures in a single pass, instead of building a Value tree and walking that afterwards.
+class [[nodiscard]] ValueVisitor
+{
+public:
+	virtual ~ValueVisitor() = default;
+
+	virtual void add_null() = 0;
+	virtual void add_bool(bool value) = 0;
+	virtual void add_int(int value) = 0;
+	virtual void add_float(double value) = 0;
+	virtual void add_string(std::string&& value) = 0;
+
+	virtual void start_object() = 0;
+	virtual void add_member(std::string_view key) = 0;
+	virtual void end_object() = 0;
+
+	virtual void start_array() = 0;
+	virtual void end_array() = 0;
 };
 
 } // namespace graphql::response
@@ -25,10 +25,15 @@
 #include "graphqlservice/internal/SortedMap.h"
 #include "graphqlservice/internal/Version.h"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <cstddef>
 #include <functional>
 #include <future>
+#include <iterator>
 #include <list>
 #include <map>
 #include <memory>
@@ -40,6 +45,7 @@
 #include <string_view>
 #include <thread>
 #include <type_traits>
+#include <typeindex>
 #include <utility>
 #include <variant>
 #include <vector>
@@ -60,22 +66,12 @@ struct [[nodiscard]] schema_location
 	size_t column = 1;
 };
 
-// The implementation details of the error path should be opaque to client code. It is carried along
-// with the SelectionSetParams and automatically added to any schema errors or exceptions thrown
-// from an accessor as part of error reporting.
+// The error path is not tracked while the fields are resolved. Each error starts with a path
+// relative to the field which reported it, and every field or list entry prepends its own segment
+// (the response name or list index) as the errors propagate up to the operation.
 using path_segment = std::variant<std::string_view, size_t>;
-
-struct [[nodiscard]] field_path
-{
-	std::optional<std::reference_wrapper<const field_path>> parent;
-	std::variant<std::string_view, size_t> segment;
-};
-
 using error_path = std::vector<path_segment>;
 
-GRAPHQLSERVICE_EXPORT [[nodiscard]] error_path buildErrorPath(
-	const std::optional<field_path>& path);
-
 struct [[nodiscard]] schema_error
 {
 	std::string message;
@@ -83,6 +79,8 @@ struct [[nodiscard]] schema_error
 	error_path path {};
 };
 
+GRAPHQLSERVICE_EXPORT void prependErrorPath(std::list<schema_error>& errors, path_segment segment);
+
 GRAPHQLSERVICE_EXPORT [[nodiscard]] response::Value buildErrorValues(
 	std::list<schema_error>&& structuredErrors);
 
@@ -247,9 +245,199 @@ public:
 // preserves the order of the elements without complete uniqueness.
 using Directives = std::vector<std::pair<std::string_view, response::Value>>;
 
-// Traversing a fragment spread adds a new set of directives.
-using FragmentDefinitionDirectiveStack = std::list<std::reference_wrapper<const Directives>>;
-using FragmentSpreadDirectiveStack = std::list<Directives>;
+// Traversing a fragment spread adds a new set of directives. The stack is persistent, pushing or
+// popping a frame returns a new stack which shares the frames below it with the original, so it
+// can be passed by value to nested and asynchronous resolvers. Most fragments do not have any
+// directives, and pushing an empty frame does not allocate anything.
+template <typename T>
+class [[nodiscard]] DirectiveStack
+{
+private:
+	struct Frame
+	{
+		T directives;
+		size_t emptyBelow;
+		std::shared_ptr<const Frame> next;
+	};
+
+public:
+	using value_type = T;
+	using const_reference = const T&;
+
+	class [[nodiscard]] const_iterator
+	{
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using difference_type = std::ptrdiff_t;
+		using value_type = T;
+		using pointer = const T*;
+		using reference = const T&;
+
+		const_iterator() noexcept = default;
+
+		[[nodiscard]] reference operator*() const noexcept
+		{
+			return (_empty > 0 || !_frame) ? emptyFrame() : _frame->directives;
+		}
+
+		[[nodiscard]] pointer operator->() const noexcept
+		{
+			return &**this;
+		}
+
+		const_iterator& operator++() noexcept
+		{
+			if (_empty > 0)
+			{
+				--_empty;
+			}
+			else
+			{
+				_empty = _frame->emptyBelow;
+				_frame = _frame->next.get();
+			}
+
+			return *this;
+		}
+
+		const_iterator operator++(int) noexcept
+		{
+			auto result = *this;
+
+			++*this;
+
+			return result;
+		}
+
+		[[nodiscard]] bool operator==(const const_iterator& rhs) const noexcept = default;
+
+	private:
+		friend class DirectiveStack;
+
+		const_iterator(const Frame* frame, size_t empty) noexcept
+			: _frame { frame }
+			, _empty { empty }
+		{
+		}
+
+		const Frame* _frame = nullptr;
+		size_t _empty = 0;
+	};
+
+	[[nodiscard]] bool empty() const noexcept
+	{
+		return _size == 0;
+	}
+
+	[[nodiscard]] size_t size() const noexcept
+	{
+		return _size;
+	}
+
+	[[nodiscard]] const_iterator begin() const noexcept
+	{
+		return { _top.get(), _emptyTop };
+	}
+
+	[[nodiscard]] const_iterator end() const noexcept
+	{
+		return {};
+	}
+
+	[[nodiscard]] const_reference front() const noexcept
+	{
+		return *begin();
+	}
+
+	[[nodiscard]] DirectiveStack push_front(T directives) const
+	{
+		DirectiveStack result { *this };
+
+		++result._size;
+
+		if (getDirectives(directives).empty())
+		{
+			++result._emptyTop;
+		}
+		else
+		{
+			result._top =
+				std::make_shared<const Frame>(Frame { std::move(directives), _emptyTop, _top });
+			result._emptyTop = 0;
+		}
+
+		return result;
+	}
+
+	[[nodiscard]] DirectiveStack pop_front() const noexcept
+	{
+		DirectiveStack result { *this };
+
+		if (result._size > 0)
+		{
+			--result._size;
+
+			if (result._emptyTop > 0)
+			{
+				--result._emptyTop;
+			}
+			else
+			{
+				result._emptyTop = _top->emptyBelow;
+				result._top = _top->next;
+			}
+		}
+
+		return result;
+	}
+
+	// These used to be held in a std::shared_ptr, so keep accessing the members through
+	// operator->() working.
+	[[nodiscard]] const DirectiveStack* operator->() const noexcept
+	{
+		return this;
+	}
+
+private:
+	[[nodiscard]] static const Directives& getDirectives(const T& directives) noexcept
+	{
+		if constexpr (std::is_same_v<T, Directives>)
+		{
+			return directives;
+		}
+		else
+		{
+			return directives.get();
+		}
+	}
+
+	[[nodiscard]] static const T& emptyFrame() noexcept
+	{
+		if constexpr (std::is_same_v<T, Directives>)
+		{
+			static const T s_empty {};
+
+			return s_empty;
+		}
+		else
+		{
+			static const Directives s_emptyDirectives {};
+			static const T s_empty { std::cref(s_emptyDirectives) };
+
+			return s_empty;
+		}
+	}
+
+	std::shared_ptr<const Frame> _top {};
+	size_t _emptyTop = 0;
+	size_t _size = 0;
+};
+
+using FragmentDefinitionDirectiveStack = DirectiveStack<std::reference_wrapper<const Directives>>;
+using FragmentSpreadDirectiveStack = DirectiveStack<Directives>;
+
+// Forward declare just the class type so we can share it in the SelectionSetParams.
+class FieldArgumentCache;
 
 // Pass a common bundle of parameters to all of the generated Object::getField accessors in a
 // SelectionSet
@@ -262,19 +450,20 @@ struct [[nodiscard]] SelectionSetParams
 	// by the accessor is resolved or destroyed. They are owned by the OperationData shared pointer.
 	const std::shared_ptr<RequestState>& state;
 	const Directives& operationDirectives;
-	const std::shared_ptr<FragmentDefinitionDirectiveStack> fragmentDefinitionDirectives;
+	const FragmentDefinitionDirectiveStack fragmentDefinitionDirectives;
 
-	// Fragment directives are shared for all fields in that fragment, but they aren't kept alive
-	// after the call to the last accessor in the fragment. If you need to keep them alive longer,
-	// you'll need to explicitly copy them into other instances of Directives.
-	const std::shared_ptr<FragmentSpreadDirectiveStack> fragmentSpreadDirectives;
-	const std::shared_ptr<FragmentSpreadDirectiveStack> inlineFragmentDirectives;
-
-	// Field error path to this selection set.
-	std::optional<field_path> errorPath;
+	// Fragment directives are shared for all fields in that fragment. Each frame is kept alive as
+	// long as some copy of the stack refers to it, so if you need them after the accessor returns,
+	// copy the stack or the Directives rather than holding a reference to the front.
+	const FragmentSpreadDirectiveStack fragmentSpreadDirectives;
+	const FragmentSpreadDirectiveStack inlineFragmentDirectives;
 
 	// Async launch policy for sub-field resolvers.
 	const await_async launch {};
+
+	// The field arguments are coerced once for each field in the operation and shared with every
+	// resolver for that field, e.g. for each object in a list.
+	const std::shared_ptr<FieldArgumentCache> fieldArguments {};
 };
 
 // Pass a common bundle of parameters to all of the generated Object::getField accessors.
@@ -295,6 +484,10 @@ struct [[nodiscard]] FieldParams : SelectionSetParams
 //
 // If the overhead of conversion to response::Value is too expensive, scalar type field accessors
 // can store and return a std::shared_ptr<const response::Value> directly.
+//
+// Field accessors may also return a schema_error by value instead of throwing an exception. The
+// field resolves to null and the error is reported with the field location and path, without
+// unwinding the stack.
 template <typename T>
 class [[nodiscard]] AwaitableScalar
 {
@@ -305,7 +498,7 @@ public:
 	{
 	}
 
-	struct promise_type
+	struct promise_type : internal::PooledCoroutineFrame
 	{
 		[[nodiscard]] AwaitableScalar<T> get_return_object() noexcept
 		{
@@ -362,6 +555,10 @@ public:
 				{
 					return true;
 				}
+				else if constexpr (std::is_same_v<value_type, schema_error>)
+				{
+					return true;
+				}
 			},
 			_value);
 	}
@@ -396,6 +593,10 @@ public:
 				{
 					throw std::logic_error("Cannot await std::shared_ptr<const response::Value>");
 				}
+				else if constexpr (std::is_same_v<value_type, schema_error>)
+				{
+					throw schema_exception { { std::move(value) } };
+				}
 			},
 			std::move(_value));
 	}
@@ -417,13 +618,26 @@ public:
 			std::move(_value));
 	}
 
+	[[nodiscard]] std::optional<schema_error> get_error() noexcept
+	{
+		std::optional<schema_error> result;
+
+		if (auto error = std::get_if<schema_error>(&_value))
+		{
+			result = std::move(*error);
+		}
+
+		return result;
+	}
+
 private:
-	std::variant<T, std::future<T>, std::shared_ptr<const response::Value>> _value;
+	std::variant<T, std::future<T>, std::shared_ptr<const response::Value>, schema_error> _value;
 };
 
 // Field accessors may return either a result of T, an awaitable of T, or a std::future<T>, so at
 // runtime the implementer may choose to return by value or defer/parallelize expensive operations
-// by returning an async future or an awaitable coroutine.
+// by returning an async future or an awaitable coroutine. Like AwaitableScalar, they may also
+// return a schema_error by value.
 template <typename T>
 class [[nodiscard]] AwaitableObject
 {
@@ -434,7 +648,7 @@ public:
 	{
 	}
 
-	struct promise_type
+	struct promise_type : internal::PooledCoroutineFrame
 	{
 		[[nodiscard]] AwaitableObject<T> get_return_object() noexcept
 		{
@@ -486,6 +700,10 @@ public:
 
 					return value.wait_for(0s) != std::future_status::timeout;
 				}
+				else if constexpr (std::is_same_v<value_type, schema_error>)
+				{
+					return true;
+				}
 			},
 			_value);
 	}
@@ -515,12 +733,28 @@ public:
 				{
 					return value.get();
 				}
+				else if constexpr (std::is_same_v<value_type, schema_error>)
+				{
+					throw schema_exception { { std::move(value) } };
+				}
 			},
 			std::move(_value));
 	}
 
+	[[nodiscard]] std::optional<schema_error> get_error() noexcept
+	{
+		std::optional<schema_error> result;
+
+		if (auto error = std::get_if<schema_error>(&_value))
+		{
+			result = std::move(*error);
+		}
+
+		return result;
+	}
+
 private:
-	std::variant<T, std::future<T>> _value;
+	std::variant<T, std::future<T>, schema_error> _value;
 };
 
 // Fragments are referenced by name and have a single type condition (except for inline
@@ -558,6 +792,14 @@ struct [[nodiscard]] ResolverParams : SelectionSetParams
 
 	GRAPHQLSERVICE_EXPORT [[nodiscard]] schema_location getLocation() const;
 
+	// ModifiedArgument converts each argument once for every resolver which shares the same
+	// arguments from the FieldArgumentCache, keyed on the argument name and the converted type.
+	// These return nullptr if the arguments did not come from the cache.
+	GRAPHQLSERVICE_EXPORT [[nodiscard]] std::shared_ptr<const void> findConvertedArgument(
+		std::string_view name, std::type_index type) const;
+	GRAPHQLSERVICE_EXPORT [[nodiscard]] std::shared_ptr<const void> cacheConvertedArgument(
+		std::string_view name, std::type_index type, std::shared_ptr<const void> value) const;
+
 	// These values are different for each resolver.
 	const peg::ast_node& field;
 	std::string fieldName;
@@ -579,6 +821,11 @@ struct [[nodiscard]] ResolverResult
 	std::list<schema_error> errors {};
 };
 
+// Convert a schema_error returned by value from a field accessor into a null ResolverResult,
+// filling in the field location if the accessor did not set it. The path is relative to the field.
+GRAPHQLSERVICE_EXPORT [[nodiscard]] ResolverResult buildFieldError(
+	schema_error&& error, const ResolverParams& params);
+
 using AwaitableResolver = internal::Awaitable<ResolverResult>;
 using Resolver = std::function<AwaitableResolver(ResolverParams&&)>;
 using ResolverMap = internal::string_view_map<Resolver>;
@@ -604,6 +851,38 @@ concept NullableModifier = Modifier == TypeModifier::Nullable;
 template <TypeModifier Modifier>
 concept ListModifier = Modifier == TypeModifier::List;
 
+// Copy the names of a generated enum type into strings which a response::EnumName can borrow, so
+// converting each result does not allocate another copy of the name.
+template <size_t N>
+[[nodiscard]] std::array<std::string, N> makeEnumNames(
+	const std::array<std::string_view, N>& names)
+{
+	std::array<std::string, N> result;
+
+	std::transform(names.begin(), names.end(), result.begin(), [](std::string_view name) {
+		return std::string { name };
+	});
+
+	return result;
+}
+
+// Get the index of an EnumValue which borrowed its name from this table, without comparing the
+// name to any strings. Returns std::nullopt if the value did not borrow its name from the table.
+template <size_t N>
+[[nodiscard]] std::optional<size_t> findEnumName(
+	const std::array<std::string, N>& names, const response::Value& value) noexcept
+{
+	constexpr std::less<const std::string*> less {};
+	const auto name = value.borrowed_enum();
+
+	if (!name || less(name, names.data()) || !less(name, names.data() + N))
+	{
+		return std::nullopt;
+	}
+
+	return static_cast<size_t>(name - names.data());
+}
+
 // Convert arguments and input types with a non-templated static method.
 template <typename Type>
 struct Argument
@@ -673,25 +952,7 @@ struct ModifiedArgument
 	// Call convert on this type without any modifiers.
 	[[nodiscard]] static Type require(std::string_view name, const response::Value& arguments)
 	{
-		try
-		{
-			return Argument<Type>::convert(arguments[name]);
-		}
-		catch (schema_exception& ex)
-		{
-			auto errors = ex.getStructuredErrors();
-
-			for (auto& error : errors)
-			{
-				std::ostringstream message;
-
-				message << "Invalid argument: " << name << " error: " << error.message;
-
-				error.message = message.str();
-			}
-
-			throw schema_exception(std::move(errors));
-		}
+		return requireMember(name, &arguments[name]);
 	}
 
 	// Wrap require in a try/catch block.
@@ -726,13 +987,136 @@ struct ModifiedArgument
 	{
 		const auto& valueItr = arguments.find(name);
 
-		if (valueItr == arguments.get<response::MapType>().cend()
-			|| valueItr->second.type() == response::Type::Null)
+		return requireMember<Modifier, Other...>(name,
+			(valueItr == arguments.get<response::MapType>().cend() ? nullptr : &valueItr->second));
+	}
+
+	// Peel off list modifiers.
+	template <TypeModifier Modifier, TypeModifier... Other>
+	[[nodiscard]] static typename ArgumentTraits<Type, Modifier, Other...>::type require(
+		std::string_view name, const response::Value& arguments) requires ListModifier<Modifier>
+	{
+		return requireMember<Modifier, Other...>(name, &arguments[name]);
+	}
+
+	// Wrap require with modifiers in a try/catch block.
+	template <TypeModifier Modifier = TypeModifier::None, TypeModifier... Other>
+	[[nodiscard]] static std::pair<typename ArgumentTraits<Type, Modifier, Other...>::type, bool>
+	find(std::string_view name, const response::Value& arguments) noexcept
+	{
+		try
+		{
+			return { require<Modifier, Other...>(name, arguments), true };
+		}
+		catch (const std::exception&)
+		{
+			return { typename ArgumentTraits<Type, Modifier, Other...>::type {}, false };
+		}
+	}
+
+	// The ResolverParams variants share the converted argument with every resolver for the same
+	// field, e.g. for each object in a list, and return a copy. Scalar arguments without a list
+	// modifier are cheaper to convert again than to look up in the cache.
+	template <TypeModifier... Modifier>
+	[[nodiscard]] static typename ArgumentTraits<Type, Modifier...>::type require(
+		std::string_view name, const ResolverParams& params)
+	{
+		if constexpr (!InputArgumentClass<Type> && !((TypeModifier::List == Modifier) || ...))
+		{
+			return require<Modifier...>(name, params.arguments);
+		}
+		else
+		{
+			using result_type = typename ArgumentTraits<Type, Modifier...>::type;
+
+			const std::type_index type { typeid(result_type) };
+			auto cached = params.findConvertedArgument(name, type);
+
+			if (!cached)
+			{
+				auto converted = std::make_shared<result_type>(
+					require<Modifier...>(name, params.arguments));
+
+				cached = params.cacheConvertedArgument(name, type, converted);
+
+				if (!cached)
+				{
+					return std::move(*converted);
+				}
+			}
+
+			return duplicate<Modifier...>(*std::static_pointer_cast<const result_type>(cached));
+		}
+	}
+
+	// Wrap require with the ResolverParams in a try/catch block.
+	template <TypeModifier... Modifier>
+	[[nodiscard]] static std::pair<typename ArgumentTraits<Type, Modifier...>::type, bool> find(
+		std::string_view name, const ResolverParams& params) noexcept
+	{
+		try
+		{
+			return { require<Modifier...>(name, params), true };
+		}
+		catch (const std::exception&)
+		{
+			return { typename ArgumentTraits<Type, Modifier...>::type {}, false };
+		}
+	}
+
+	// The member variants convert a value which the caller has already found, e.g. in a single pass
+	// over the members of an INPUT_OBJECT. A missing member is nullptr, and the name is only used
+	// in error messages.
+	[[nodiscard]] static Type requireMember(std::string_view name, const response::Value* member)
+	{
+		if (!member)
+		{
+			throw std::runtime_error("Missing Map member");
+		}
+
+		try
+		{
+			return Argument<Type>::convert(*member);
+		}
+		catch (schema_exception& ex)
+		{
+			auto errors = ex.getStructuredErrors();
+
+			for (auto& error : errors)
+			{
+				std::ostringstream message;
+
+				message << "Invalid argument: " << name << " error: " << error.message;
+
+				error.message = message.str();
+			}
+
+			throw schema_exception(std::move(errors));
+		}
+	}
+
+	// Peel off the none modifier. If it's included, it should always be last in the list.
+	template <TypeModifier Modifier = TypeModifier::None, TypeModifier... Other>
+	[[nodiscard]] static Type requireMember(std::string_view name,
+		const response::Value* member) requires OnlyNoneModifiers<Modifier, Other...>
+	{
+		static_assert(sizeof...(Other) == 0, "None modifier should always be last");
+
+		// Just call through to the non-template method without the modifiers.
+		return requireMember(name, member);
+	}
+
+	// Peel off nullable modifiers.
+	template <TypeModifier Modifier, TypeModifier... Other>
+	[[nodiscard]] static typename ArgumentTraits<Type, Modifier, Other...>::type requireMember(
+		std::string_view name, const response::Value* member) requires NullableModifier<Modifier>
+	{
+		if (!member || member->type() == response::Type::Null)
 		{
 			return {};
 		}
 
-		auto result = require<Other...>(name, arguments);
+		auto result = requireMember<Other...>(name, member);
 
 		if constexpr (InputArgumentUniquePtr<Type, Other...>)
 		{
@@ -744,37 +1128,37 @@ struct ModifiedArgument
 		}
 	}
 
-	// Peel off list modifiers.
+	// Peel off list modifiers. Each element is converted in place, without copying it.
 	template <TypeModifier Modifier, TypeModifier... Other>
-	[[nodiscard]] static typename ArgumentTraits<Type, Modifier, Other...>::type require(
-		std::string_view name, const response::Value& arguments) requires ListModifier<Modifier>
+	[[nodiscard]] static typename ArgumentTraits<Type, Modifier, Other...>::type requireMember(
+		std::string_view name, const response::Value* member) requires ListModifier<Modifier>
 	{
-		const auto& values = arguments[name];
-		typename ArgumentTraits<Type, Modifier, Other...>::type result(values.size());
-		const auto& elements = values.get<response::ListType>();
+		if (!member)
+		{
+			throw std::runtime_error("Missing Map member");
+		}
+
+		const auto& elements = member->get<response::ListType>();
+		typename ArgumentTraits<Type, Modifier, Other...>::type result(elements.size());
 
 		std::transform(elements.cbegin(),
 			elements.cend(),
 			result.begin(),
 			[name](const response::Value& element) {
-				response::Value single(response::Type::Map);
-
-				single.emplace_back(std::string { name }, response::Value(element));
-
-				return require<Other...>(name, single);
+				return requireMember<Other...>(name, &element);
 			});
 
 		return result;
 	}
 
-	// Wrap require with modifiers in a try/catch block.
+	// Wrap requireMember with modifiers in a try/catch block.
 	template <TypeModifier Modifier = TypeModifier::None, TypeModifier... Other>
 	[[nodiscard]] static std::pair<typename ArgumentTraits<Type, Modifier, Other...>::type, bool>
-	find(std::string_view name, const response::Value& arguments) noexcept
+	findMember(std::string_view name, const response::Value* member) noexcept
 	{
 		try
 		{
-			return { require<Modifier, Other...>(name, arguments), true };
+			return { requireMember<Modifier, Other...>(name, member), true };
 		}
 		catch (const std::exception&)
 		{
@@ -1010,6 +1394,11 @@ struct ModifiedResult
 		static_assert(std::is_same_v<std::shared_ptr<Type>, typename ResultTraits<Type>::type>,
 			"this is the derived object type");
 
+		if (auto error = result.get_error())
+		{
+			co_return buildFieldError(std::move(*error), params);
+		}
+
 		co_await params.launch;
 
 		auto awaitedResult = co_await Result<Object>::convert(
@@ -1036,6 +1425,11 @@ struct ModifiedResult
 		typename ResultTraits<Type, Modifier, Other...>::future_type result,
 		ResolverParams params) requires NullableResultSharedPtr<Type, Modifier, Other...>
 	{
+		if (auto error = result.get_error())
+		{
+			co_return buildFieldError(std::move(*error), params);
+		}
+
 		co_await params.launch;
 
 		auto awaitedResult = co_await std::move(result);
@@ -1061,31 +1455,66 @@ struct ModifiedResult
 						  typename ResultTraits<Type, Modifier, Other...>::type>,
 			"this is the optional version");
 
+		if (auto error = result.get_error())
+		{
+			return AwaitableResolver { buildFieldError(std::move(*error), params) };
+		}
+
 		if constexpr (!ObjectBaseType<Type>)
 		{
 			auto value = result.get_value();
 
-			if (value)
+			// Skip the coroutine if the scalar value is already available and we are not
+			// launching sub-field resolvers asynchronously.
+			if (value || (params.launch.await_ready() && result.await_ready()))
 			{
-				ModifiedResult::validateScalar<Modifier, Other...>(*value);
-				co_return ResolverResult { response::Value {
-					std::shared_ptr { std::move(value) } } };
-			}
-		}
+				typename ResultTraits<Type, Modifier, Other...>::type awaitedResult;
+				ResolverResult document;
 
-		co_await params.launch;
+				try
+				{
+					if (value)
+					{
+						ModifiedResult::validateScalar<Modifier, Other...>(*value);
+						document.data = response::Value { std::shared_ptr { std::move(value) } };
+					}
+					else
+					{
+						params.launch.await_resume();
+						awaitedResult = result.await_resume();
+					}
+				}
+				catch (schema_exception& scx)
+				{
+					auto errors = scx.getStructuredErrors();
 
-		auto awaitedResult = co_await std::move(result);
+					if (!errors.empty())
+					{
+						document.errors.splice(document.errors.end(), errors);
+					}
+				}
+				catch (const std::exception& ex)
+				{
+					std::ostringstream message;
 
-		if (!awaitedResult)
-		{
-			co_return ResolverResult {};
-		}
+					message << "Field error name: " << params.fieldName
+							<< " unknown error: " << ex.what();
 
-		auto modifiedResult = co_await ModifiedResult::convert<Other...>(std::move(*awaitedResult),
-			std::move(params));
+					document.errors.emplace_back(
+						schema_error { message.str(), params.getLocation() });
+				}
 
-		co_return modifiedResult;
+				if (!awaitedResult)
+				{
+					return AwaitableResolver { std::move(document) };
+				}
+
+				return ModifiedResult::convert<Other...>(std::move(*awaitedResult),
+					std::move(params));
+			}
+		}
+
+		return convertOptional<Modifier, Other...>(std::move(result), std::move(params));
 	}
 
 	// Peel off list modifiers.
@@ -1094,6 +1523,11 @@ struct ModifiedResult
 		typename ResultTraits<Type, Modifier, Other...>::future_type result,
 		ResolverParams params) requires ListModifier<Modifier>
 	{
+		if (auto error = result.get_error())
+		{
+			co_return buildFieldError(std::move(*error), params);
+		}
+
 		if constexpr (!ObjectBaseType<Type>)
 		{
 			auto value = result.get_value();
@@ -1107,16 +1541,12 @@ struct ModifiedResult
 		}
 
 		std::vector<AwaitableResolver> children;
-		const auto parentPath = params.errorPath;
 
 		co_await params.launch;
 
 		auto awaitedResult = co_await std::move(result);
 
 		children.reserve(awaitedResult.size());
-		params.errorPath = std::make_optional(
-			field_path { parentPath ? std::make_optional(std::cref(*parentPath)) : std::nullopt,
-				path_segment { size_t { 0 } } });
 
 		using vector_type = std::decay_t<decltype(awaitedResult)>;
 
@@ -1130,7 +1560,6 @@ struct ModifiedResult
 			{
 				children.push_back(
 					ModifiedResult::convert<Other...>(std::move(entry), ResolverParams(params)));
-				++std::get<size_t>(params.errorPath->segment);
 			}
 		}
 		else
@@ -1139,27 +1568,26 @@ struct ModifiedResult
 			{
 				children.push_back(
 					ModifiedResult::convert<Other...>(std::move(entry), ResolverParams(params)));
-				++std::get<size_t>(params.errorPath->segment);
 			}
 		}
 
 		ResolverResult document { response::Value { response::Type::List } };
 
 		document.data.reserve(children.size());
-		std::get<size_t>(params.errorPath->segment) = 0;
 
-		for (auto& child : children)
+		for (size_t index = 0; index < children.size(); ++index)
 		{
 			try
 			{
 				co_await params.launch;
 
-				auto value = co_await std::move(child);
+				auto value = co_await std::move(children[index]);
 
 				document.data.emplace_back(std::move(value.data));
 
 				if (!value.errors.empty())
 				{
+					prependErrorPath(value.errors, path_segment { index });
 					document.errors.splice(document.errors.end(), value.errors);
 				}
 			}
@@ -1169,6 +1597,7 @@ struct ModifiedResult
 
 				if (!errors.empty())
 				{
+					prependErrorPath(errors, path_segment { index });
 					document.errors.splice(document.errors.end(), errors);
 				}
 			}
@@ -1181,10 +1610,8 @@ struct ModifiedResult
 
 				document.errors.emplace_back(schema_error { message.str(),
 					params.getLocation(),
-					buildErrorPath(params.errorPath) });
+					error_path { path_segment { index } } });
 			}
-
-			++std::get<size_t>(params.errorPath->segment);
 		}
 
 		co_return document;
@@ -1234,21 +1661,89 @@ struct ModifiedResult
 	{
 		static_assert(!ObjectBaseType<Type>, "ModfiedResult<Object> needs special handling");
 
+		if (auto error = result.get_error())
+		{
+			return AwaitableResolver { buildFieldError(std::move(*error), params) };
+		}
+
 		auto value = result.get_value();
 
-		if (value)
+		// Skip the coroutine if the value is already available and we are not launching sub-field
+		// resolvers asynchronously. This is the common case for leaf fields, and it returns a
+		// ready AwaitableResolver without allocating a coroutine frame or a promise.
+		if (!value && !(params.launch.await_ready() && result.await_ready()))
 		{
-			Result<Type>::validateScalar(*value);
-			co_return ResolverResult { response::Value { std::shared_ptr { std::move(value) } } };
+			return resolveAsync(std::move(result), std::move(params), std::move(resolver));
 		}
 
-		auto pendingResolver = std::move(resolver);
+		ResolverResult document;
+
+		try
+		{
+			if (value)
+			{
+				Result<Type>::validateScalar(*value);
+				document.data = response::Value { std::shared_ptr { std::move(value) } };
+			}
+			else
+			{
+				params.launch.await_resume();
+				document.data = resolver(result.await_resume(), params);
+			}
+		}
+		catch (schema_exception& scx)
+		{
+			auto errors = scx.getStructuredErrors();
+
+			if (!errors.empty())
+			{
+				document.errors.splice(document.errors.end(), errors);
+			}
+		}
+		catch (const std::exception& ex)
+		{
+			std::ostringstream message;
+
+			message << "Field name: " << params.fieldName << " unknown error: " << ex.what();
+
+			document.errors.emplace_back(schema_error { message.str(), params.getLocation() });
+		}
+
+		return AwaitableResolver { std::move(document) };
+	}
+
+private:
+	// Finish peeling off nullable modifiers once the result is available.
+	template <TypeModifier Modifier, TypeModifier... Other>
+	[[nodiscard]] static AwaitableResolver convertOptional(
+		typename ResultTraits<Type, Modifier, Other...>::future_type result, ResolverParams params)
+	{
+		co_await params.launch;
+
+		auto awaitedResult = co_await std::move(result);
+
+		if (!awaitedResult)
+		{
+			co_return ResolverResult {};
+		}
+
+		auto modifiedResult = co_await ModifiedResult::convert<Other...>(std::move(*awaitedResult),
+			std::move(params));
+
+		co_return modifiedResult;
+	}
+
+	// Wait for the result and convert it with the resolver callback.
+	[[nodiscard]] static AwaitableResolver resolveAsync(
+		typename ResultTraits<Type>::future_type result, ResolverParams params,
+		ResolverCallback resolver)
+	{
 		ResolverResult document;
 
 		try
 		{
 			co_await params.launch;
-			document.data = pendingResolver(co_await result, params);
+			document.data = resolver(co_await result, params);
 		}
 		catch (schema_exception& scx)
 		{
@@ -1265,9 +1760,7 @@ struct ModifiedResult
 
 			message << "Field name: " << params.fieldName << " unknown error: " << ex.what();
 
-			document.errors.emplace_back(schema_error { message.str(),
-				params.getLocation(),
-				buildErrorPath(params.errorPath) });
+			document.errors.emplace_back(schema_error { message.str(), params.getLocation() });
 		}
 
 		co_return document;
@@ -1426,6 +1919,40 @@ class SubscriptionPlaceholder
 	SubscriptionPlaceholder() noexcept = default;
 };
 
+// Options for the estimated cost analysis performed during validation. Each field costs its weight
+// plus the cost of its selection set multiplied by the estimated number of results. That comes
+// from an integer literal for the first or last argument if there is one, maxPageSize if the first
+// or last argument comes from a variable, otherwise it's defaultListSize for fields with a list
+// type, or 1 for any other field.
+struct [[nodiscard]] RequestCostOptions
+{
+	// Weights for individual fields, keyed by "Type.field". Any other field has a weight of 1.
+	std::map<std::string, size_t, std::less<>> fieldWeights {};
+
+	// Estimated number of results for a list field without a first or last argument.
+	size_t defaultListSize = 1;
+
+	// Estimated number of results for a first or last argument which is not an integer literal. The
+	// client can pass any page size in a variable, so this should be the largest page size the
+	// service will return. If this is not set, it charges defaultListSize.
+	std::optional<size_t> maxPageSize {};
+
+	// If this is set, Request::resolve refuses to execute operations with a higher cost.
+	std::optional<size_t> budget {};
+};
+
+// Counters for the validation cache in Request, which can be used to tune the cache size.
+struct [[nodiscard]] ValidationCacheStats
+{
+	size_t hits = 0;
+	size_t misses = 0;
+	size_t evictions = 0;
+	size_t size = 0;
+};
+
+// The introspection cache in Request keeps the same counters.
+using IntrospectionCacheStats = ValidationCacheStats;
+
 // Forward declare just the class type so we can reference it in the Request::_validation member.
 class ValidateExecutableVisitor;
 
@@ -1440,6 +1967,31 @@ protected:
 	GRAPHQLSERVICE_EXPORT virtual ~Request();
 
 public:
+	// This should be called before the Request is shared between threads. Documents which have
+	// already been validated keep the costs that were computed at that time.
+	GRAPHQLSERVICE_EXPORT void setCostOptions(RequestCostOptions options);
+
+	// Validate the top-level definitions in each document on up to this many threads. The worker
+	// threads are started here and reused for every document. The errors are still reported in
+	// document order. The default of 1 validates them serially.
+	GRAPHQLSERVICE_EXPORT void setValidationConcurrency(size_t concurrency);
+
+	// Cache the validation results for up to this many documents, keyed by peg::ast::hash and
+	// compared with peg::ast::normalized, so the same document does not need to be validated again
+	// if it is parsed again. The least recently used results are evicted first. The default of 0
+	// disables the cache.
+	GRAPHQLSERVICE_EXPORT void setValidationCacheSize(size_t maxSize);
+	GRAPHQLSERVICE_EXPORT [[nodiscard]] ValidationCacheStats getValidationCacheStats() const;
+
+	// Memoize the resolved responses for up to this many query operations which only select
+	// introspection fields (__schema, __type, or __typename) at the top level and do not have any
+	// variables. The schema is immutable, so those responses do not change between requests. They
+	// are keyed by the operation name and a hash of the tokens peg::normalizeDocument serializes,
+	// and those tokens are compared on a hit. Responses with errors are never cached. The least
+	// recently used responses are evicted first. The default of 0 disables the cache.
+	GRAPHQLSERVICE_EXPORT void setIntrospectionCacheSize(size_t maxSize);
+	GRAPHQLSERVICE_EXPORT [[nodiscard]] IntrospectionCacheStats getIntrospectionCacheStats() const;
+
 	GRAPHQLSERVICE_EXPORT [[nodiscard]] std::list<schema_error> validate(peg::ast& query) const;
 
 	GRAPHQLSERVICE_EXPORT [[nodiscard]] std::pair<std::string_view, const peg::ast_node*>
@@ -1453,6 +2005,16 @@ public:
 	GRAPHQLSERVICE_EXPORT [[nodiscard]] AwaitableDeliver deliver(RequestDeliverParams params) const;
 
 private:
+	[[nodiscard]] bool findCachedValidation(peg::ast& query, std::list<schema_error>& errors) const;
+	void cacheValidation(const peg::ast& query, const std::list<schema_error>& errors) const;
+	void trimValidationCache() const;
+
+	[[nodiscard]] std::shared_ptr<const response::Value> findCachedIntrospection(
+		size_t hash, const std::string& normalized, std::string_view operationName) const;
+	void cacheIntrospection(size_t hash, std::string&& normalized, std::string_view operationName,
+		std::shared_ptr<const response::Value> document) const;
+	void trimIntrospectionCache() const;
+
 	[[nodiscard]] SubscriptionKey addSubscription(RequestSubscribeParams&& params);
 	void removeSubscription(SubscriptionKey key);
 	[[nodiscard]] std::vector<std::shared_ptr<const SubscriptionData>> collectRegistrations(
@@ -1461,6 +2023,45 @@ private:
 	const TypeMap _operations;
 	mutable std::mutex _validationMutex {};
 	const std::unique_ptr<ValidateExecutableVisitor> _validation;
+	std::optional<size_t> _costBudget;
+
+	struct ValidationCacheEntry
+	{
+		size_t hash = 0;
+		std::string normalized;
+		std::string source;
+		std::list<schema_error> errors;
+		std::map<std::string, size_t, std::less<>> operationCosts;
+	};
+
+	using ValidationCache = std::list<ValidationCacheEntry>;
+
+	// The validation cache is also guarded by _validationMutex. The most recently used entries are
+	// at the front of the list.
+	size_t _validationCacheSize = 0;
+	mutable ValidationCache _validationCache;
+	mutable std::map<size_t, ValidationCache::iterator> _validationCacheIndex;
+	mutable ValidationCacheStats _validationCacheStats;
+	mutable std::mutex _introspectionMutex {};
+
+	using IntrospectionCacheKey = std::pair<size_t, std::string>;
+
+	struct IntrospectionCacheEntry
+	{
+		IntrospectionCacheKey key;
+		std::string normalized;
+		std::shared_ptr<const response::Value> document;
+	};
+
+	using IntrospectionCache = std::list<IntrospectionCacheEntry>;
+
+	// The size is checked on every request before taking _introspectionMutex, which guards the
+	// rest of the introspection cache. The most recently used entries are at the front of the list.
+	std::atomic_size_t _introspectionCacheSize = 0;
+	mutable IntrospectionCache _introspectionCache;
+	mutable std::map<IntrospectionCacheKey, IntrospectionCache::iterator>
+		_introspectionCacheIndex;
+	mutable IntrospectionCacheStats _introspectionCacheStats;
 	mutable std::mutex _subscriptionMutex {};
 	internal::sorted_map<SubscriptionKey, std::shared_ptr<const SubscriptionData>> _subscriptions;
 	internal::sorted_map<SubscriptionName, internal::sorted_set<SubscriptionKey>> _listeners;
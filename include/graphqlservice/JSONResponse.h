@@ -20,12 +20,31 @@
 
 #include "graphqlservice/GraphQLResponse.h"
 
+#include <cstddef>
+#include <functional>
+
 namespace graphql::response {
 
 JSONRESPONSE_EXPORT [[nodiscard]] std::string toJSON(Value&& response);
 
+// The streaming overloads of toJSON write the JSON through a fixed size buffer instead of building
+// a std::string, and they pass it to the sink in chunks of at most c_jsonChunkSize bytes.
+constexpr size_t c_jsonChunkSize = 64 * 1024;
+
+using JSONSink = std::function<void(const char* data, size_t size)>;
+
+JSONRESPONSE_EXPORT void toJSON(Value&& response, const JSONSink& sink);
+
+// Write the chunks to a file descriptor, e.g. a pipe or a socket. Throws std::system_error if a
+// write fails.
+JSONRESPONSE_EXPORT void toJSON(Value&& response, int fd);
+
 JSONRESPONSE_EXPORT [[nodiscard]] Value parseJSON(const std::string& json);
 
+// Parse the JSON without building a Value, passing each token to the visitor instead. Throws
+// std::invalid_argument if the JSON is malformed.
+JSONRESPONSE_EXPORT void parseJSON(const std::string& json, ValueVisitor& visitor);
+
 } // namespace graphql::response
 
 #endif // JSONRESPONSE_H
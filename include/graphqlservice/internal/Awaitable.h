@@ -16,11 +16,231 @@
 #endif
 // clang-format on
 
+#include <array>
+#include <atomic>
+#include <cstddef>
 #include <future>
+#include <new>
 #include <type_traits>
+#include <variant>
 
 namespace graphql::internal {
 
+// Resolving a selection set creates several coroutine frames for every field, and most of them
+// have one of a handful of sizes. The promise types in this library recycle their frames through
+// thread-local free lists, bucketed by size, instead of going back to the global allocator for
+// each one. These counters only cover frames allocated on the calling thread.
+struct [[nodiscard]] CoroutineFrameStats
+{
+	static constexpr size_t BucketGranularity = 64;
+	static constexpr size_t BucketCount = 32;
+
+	// Total number of frames allocated through the pool.
+	size_t allocations = 0;
+
+	// Frames which were reused from a free list instead of the global allocator.
+	size_t reused = 0;
+
+	// Frames which were larger than the largest bucket and always use the global allocator.
+	size_t oversized = 0;
+
+	// Size in bytes of the largest frame.
+	size_t largestFrame = 0;
+
+	// Number of frames allocated in each bucket, bucket i holds frames of up to
+	// (i + 1) * BucketGranularity bytes.
+	std::array<size_t, BucketCount> buckets {};
+};
+
+class [[nodiscard]] CoroutineFramePool
+{
+public:
+	// Limit how many bytes of free frames each thread keeps across all of its buckets.
+	static constexpr size_t DefaultMaxFreeBytes = 256 * 1024;
+
+	// Frames which are released past this limit go back to the global allocator, so 0 disables
+	// the pool. This applies to every thread, and it trims the free lists of the calling thread.
+	static void setMaxFreeBytes(size_t maxFreeBytes) noexcept
+	{
+		s_maxFreeBytes.store(maxFreeBytes, std::memory_order_relaxed);
+
+		if (s_state == State::Alive)
+		{
+			instance().trim(maxFreeBytes);
+		}
+	}
+
+	[[nodiscard]] static size_t getMaxFreeBytes() noexcept
+	{
+		return s_maxFreeBytes.load(std::memory_order_relaxed);
+	}
+
+	[[nodiscard]] static void* allocate(size_t size)
+	{
+		// Coroutines which are created while this thread is shutting down, e.g. from another
+		// thread_local destructor, can't use the pool once it has been destroyed.
+		if (s_state == State::Destroyed)
+		{
+			return ::operator new(size);
+		}
+
+		auto& pool = instance();
+		const auto index = bucketIndex(size);
+
+		++pool._stats.allocations;
+
+		if (size > pool._stats.largestFrame)
+		{
+			pool._stats.largestFrame = size;
+		}
+
+		if (index >= CoroutineFrameStats::BucketCount)
+		{
+			++pool._stats.oversized;
+			return ::operator new(size);
+		}
+
+		auto& bucket = pool._buckets[index];
+
+		++pool._stats.buckets[index];
+
+		if (bucket.head != nullptr)
+		{
+			auto frame = bucket.head;
+
+			bucket.head = frame->next;
+			pool._freeBytes -= bucketSize(index);
+			++pool._stats.reused;
+
+			return frame;
+		}
+
+		return ::operator new(bucketSize(index));
+	}
+
+	static void deallocate(void* frame, size_t size) noexcept
+	{
+		const auto index = bucketIndex(size);
+
+		// Frames which are released while this thread is shutting down go straight back to the
+		// global allocator.
+		if (index < CoroutineFrameStats::BucketCount && s_state != State::Destroyed)
+		{
+			auto& pool = instance();
+
+			if (pool._freeBytes + bucketSize(index) <= getMaxFreeBytes())
+			{
+				auto& bucket = pool._buckets[index];
+
+				bucket.head = new (frame) FreeFrame { bucket.head };
+				pool._freeBytes += bucketSize(index);
+				return;
+			}
+		}
+
+		::operator delete(frame);
+	}
+
+	[[nodiscard]] static CoroutineFrameStats getStats() noexcept
+	{
+		return instance()._stats;
+	}
+
+	static void resetStats() noexcept
+	{
+		instance()._stats = {};
+	}
+
+private:
+	enum class State
+	{
+		Uninitialized,
+		Alive,
+		Destroyed,
+	};
+
+	struct FreeFrame
+	{
+		FreeFrame* next;
+	};
+
+	struct Bucket
+	{
+		FreeFrame* head = nullptr;
+	};
+
+	CoroutineFramePool() noexcept
+	{
+		s_state = State::Alive;
+	}
+
+	~CoroutineFramePool()
+	{
+		s_state = State::Destroyed;
+		trim(0);
+	}
+
+	// Release free frames to the global allocator, starting with the largest ones.
+	void trim(size_t maxFreeBytes) noexcept
+	{
+		for (size_t index = CoroutineFrameStats::BucketCount;
+			 index > 0 && _freeBytes > maxFreeBytes;
+			 --index)
+		{
+			auto& bucket = _buckets[index - 1];
+
+			while (bucket.head != nullptr && _freeBytes > maxFreeBytes)
+			{
+				auto frame = bucket.head;
+
+				bucket.head = frame->next;
+				_freeBytes -= bucketSize(index - 1);
+				::operator delete(frame);
+			}
+		}
+	}
+
+	[[nodiscard]] static CoroutineFramePool& instance() noexcept
+	{
+		thread_local CoroutineFramePool s_pool;
+
+		return s_pool;
+	}
+
+	[[nodiscard]] static constexpr size_t bucketIndex(size_t size) noexcept
+	{
+		return (size + CoroutineFrameStats::BucketGranularity - 1)
+			/ CoroutineFrameStats::BucketGranularity
+			- 1;
+	}
+
+	[[nodiscard]] static constexpr size_t bucketSize(size_t index) noexcept
+	{
+		return (index + 1) * CoroutineFrameStats::BucketGranularity;
+	}
+
+	static inline thread_local State s_state = State::Uninitialized;
+	static inline std::atomic_size_t s_maxFreeBytes = DefaultMaxFreeBytes;
+
+	std::array<Bucket, CoroutineFrameStats::BucketCount> _buckets {};
+	size_t _freeBytes = 0;
+	CoroutineFrameStats _stats {};
+};
+
+// Promise types derive from this to allocate their coroutine frames from the CoroutineFramePool.
+struct PooledCoroutineFrame
+{
+	[[nodiscard]] static void* operator new(size_t size)
+	{
+		return CoroutineFramePool::allocate(size);
+	}
+
+	static void operator delete(void* frame, size_t size) noexcept
+	{
+		CoroutineFramePool::deallocate(frame, size);
+	}
+};
+
 template <typename T>
 class [[nodiscard]] Awaitable;
 
@@ -38,7 +258,7 @@ public:
 		_value.get();
 	}
 
-	struct promise_type
+	struct promise_type : PooledCoroutineFrame
 	{
 		[[nodiscard]] Awaitable get_return_object() noexcept
 		{
@@ -97,12 +317,24 @@ public:
 	{
 	}
 
+	// Construct an Awaitable which is already resolved, without allocating a promise or a
+	// coroutine frame.
+	explicit Awaitable(T value)
+		: _value { std::in_place_type<T>, std::move(value) }
+	{
+	}
+
 	[[nodiscard]] T get()
 	{
-		return _value.get();
+		if (auto value = std::get_if<T>(&_value))
+		{
+			return std::move(*value);
+		}
+
+		return std::get<std::future<T>>(_value).get();
 	}
 
-	struct promise_type
+	struct promise_type : PooledCoroutineFrame
 	{
 		[[nodiscard]] Awaitable get_return_object() noexcept
 		{
@@ -150,11 +382,11 @@ public:
 
 	[[nodiscard]] T await_resume()
 	{
-		return _value.get();
+		return get();
 	}
 
 private:
-	std::future<T> _value;
+	std::variant<T, std::future<T>> _value;
 };
 
 } // namespace graphql::internal
@@ -18,6 +18,7 @@
 #endif // !GRAPHQL_DLLEXPORTS
 // clang-format on
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <string_view>
@@ -58,6 +59,17 @@ public:
 	GRAPHQLRESPONSE_EXPORT [[nodiscard]] static std::string toBase64(
 		const std::vector<std::uint8_t>& bytes);
 
+	// Get the number of Base64 characters for a set of bytes, including padding.
+	[[nodiscard]] static constexpr size_t encodedLength(size_t count) noexcept
+	{
+		return (count + 2) / 3 * 4;
+	}
+
+	// Convert a set of bytes to Base64 directly in an output buffer, which must have room for
+	// encodedLength(bytes.size()) characters. Nothing else is written, not even a null terminator.
+	GRAPHQLRESPONSE_EXPORT static void toBase64(
+		const std::vector<std::uint8_t>& bytes, char* output);
+
 	enum class [[nodiscard]] Comparison {
 		// Valid Base64 always compares as less than non-empty invalid Base64.
 		InvalidBase64 = -2,
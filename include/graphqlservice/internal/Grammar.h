@@ -12,13 +12,16 @@
 #include "graphqlservice/internal/SyntaxTree.h"
 
 #include <functional>
+#include <string_view>
 
 namespace graphql::peg {
 
 using namespace tao::graphqlpeg;
 
-template <typename Rule>
-inline void for_each_child(const ast_node& n, std::function<void(const ast_node&)>&& func)
+// The callbacks are template parameters rather than std::function so they can be inlined at the
+// call site, and the child nodes are matched by the rule ID assigned at parse time.
+template <typename Rule, typename Func>
+inline void for_each_child(const ast_node& n, Func&& func)
 {
 	for (const auto& child : n.children)
 	{
@@ -29,8 +32,8 @@ inline void for_each_child(const ast_node& n, std::function<void(const ast_node&
 	}
 }
 
-template <typename Rule>
-inline void on_first_child_if(const ast_node& n, std::function<bool(const ast_node&)>&& func)
+template <typename Rule, typename Func>
+inline void on_first_child_if(const ast_node& n, Func&& func)
 {
 	for (const auto& child : n.children)
 	{
@@ -41,8 +44,8 @@ inline void on_first_child_if(const ast_node& n, std::function<bool(const ast_no
 	}
 }
 
-template <typename Rule>
-inline void on_first_child(const ast_node& n, std::function<void(const ast_node&)>&& func)
+template <typename Rule, typename Func>
+inline void on_first_child(const ast_node& n, Func&& func)
 {
 	for (const auto& child : n.children)
 	{
@@ -54,6 +57,28 @@ inline void on_first_child(const ast_node& n, std::function<void(const ast_node&
 	}
 }
 
+template <typename Rule>
+[[nodiscard]] inline const ast_node* first_child(const ast_node& n) noexcept
+{
+	for (const auto& child : n.children)
+	{
+		if (child->is_type<Rule>())
+		{
+			return child.get();
+		}
+	}
+
+	return nullptr;
+}
+
+template <typename Rule>
+[[nodiscard]] inline std::string_view first_child_view(const ast_node& n) noexcept
+{
+	const auto child = first_child<Rule>(n);
+
+	return child ? child->string_view() : std::string_view {};
+}
+
 // https://spec.graphql.org/October2021/#sec-Source-Text
 struct source_character : sor<one<0x0009, 0x000A, 0x000D>, utf8::range<0x0020, 0xFFFF>>
 {
@@ -1203,6 +1228,21 @@ struct executable_document : must<executable_document_content>
 {
 };
 
+struct executable_stream_prefix
+	: seq<bof, opt<utf8::bom>, star<ignored>> // leading whitespace/ignored
+{
+};
+
+struct executable_stream_definition_content
+	: seq<executable_definition, star<ignored>> // executable definition and trailing ignored
+{
+};
+
+// https://spec.graphql.org/October2021/#ExecutableDefinition
+struct executable_stream_definition : must<executable_stream_definition_content>
+{
+};
+
 // https://spec.graphql.org/October2021/#Definition
 struct schema_type_definition : sor<type_system_definition, type_system_extension>
 {
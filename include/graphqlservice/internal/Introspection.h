@@ -10,8 +10,12 @@
 
 #include "graphqlservice/internal/Schema.h"
 
+#include <shared_mutex>
+#include <unordered_map>
+
 namespace graphql::introspection {
 
+class IntrospectionCache;
 class Schema;
 class Directive;
 class Type;
@@ -35,12 +39,14 @@ public:
 
 private:
 	const std::shared_ptr<schema::Schema> _schema;
+	const std::shared_ptr<IntrospectionCache> _cache;
 };
 
 class [[nodiscard]] Type
 {
 public:
-	GRAPHQLSERVICE_EXPORT explicit Type(const std::shared_ptr<const schema::BaseType>& type);
+	GRAPHQLSERVICE_EXPORT explicit Type(const std::shared_ptr<const schema::BaseType>& type,
+		std::weak_ptr<IntrospectionCache> cache = {});
 
 	// Accessors
 	GRAPHQLSERVICE_EXPORT [[nodiscard]] TypeKind getKind() const;
@@ -63,12 +69,14 @@ public:
 
 private:
 	const std::shared_ptr<const schema::BaseType> _type;
+	const std::weak_ptr<IntrospectionCache> _cache;
 };
 
 class [[nodiscard]] Field
 {
 public:
-	GRAPHQLSERVICE_EXPORT explicit Field(const std::shared_ptr<const schema::Field>& field);
+	GRAPHQLSERVICE_EXPORT explicit Field(const std::shared_ptr<const schema::Field>& field,
+		std::weak_ptr<IntrospectionCache> cache = {});
 
 	// Accessors
 	GRAPHQLSERVICE_EXPORT [[nodiscard]] std::string getName() const;
@@ -81,13 +89,15 @@ public:
 
 private:
 	const std::shared_ptr<const schema::Field> _field;
+	const std::weak_ptr<IntrospectionCache> _cache;
 };
 
 class [[nodiscard]] InputValue
 {
 public:
 	GRAPHQLSERVICE_EXPORT explicit InputValue(
-		const std::shared_ptr<const schema::InputValue>& inputValue);
+		const std::shared_ptr<const schema::InputValue>& inputValue,
+		std::weak_ptr<IntrospectionCache> cache = {});
 
 	// Accessors
 	GRAPHQLSERVICE_EXPORT [[nodiscard]] std::string getName() const;
@@ -97,13 +107,15 @@ public:
 
 private:
 	const std::shared_ptr<const schema::InputValue> _inputValue;
+	const std::weak_ptr<IntrospectionCache> _cache;
 };
 
 class [[nodiscard]] EnumValue
 {
 public:
 	GRAPHQLSERVICE_EXPORT explicit EnumValue(
-		const std::shared_ptr<const schema::EnumValue>& enumValue);
+		const std::shared_ptr<const schema::EnumValue>& enumValue,
+		std::weak_ptr<IntrospectionCache> cache = {});
 
 	// Accessors
 	GRAPHQLSERVICE_EXPORT [[nodiscard]] std::string getName() const;
@@ -113,13 +125,15 @@ public:
 
 private:
 	const std::shared_ptr<const schema::EnumValue> _enumValue;
+	const std::weak_ptr<IntrospectionCache> _cache;
 };
 
 class [[nodiscard]] Directive
 {
 public:
 	GRAPHQLSERVICE_EXPORT explicit Directive(
-		const std::shared_ptr<const schema::Directive>& directive);
+		const std::shared_ptr<const schema::Directive>& directive,
+		std::weak_ptr<IntrospectionCache> cache = {});
 
 	// Accessors
 	GRAPHQLSERVICE_EXPORT [[nodiscard]] std::string getName() const;
@@ -131,6 +145,41 @@ public:
 
 private:
 	const std::shared_ptr<const schema::Directive> _directive;
+	const std::weak_ptr<IntrospectionCache> _cache;
+};
+
+// The schema is immutable once it has been constructed, so the introspection wrapper objects for
+// each of its types, fields, arguments, enum values, and directives can be created once and shared
+// by every request which introspects it.
+class [[nodiscard]] IntrospectionCache : public std::enable_shared_from_this<IntrospectionCache>
+{
+public:
+	GRAPHQLSERVICE_EXPORT IntrospectionCache();
+
+	GRAPHQLSERVICE_EXPORT [[nodiscard]] std::shared_ptr<object::Type> get(
+		const std::shared_ptr<const schema::BaseType>& type);
+	GRAPHQLSERVICE_EXPORT [[nodiscard]] std::shared_ptr<object::Field> get(
+		const std::shared_ptr<const schema::Field>& field);
+	GRAPHQLSERVICE_EXPORT [[nodiscard]] std::shared_ptr<object::InputValue> get(
+		const std::shared_ptr<const schema::InputValue>& inputValue);
+	GRAPHQLSERVICE_EXPORT [[nodiscard]] std::shared_ptr<object::EnumValue> get(
+		const std::shared_ptr<const schema::EnumValue>& enumValue);
+	GRAPHQLSERVICE_EXPORT [[nodiscard]] std::shared_ptr<object::Directive> get(
+		const std::shared_ptr<const schema::Directive>& directive);
+
+private:
+	template <class TObject, class TWrapper, class TEntry>
+	[[nodiscard]] std::shared_ptr<TObject> find(
+		std::unordered_map<const TEntry*, std::shared_ptr<TObject>>& wrappers,
+		const std::shared_ptr<const TEntry>& entry);
+
+	std::shared_mutex _mutex;
+	std::unordered_map<const schema::BaseType*, std::shared_ptr<object::Type>> _types;
+	std::unordered_map<const schema::Field*, std::shared_ptr<object::Field>> _fields;
+	std::unordered_map<const schema::InputValue*, std::shared_ptr<object::InputValue>>
+		_inputValues;
+	std::unordered_map<const schema::EnumValue*, std::shared_ptr<object::EnumValue>> _enumValues;
+	std::unordered_map<const schema::Directive*, std::shared_ptr<object::Directive>> _directives;
 };
 
 } // namespace graphql::introspection
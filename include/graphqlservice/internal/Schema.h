@@ -8,7 +8,8 @@
 
 #include "graphqlservice/GraphQLService.h"
 
-#include <shared_mutex>
+#include <atomic>
+#include <mutex>
 
 namespace graphql {
 namespace introspection {
@@ -16,8 +17,16 @@ namespace introspection {
 enum class [[nodiscard]] TypeKind;
 enum class [[nodiscard]] DirectiveLocation;
 
+class IntrospectionCache;
+
 } // namespace introspection
 
+namespace service {
+
+class ValidateSchema;
+
+} // namespace service
+
 namespace schema {
 
 class Schema;
@@ -65,6 +74,17 @@ public:
 	GRAPHQLSERVICE_EXPORT [[nodiscard]] const std::vector<std::shared_ptr<const Directive>>&
 	directives() const noexcept;
 
+	// The introspection wrapper objects are created on demand and shared by every request, since
+	// the schema is immutable once it has been constructed.
+	GRAPHQLSERVICE_EXPORT [[nodiscard]] std::shared_ptr<introspection::IntrospectionCache>
+	introspectionCache() const;
+
+	// The tables which the validator needs from the schema are built when the first Request using
+	// this schema is constructed, and then shared by every other Request using it. This does not
+	// reduce the cost of building the schema itself or the tables the first time.
+	GRAPHQLSERVICE_EXPORT [[nodiscard]] std::shared_ptr<const service::ValidateSchema>
+	validateSchema();
+
 private:
 	const bool _noIntrospection = false;
 	const std::string_view _description;
@@ -75,12 +95,17 @@ private:
 	internal::string_view_map<size_t> _typeMap;
 	std::vector<std::pair<std::string_view, std::shared_ptr<const BaseType>>> _types;
 	std::vector<std::shared_ptr<const Directive>> _directives;
-	std::shared_mutex _nonNullWrappersMutex;
-	internal::sorted_map<std::shared_ptr<const BaseType>, std::shared_ptr<const BaseType>>
-		_nonNullWrappers;
-	std::shared_mutex _listWrappersMutex;
-	internal::sorted_map<std::shared_ptr<const BaseType>, std::shared_ptr<const BaseType>>
-		_listWrappers;
+
+	// Undefined variable types have no BaseType to own their wrappers, so the schema owns them.
+	std::once_flag _undefinedNonNullOnce;
+	std::shared_ptr<const BaseType> _undefinedNonNull;
+	std::once_flag _undefinedListOnce;
+	std::shared_ptr<const BaseType> _undefinedList;
+
+	mutable std::once_flag _introspectionCacheOnce;
+	mutable std::shared_ptr<introspection::IntrospectionCache> _introspectionCache;
+	std::once_flag _validateSchemaOnce;
+	std::shared_ptr<const service::ValidateSchema> _validateSchema;
 };
 
 class [[nodiscard]] BaseType : public std::enable_shared_from_this<BaseType>
@@ -113,8 +138,20 @@ protected:
 	BaseType(introspection::TypeKind kind, std::string_view description);
 
 private:
+	friend class Schema;
+
+	[[nodiscard]] std::shared_ptr<const BaseType> wrap(introspection::TypeKind kind) const;
+
 	const introspection::TypeKind _kind;
 	const std::string_view _description;
+
+	// The NON_NULL and LIST wrappers for this type are created on demand by Schema::WrapType and
+	// owned by the type they wrap. Once a wrapper has been published, finding it again is just an
+	// atomic load. The owners are only assigned once by the thread which published the wrapper.
+	mutable std::atomic<const BaseType*> _nonNullWrapper = nullptr;
+	mutable std::atomic<const BaseType*> _listWrapper = nullptr;
+	mutable std::shared_ptr<const BaseType> _nonNullWrapperOwner;
+	mutable std::shared_ptr<const BaseType> _listWrapperOwner;
 };
 
 class [[nodiscard]] ScalarType : public BaseType
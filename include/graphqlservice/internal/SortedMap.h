@@ -7,9 +7,12 @@
 #define GRAPHQLSORTEDMAP_H
 
 #include <algorithm>
+#include <cstddef>
+#include <functional>
 #include <initializer_list>
 #include <optional>
 #include <stdexcept>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -369,6 +372,129 @@ template <class V>
 using string_view_map = sorted_map<std::string_view, V, shorter_or_less>;
 using string_view_set = sorted_set<std::string_view, shorter_or_less>;
 
+// Read-only wrapper for a string_view_map or string_view_set which adds a hashed index over the
+// sorted entries. A lookup hashes the key once and usually compares a single entry, instead of a
+// binary search with a string comparison at every step. It's meant for tables which are built once
+// and then searched many times, like the schema information used by validation.
+template <class Container>
+class [[nodiscard]] string_view_hashed
+{
+public:
+	using container_type = Container;
+	using const_iterator = typename Container::const_iterator;
+
+	string_view_hashed() = default;
+
+	explicit string_view_hashed(Container&& entries)
+		: _entries { std::move(entries) }
+	{
+		if (_entries.empty())
+		{
+			return;
+		}
+
+		// Keep the load factor at or below 50% so the linear probes stay short.
+		size_t capacity = 2;
+
+		while (capacity < _entries.size() * 2)
+		{
+			capacity <<= 1;
+		}
+
+		_index.assign(capacity, npos);
+		_mask = capacity - 1;
+
+		size_t position = 0;
+
+		for (const auto& entry : _entries)
+		{
+			auto slot = std::hash<std::string_view> {}(keyOf(entry)) & _mask;
+
+			while (_index[slot] != npos)
+			{
+				slot = (slot + 1) & _mask;
+			}
+
+			_index[slot] = position++;
+		}
+	}
+
+	[[nodiscard]] bool operator==(const string_view_hashed& rhs) const noexcept
+	{
+		return _entries == rhs._entries;
+	}
+
+	[[nodiscard]] bool empty() const noexcept
+	{
+		return _entries.empty();
+	}
+
+	[[nodiscard]] size_t size() const noexcept
+	{
+		return _entries.size();
+	}
+
+	[[nodiscard]] const_iterator begin() const noexcept
+	{
+		return _entries.begin();
+	}
+
+	[[nodiscard]] const_iterator end() const noexcept
+	{
+		return _entries.end();
+	}
+
+	[[nodiscard]] const_iterator find(std::string_view key) const noexcept
+	{
+		if (_index.empty())
+		{
+			return end();
+		}
+
+		for (auto slot = std::hash<std::string_view> {}(key) & _mask; _index[slot] != npos;
+			 slot = (slot + 1) & _mask)
+		{
+			const auto itr = begin() + static_cast<std::ptrdiff_t>(_index[slot]);
+
+			if (keyOf(*itr) == key)
+			{
+				return itr;
+			}
+		}
+
+		return end();
+	}
+
+	// The sorted entries are still available for anything which needs them in order.
+	[[nodiscard]] const Container& entries() const noexcept
+	{
+		return _entries;
+	}
+
+private:
+	static constexpr size_t npos = static_cast<size_t>(-1);
+
+	[[nodiscard]] static std::string_view keyOf(std::string_view key) noexcept
+	{
+		return key;
+	}
+
+	template <class V>
+	[[nodiscard]] static std::string_view keyOf(
+		const std::pair<std::string_view, V>& entry) noexcept
+	{
+		return entry.first;
+	}
+
+	Container _entries;
+	std::vector<size_t> _index;
+	size_t _mask = 0;
+};
+
+template <class V>
+using string_view_hash_map = string_view_hashed<string_view_map<V>>;
+using string_view_hash_set = string_view_hashed<string_view_set>;
+
 } // namespace graphql::internal
 
 #endif // GRAPHQLSORTEDMAP_H
@@ -34,15 +34,36 @@ public:
 	template <typename U>
 	[[nodiscard]] bool is_type() const noexcept
 	{
+		// The rule ID is assigned in success<Rule>() when the node is constructed, so checking
+		// the common mismatch case is a single integer comparison. The rule ID is a hash of the
+		// demangled rule name rather than a per-module counter, so it is stable across shared
+		// libraries. On a match, confirm the name (usually with a pointer comparison, since the
+		// string_view is cached in a static local variable per specialization of type_name<U>()),
+		// and fall back to a full string compare in case of a hash collision or when the parse
+		// tree is constructed in one module and consumed in another.
+		if (_rule_id != rule_id<U>())
+		{
+			return false;
+		}
+
 		const auto u = type_name<U>();
 
-		// The pointer comparison doesn't work with shared libraries where the parse tree is
-		// constructed in one module and consumed in another. So to optimize this comparison, check
-		// the size first, then the pointer (cached in a static local variable per specialization of
-		// type_name<U>()), then the hash (cached in a static local variable per specialization of
-		// type_hash<U>()) and a full string compare as fallback.
-		return _type_name.size() == u.size()
-			&& (_type_name.data() == u.data() || (_type_hash == type_hash<U>() && _type_name == u));
+		return _type_name.data() == u.data() || _type_name == u;
+	}
+
+	[[nodiscard]] size_t rule_id() const noexcept
+	{
+		return _rule_id;
+	}
+
+	template <typename U>
+	[[nodiscard]] static size_t rule_id() noexcept
+	{
+		// This is cached in a static local variable per-specialization, but each module may have
+		// its own instance of the specialization and the local variable.
+		static const size_t hash = std::hash<std::string_view> {}(type_name<U>());
+
+		return hash;
 	}
 
 	using basic_node_t = parse_tree::basic_node<ast_node>;
@@ -52,7 +73,7 @@ public:
 	{
 		basic_node_t::template success<Rule>(in);
 		_type_name = type_name<Rule>();
-		_type_hash = type_hash<Rule>();
+		_rule_id = rule_id<Rule>();
 	}
 
 private:
@@ -68,18 +89,8 @@ private:
 		return name;
 	}
 
-	template <typename U>
-	[[nodiscard]] static size_t type_hash() noexcept
-	{
-		// This is cached in a static local variable per-specialization, but each module may have
-		// its own instance of the specialization and the local variable.
-		static const size_t hash = std::hash<std::string_view> {}(type_name<U>());
-
-		return hash;
-	}
-
 	std::string_view _type_name;
-	size_t _type_hash = 0;
+	size_t _rule_id = 0;
 
 	using unescaped_t = std::variant<std::string_view, std::string>;
 
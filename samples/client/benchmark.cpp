@@ -4,6 +4,8 @@
 #include "BenchmarkClient.h"
 #include "TodayMock.h"
 
+#include "graphqlservice/JSONResponse.h"
+
 #include <chrono>
 #include <iostream>
 #include <iterator>
@@ -82,6 +84,9 @@ int main(int argc, char** argv)
 	std::vector<std::chrono::steady_clock::duration> durationResolve(iterations);
 	std::vector<std::chrono::steady_clock::duration> durationParseServiceResponse(iterations);
 	std::vector<std::chrono::steady_clock::duration> durationParseResponse(iterations);
+	std::vector<std::chrono::steady_clock::duration> durationToJSON(iterations);
+	std::vector<std::chrono::steady_clock::duration> durationParseJSONValue(iterations);
+	std::vector<std::chrono::steady_clock::duration> durationParseJSONDirect(iterations);
 	const auto startTime = std::chrono::steady_clock::now();
 
 	try
@@ -95,15 +100,29 @@ int main(int argc, char** argv)
 		{
 			const auto startResolve = std::chrono::steady_clock::now();
 			auto response = service->resolve({ query, name }).get();
+			const auto startToJSON = std::chrono::steady_clock::now();
+			const auto json = response::toJSON(response::Value { response });
 			const auto startParseServiceResponse = std::chrono::steady_clock::now();
 			auto serviceResponse = client::parseServiceResponse(std::move(response));
 			const auto startParseResponse = std::chrono::steady_clock::now();
 			const auto parsed = parseResponse(std::move(serviceResponse.data));
-			const auto endParseResponse = std::chrono::steady_clock::now();
+			const auto startParseJSONValue = std::chrono::steady_clock::now();
+			const auto parsedValue = parseResponse(
+				client::parseServiceResponse(response::parseJSON(json)).data);
+			const auto startParseJSONDirect = std::chrono::steady_clock::now();
+			Response parsedDirect;
+			client::ResponseVisitor visitor { makeResponseSink(parsedDirect) };
+
+			response::parseJSON(json, visitor);
+
+			const auto endParseJSONDirect = std::chrono::steady_clock::now();
 
-			durationResolve[i] = startParseServiceResponse - startResolve;
+			durationResolve[i] = startToJSON - startResolve;
+			durationToJSON[i] = startParseServiceResponse - startToJSON;
 			durationParseServiceResponse[i] = startParseResponse - startParseServiceResponse;
-			durationParseResponse[i] = endParseResponse - startParseResponse;
+			durationParseResponse[i] = startParseJSONValue - startParseResponse;
+			durationParseJSONValue[i] = startParseJSONDirect - startParseJSONValue;
+			durationParseJSONDirect[i] = endParseJSONDirect - startParseJSONDirect;
 		}
 	}
 	catch (const std::runtime_error& ex)
@@ -120,6 +139,9 @@ int main(int argc, char** argv)
 	outputSegment("Resolve"sv, durationResolve);
 	outputSegment("ParseServiceResponse"sv, durationParseServiceResponse);
 	outputSegment("ParseResponse"sv, durationParseResponse);
+	outputSegment("ToJSON"sv, durationToJSON);
+	outputSegment("ParseJSON (Value)"sv, durationParseJSONValue);
+	outputSegment("ParseJSON (direct)"sv, durationParseJSONDirect);
 
 	return 0;
 }
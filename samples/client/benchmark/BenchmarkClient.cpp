@@ -74,10 +74,15 @@ query::Query::Response::appointments_AppointmentConnection::pageInfo_PageInfo Re
 
 		for (auto& member : members)
 		{
-			if (member.first == R"js(hasNextPage)js"sv)
+			switch (member.first.size())
 			{
-				result.hasNextPage = ModifiedResponse<bool>::parse(std::move(member.second));
-				continue;
+				case 11:
+					if (member.first == R"js(hasNextPage)js"sv)
+					{
+						result.hasNextPage = ModifiedResponse<bool>::parse(std::move(member.second));
+						continue;
+					}
+					break;
 			}
 		}
 	}
@@ -85,6 +90,35 @@ query::Query::Response::appointments_AppointmentConnection::pageInfo_PageInfo Re
 	return result;
 }
 
+template <>
+class ResponseSink<query::Query::Response::appointments_AppointmentConnection::pageInfo_PageInfo>
+	: public ObjectSink<query::Query::Response::appointments_AppointmentConnection::pageInfo_PageInfo>
+{
+public:
+	ValueSink& add_member(std::string_view key) final
+	{
+		switch (key.size())
+		{
+			case 11:
+				if (key == R"js(hasNextPage)js"sv)
+				{
+					return _hasNextPage;
+				}
+				break;
+		}
+
+		return skip();
+	}
+
+private:
+	void bindMembers(query::Query::Response::appointments_AppointmentConnection::pageInfo_PageInfo& result) noexcept final
+	{
+		_hasNextPage.bind(result.hasNextPage);
+	}
+
+	ModifiedSink<bool> _hasNextPage;
+};
+
 template <>
 query::Query::Response::appointments_AppointmentConnection::edges_AppointmentEdge::node_Appointment Response<query::Query::Response::appointments_AppointmentConnection::edges_AppointmentEdge::node_Appointment>::parse(response::Value&& response)
 {
@@ -96,25 +130,36 @@ query::Query::Response::appointments_AppointmentConnection::edges_AppointmentEdg
 
 		for (auto& member : members)
 		{
-			if (member.first == R"js(id)js"sv)
+			switch (member.first.size())
 			{
-				result.id = ModifiedResponse<response::IdType>::parse(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(when)js"sv)
-			{
-				result.when = ModifiedResponse<response::Value>::parse<TypeModifier::Nullable>(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(subject)js"sv)
-			{
-				result.subject = ModifiedResponse<std::string>::parse<TypeModifier::Nullable>(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(isNow)js"sv)
-			{
-				result.isNow = ModifiedResponse<bool>::parse(std::move(member.second));
-				continue;
+				case 2:
+					if (member.first == R"js(id)js"sv)
+					{
+						result.id = ModifiedResponse<response::IdType>::parse(std::move(member.second));
+						continue;
+					}
+					break;
+				case 4:
+					if (member.first == R"js(when)js"sv)
+					{
+						result.when = ModifiedResponse<response::Value>::parse<TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					break;
+				case 5:
+					if (member.first == R"js(isNow)js"sv)
+					{
+						result.isNow = ModifiedResponse<bool>::parse(std::move(member.second));
+						continue;
+					}
+					break;
+				case 7:
+					if (member.first == R"js(subject)js"sv)
+					{
+						result.subject = ModifiedResponse<std::string>::parse<TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					break;
 			}
 		}
 	}
@@ -122,6 +167,59 @@ query::Query::Response::appointments_AppointmentConnection::edges_AppointmentEdg
 	return result;
 }
 
+template <>
+class ResponseSink<query::Query::Response::appointments_AppointmentConnection::edges_AppointmentEdge::node_Appointment>
+	: public ObjectSink<query::Query::Response::appointments_AppointmentConnection::edges_AppointmentEdge::node_Appointment>
+{
+public:
+	ValueSink& add_member(std::string_view key) final
+	{
+		switch (key.size())
+		{
+			case 2:
+				if (key == R"js(id)js"sv)
+				{
+					return _id;
+				}
+				break;
+			case 4:
+				if (key == R"js(when)js"sv)
+				{
+					return _when;
+				}
+				break;
+			case 5:
+				if (key == R"js(isNow)js"sv)
+				{
+					return _isNow;
+				}
+				break;
+			case 7:
+				if (key == R"js(subject)js"sv)
+				{
+					return _subject;
+				}
+				break;
+		}
+
+		return skip();
+	}
+
+private:
+	void bindMembers(query::Query::Response::appointments_AppointmentConnection::edges_AppointmentEdge::node_Appointment& result) noexcept final
+	{
+		_id.bind(result.id);
+		_when.bind(result.when);
+		_subject.bind(result.subject);
+		_isNow.bind(result.isNow);
+	}
+
+	ModifiedSink<response::IdType> _id;
+	ModifiedSink<response::Value, TypeModifier::Nullable> _when;
+	ModifiedSink<std::string, TypeModifier::Nullable> _subject;
+	ModifiedSink<bool> _isNow;
+};
+
 template <>
 query::Query::Response::appointments_AppointmentConnection::edges_AppointmentEdge Response<query::Query::Response::appointments_AppointmentConnection::edges_AppointmentEdge>::parse(response::Value&& response)
 {
@@ -133,10 +231,15 @@ query::Query::Response::appointments_AppointmentConnection::edges_AppointmentEdg
 
 		for (auto& member : members)
 		{
-			if (member.first == R"js(node)js"sv)
+			switch (member.first.size())
 			{
-				result.node = ModifiedResponse<query::Query::Response::appointments_AppointmentConnection::edges_AppointmentEdge::node_Appointment>::parse<TypeModifier::Nullable>(std::move(member.second));
-				continue;
+				case 4:
+					if (member.first == R"js(node)js"sv)
+					{
+						result.node = ModifiedResponse<query::Query::Response::appointments_AppointmentConnection::edges_AppointmentEdge::node_Appointment>::parse<TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					break;
 			}
 		}
 	}
@@ -144,6 +247,35 @@ query::Query::Response::appointments_AppointmentConnection::edges_AppointmentEdg
 	return result;
 }
 
+template <>
+class ResponseSink<query::Query::Response::appointments_AppointmentConnection::edges_AppointmentEdge>
+	: public ObjectSink<query::Query::Response::appointments_AppointmentConnection::edges_AppointmentEdge>
+{
+public:
+	ValueSink& add_member(std::string_view key) final
+	{
+		switch (key.size())
+		{
+			case 4:
+				if (key == R"js(node)js"sv)
+				{
+					return _node;
+				}
+				break;
+		}
+
+		return skip();
+	}
+
+private:
+	void bindMembers(query::Query::Response::appointments_AppointmentConnection::edges_AppointmentEdge& result) noexcept final
+	{
+		_node.bind(result.node);
+	}
+
+	ModifiedSink<query::Query::Response::appointments_AppointmentConnection::edges_AppointmentEdge::node_Appointment, TypeModifier::Nullable> _node;
+};
+
 template <>
 query::Query::Response::appointments_AppointmentConnection Response<query::Query::Response::appointments_AppointmentConnection>::parse(response::Value&& response)
 {
@@ -155,15 +287,22 @@ query::Query::Response::appointments_AppointmentConnection Response<query::Query
 
 		for (auto& member : members)
 		{
-			if (member.first == R"js(pageInfo)js"sv)
+			switch (member.first.size())
 			{
-				result.pageInfo = ModifiedResponse<query::Query::Response::appointments_AppointmentConnection::pageInfo_PageInfo>::parse(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(edges)js"sv)
-			{
-				result.edges = ModifiedResponse<query::Query::Response::appointments_AppointmentConnection::edges_AppointmentEdge>::parse<TypeModifier::Nullable, TypeModifier::List, TypeModifier::Nullable>(std::move(member.second));
-				continue;
+				case 5:
+					if (member.first == R"js(edges)js"sv)
+					{
+						result.edges = ModifiedResponse<query::Query::Response::appointments_AppointmentConnection::edges_AppointmentEdge>::parse<TypeModifier::Nullable, TypeModifier::List, TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					break;
+				case 8:
+					if (member.first == R"js(pageInfo)js"sv)
+					{
+						result.pageInfo = ModifiedResponse<query::Query::Response::appointments_AppointmentConnection::pageInfo_PageInfo>::parse(std::move(member.second));
+						continue;
+					}
+					break;
 			}
 		}
 	}
@@ -171,6 +310,72 @@ query::Query::Response::appointments_AppointmentConnection Response<query::Query
 	return result;
 }
 
+template <>
+class ResponseSink<query::Query::Response::appointments_AppointmentConnection>
+	: public ObjectSink<query::Query::Response::appointments_AppointmentConnection>
+{
+public:
+	ValueSink& add_member(std::string_view key) final
+	{
+		switch (key.size())
+		{
+			case 5:
+				if (key == R"js(edges)js"sv)
+				{
+					return _edges;
+				}
+				break;
+			case 8:
+				if (key == R"js(pageInfo)js"sv)
+				{
+					return _pageInfo;
+				}
+				break;
+		}
+
+		return skip();
+	}
+
+private:
+	void bindMembers(query::Query::Response::appointments_AppointmentConnection& result) noexcept final
+	{
+		_pageInfo.bind(result.pageInfo);
+		_edges.bind(result.edges);
+	}
+
+	ModifiedSink<query::Query::Response::appointments_AppointmentConnection::pageInfo_PageInfo> _pageInfo;
+	ModifiedSink<query::Query::Response::appointments_AppointmentConnection::edges_AppointmentEdge, TypeModifier::Nullable, TypeModifier::List, TypeModifier::Nullable> _edges;
+};
+
+template <>
+class ResponseSink<query::Query::Response>
+	: public ObjectSink<query::Query::Response>
+{
+public:
+	ValueSink& add_member(std::string_view key) final
+	{
+		switch (key.size())
+		{
+			case 12:
+				if (key == R"js(appointments)js"sv)
+				{
+					return _appointments;
+				}
+				break;
+		}
+
+		return skip();
+	}
+
+private:
+	void bindMembers(query::Query::Response& result) noexcept final
+	{
+		_appointments.bind(result.appointments);
+	}
+
+	ModifiedSink<query::Query::Response::appointments_AppointmentConnection> _appointments;
+};
+
 namespace query::Query {
 
 const std::string& GetOperationName() noexcept
@@ -190,10 +395,15 @@ Response parseResponse(response::Value&& response)
 
 		for (auto& member : members)
 		{
-			if (member.first == R"js(appointments)js"sv)
+			switch (member.first.size())
 			{
-				result.appointments = ModifiedResponse<query::Query::Response::appointments_AppointmentConnection>::parse(std::move(member.second));
-				continue;
+				case 12:
+					if (member.first == R"js(appointments)js"sv)
+					{
+						result.appointments = ModifiedResponse<query::Query::Response::appointments_AppointmentConnection>::parse(std::move(member.second));
+						continue;
+					}
+					break;
 			}
 		}
 	}
@@ -201,5 +411,14 @@ Response parseResponse(response::Value&& response)
 	return result;
 }
 
+std::unique_ptr<ValueSink> makeResponseSink(Response& response)
+{
+	auto result = std::make_unique<ResponseSink<Response>>();
+
+	result->bind(response);
+
+	return result;
+}
+
 } // namespace query::Query
 } // namespace graphql::client
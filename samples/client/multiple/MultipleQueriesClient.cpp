@@ -183,30 +183,43 @@ query::Appointments::Response::appointments_AppointmentConnection::edges_Appoint
 
 		for (auto& member : members)
 		{
-			if (member.first == R"js(id)js"sv)
+			switch (member.first.size())
 			{
-				result.id = ModifiedResponse<response::IdType>::parse(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(subject)js"sv)
-			{
-				result.subject = ModifiedResponse<std::string>::parse<TypeModifier::Nullable>(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(when)js"sv)
-			{
-				result.when = ModifiedResponse<response::Value>::parse<TypeModifier::Nullable>(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(isNow)js"sv)
-			{
-				result.isNow = ModifiedResponse<bool>::parse(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(__typename)js"sv)
-			{
-				result._typename = ModifiedResponse<std::string>::parse(std::move(member.second));
-				continue;
+				case 2:
+					if (member.first == R"js(id)js"sv)
+					{
+						result.id = ModifiedResponse<response::IdType>::parse(std::move(member.second));
+						continue;
+					}
+					break;
+				case 4:
+					if (member.first == R"js(when)js"sv)
+					{
+						result.when = ModifiedResponse<response::Value>::parse<TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					break;
+				case 5:
+					if (member.first == R"js(isNow)js"sv)
+					{
+						result.isNow = ModifiedResponse<bool>::parse(std::move(member.second));
+						continue;
+					}
+					break;
+				case 7:
+					if (member.first == R"js(subject)js"sv)
+					{
+						result.subject = ModifiedResponse<std::string>::parse<TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					break;
+				case 10:
+					if (member.first == R"js(__typename)js"sv)
+					{
+						result._typename = ModifiedResponse<std::string>::parse(std::move(member.second));
+						continue;
+					}
+					break;
 			}
 		}
 	}
@@ -214,6 +227,67 @@ query::Appointments::Response::appointments_AppointmentConnection::edges_Appoint
 	return result;
 }
 
+template <>
+class ResponseSink<query::Appointments::Response::appointments_AppointmentConnection::edges_AppointmentEdge::node_Appointment>
+	: public ObjectSink<query::Appointments::Response::appointments_AppointmentConnection::edges_AppointmentEdge::node_Appointment>
+{
+public:
+	ValueSink& add_member(std::string_view key) final
+	{
+		switch (key.size())
+		{
+			case 2:
+				if (key == R"js(id)js"sv)
+				{
+					return _id;
+				}
+				break;
+			case 4:
+				if (key == R"js(when)js"sv)
+				{
+					return _when;
+				}
+				break;
+			case 5:
+				if (key == R"js(isNow)js"sv)
+				{
+					return _isNow;
+				}
+				break;
+			case 7:
+				if (key == R"js(subject)js"sv)
+				{
+					return _subject;
+				}
+				break;
+			case 10:
+				if (key == R"js(__typename)js"sv)
+				{
+					return __typename;
+				}
+				break;
+		}
+
+		return skip();
+	}
+
+private:
+	void bindMembers(query::Appointments::Response::appointments_AppointmentConnection::edges_AppointmentEdge::node_Appointment& result) noexcept final
+	{
+		_id.bind(result.id);
+		_subject.bind(result.subject);
+		_when.bind(result.when);
+		_isNow.bind(result.isNow);
+		__typename.bind(result._typename);
+	}
+
+	ModifiedSink<response::IdType> _id;
+	ModifiedSink<std::string, TypeModifier::Nullable> _subject;
+	ModifiedSink<response::Value, TypeModifier::Nullable> _when;
+	ModifiedSink<bool> _isNow;
+	ModifiedSink<std::string> __typename;
+};
+
 template <>
 query::Appointments::Response::appointments_AppointmentConnection::edges_AppointmentEdge Response<query::Appointments::Response::appointments_AppointmentConnection::edges_AppointmentEdge>::parse(response::Value&& response)
 {
@@ -225,10 +299,15 @@ query::Appointments::Response::appointments_AppointmentConnection::edges_Appoint
 
 		for (auto& member : members)
 		{
-			if (member.first == R"js(node)js"sv)
+			switch (member.first.size())
 			{
-				result.node = ModifiedResponse<query::Appointments::Response::appointments_AppointmentConnection::edges_AppointmentEdge::node_Appointment>::parse<TypeModifier::Nullable>(std::move(member.second));
-				continue;
+				case 4:
+					if (member.first == R"js(node)js"sv)
+					{
+						result.node = ModifiedResponse<query::Appointments::Response::appointments_AppointmentConnection::edges_AppointmentEdge::node_Appointment>::parse<TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					break;
 			}
 		}
 	}
@@ -236,6 +315,35 @@ query::Appointments::Response::appointments_AppointmentConnection::edges_Appoint
 	return result;
 }
 
+template <>
+class ResponseSink<query::Appointments::Response::appointments_AppointmentConnection::edges_AppointmentEdge>
+	: public ObjectSink<query::Appointments::Response::appointments_AppointmentConnection::edges_AppointmentEdge>
+{
+public:
+	ValueSink& add_member(std::string_view key) final
+	{
+		switch (key.size())
+		{
+			case 4:
+				if (key == R"js(node)js"sv)
+				{
+					return _node;
+				}
+				break;
+		}
+
+		return skip();
+	}
+
+private:
+	void bindMembers(query::Appointments::Response::appointments_AppointmentConnection::edges_AppointmentEdge& result) noexcept final
+	{
+		_node.bind(result.node);
+	}
+
+	ModifiedSink<query::Appointments::Response::appointments_AppointmentConnection::edges_AppointmentEdge::node_Appointment, TypeModifier::Nullable> _node;
+};
+
 template <>
 query::Appointments::Response::appointments_AppointmentConnection Response<query::Appointments::Response::appointments_AppointmentConnection>::parse(response::Value&& response)
 {
@@ -247,10 +355,15 @@ query::Appointments::Response::appointments_AppointmentConnection Response<query
 
 		for (auto& member : members)
 		{
-			if (member.first == R"js(edges)js"sv)
+			switch (member.first.size())
 			{
-				result.edges = ModifiedResponse<query::Appointments::Response::appointments_AppointmentConnection::edges_AppointmentEdge>::parse<TypeModifier::Nullable, TypeModifier::List, TypeModifier::Nullable>(std::move(member.second));
-				continue;
+				case 5:
+					if (member.first == R"js(edges)js"sv)
+					{
+						result.edges = ModifiedResponse<query::Appointments::Response::appointments_AppointmentConnection::edges_AppointmentEdge>::parse<TypeModifier::Nullable, TypeModifier::List, TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					break;
 			}
 		}
 	}
@@ -258,6 +371,64 @@ query::Appointments::Response::appointments_AppointmentConnection Response<query
 	return result;
 }
 
+template <>
+class ResponseSink<query::Appointments::Response::appointments_AppointmentConnection>
+	: public ObjectSink<query::Appointments::Response::appointments_AppointmentConnection>
+{
+public:
+	ValueSink& add_member(std::string_view key) final
+	{
+		switch (key.size())
+		{
+			case 5:
+				if (key == R"js(edges)js"sv)
+				{
+					return _edges;
+				}
+				break;
+		}
+
+		return skip();
+	}
+
+private:
+	void bindMembers(query::Appointments::Response::appointments_AppointmentConnection& result) noexcept final
+	{
+		_edges.bind(result.edges);
+	}
+
+	ModifiedSink<query::Appointments::Response::appointments_AppointmentConnection::edges_AppointmentEdge, TypeModifier::Nullable, TypeModifier::List, TypeModifier::Nullable> _edges;
+};
+
+template <>
+class ResponseSink<query::Appointments::Response>
+	: public ObjectSink<query::Appointments::Response>
+{
+public:
+	ValueSink& add_member(std::string_view key) final
+	{
+		switch (key.size())
+		{
+			case 12:
+				if (key == R"js(appointments)js"sv)
+				{
+					return _appointments;
+				}
+				break;
+		}
+
+		return skip();
+	}
+
+private:
+	void bindMembers(query::Appointments::Response& result) noexcept final
+	{
+		_appointments.bind(result.appointments);
+	}
+
+	ModifiedSink<query::Appointments::Response::appointments_AppointmentConnection> _appointments;
+};
+
 namespace query::Appointments {
 
 const std::string& GetOperationName() noexcept
@@ -277,10 +448,15 @@ Response parseResponse(response::Value&& response)
 
 		for (auto& member : members)
 		{
-			if (member.first == R"js(appointments)js"sv)
+			switch (member.first.size())
 			{
-				result.appointments = ModifiedResponse<query::Appointments::Response::appointments_AppointmentConnection>::parse(std::move(member.second));
-				continue;
+				case 12:
+					if (member.first == R"js(appointments)js"sv)
+					{
+						result.appointments = ModifiedResponse<query::Appointments::Response::appointments_AppointmentConnection>::parse(std::move(member.second));
+						continue;
+					}
+					break;
 			}
 		}
 	}
@@ -288,6 +464,15 @@ Response parseResponse(response::Value&& response)
 	return result;
 }
 
+std::unique_ptr<ValueSink> makeResponseSink(Response& response)
+{
+	auto result = std::make_unique<ResponseSink<Response>>();
+
+	result->bind(response);
+
+	return result;
+}
+
 } // namespace query::Appointments
 
 template <>
@@ -301,25 +486,34 @@ query::Tasks::Response::tasks_TaskConnection::edges_TaskEdge::node_Task Response
 
 		for (auto& member : members)
 		{
-			if (member.first == R"js(id)js"sv)
-			{
-				result.id = ModifiedResponse<response::IdType>::parse(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(title)js"sv)
-			{
-				result.title = ModifiedResponse<std::string>::parse<TypeModifier::Nullable>(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(isComplete)js"sv)
-			{
-				result.isComplete = ModifiedResponse<bool>::parse(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(__typename)js"sv)
+			switch (member.first.size())
 			{
-				result._typename = ModifiedResponse<std::string>::parse(std::move(member.second));
-				continue;
+				case 2:
+					if (member.first == R"js(id)js"sv)
+					{
+						result.id = ModifiedResponse<response::IdType>::parse(std::move(member.second));
+						continue;
+					}
+					break;
+				case 5:
+					if (member.first == R"js(title)js"sv)
+					{
+						result.title = ModifiedResponse<std::string>::parse<TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					break;
+				case 10:
+					if (member.first == R"js(isComplete)js"sv)
+					{
+						result.isComplete = ModifiedResponse<bool>::parse(std::move(member.second));
+						continue;
+					}
+					if (member.first == R"js(__typename)js"sv)
+					{
+						result._typename = ModifiedResponse<std::string>::parse(std::move(member.second));
+						continue;
+					}
+					break;
 			}
 		}
 	}
@@ -327,6 +521,57 @@ query::Tasks::Response::tasks_TaskConnection::edges_TaskEdge::node_Task Response
 	return result;
 }
 
+template <>
+class ResponseSink<query::Tasks::Response::tasks_TaskConnection::edges_TaskEdge::node_Task>
+	: public ObjectSink<query::Tasks::Response::tasks_TaskConnection::edges_TaskEdge::node_Task>
+{
+public:
+	ValueSink& add_member(std::string_view key) final
+	{
+		switch (key.size())
+		{
+			case 2:
+				if (key == R"js(id)js"sv)
+				{
+					return _id;
+				}
+				break;
+			case 5:
+				if (key == R"js(title)js"sv)
+				{
+					return _title;
+				}
+				break;
+			case 10:
+				if (key == R"js(isComplete)js"sv)
+				{
+					return _isComplete;
+				}
+				if (key == R"js(__typename)js"sv)
+				{
+					return __typename;
+				}
+				break;
+		}
+
+		return skip();
+	}
+
+private:
+	void bindMembers(query::Tasks::Response::tasks_TaskConnection::edges_TaskEdge::node_Task& result) noexcept final
+	{
+		_id.bind(result.id);
+		_title.bind(result.title);
+		_isComplete.bind(result.isComplete);
+		__typename.bind(result._typename);
+	}
+
+	ModifiedSink<response::IdType> _id;
+	ModifiedSink<std::string, TypeModifier::Nullable> _title;
+	ModifiedSink<bool> _isComplete;
+	ModifiedSink<std::string> __typename;
+};
+
 template <>
 query::Tasks::Response::tasks_TaskConnection::edges_TaskEdge Response<query::Tasks::Response::tasks_TaskConnection::edges_TaskEdge>::parse(response::Value&& response)
 {
@@ -338,10 +583,15 @@ query::Tasks::Response::tasks_TaskConnection::edges_TaskEdge Response<query::Tas
 
 		for (auto& member : members)
 		{
-			if (member.first == R"js(node)js"sv)
+			switch (member.first.size())
 			{
-				result.node = ModifiedResponse<query::Tasks::Response::tasks_TaskConnection::edges_TaskEdge::node_Task>::parse<TypeModifier::Nullable>(std::move(member.second));
-				continue;
+				case 4:
+					if (member.first == R"js(node)js"sv)
+					{
+						result.node = ModifiedResponse<query::Tasks::Response::tasks_TaskConnection::edges_TaskEdge::node_Task>::parse<TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					break;
 			}
 		}
 	}
@@ -349,6 +599,35 @@ query::Tasks::Response::tasks_TaskConnection::edges_TaskEdge Response<query::Tas
 	return result;
 }
 
+template <>
+class ResponseSink<query::Tasks::Response::tasks_TaskConnection::edges_TaskEdge>
+	: public ObjectSink<query::Tasks::Response::tasks_TaskConnection::edges_TaskEdge>
+{
+public:
+	ValueSink& add_member(std::string_view key) final
+	{
+		switch (key.size())
+		{
+			case 4:
+				if (key == R"js(node)js"sv)
+				{
+					return _node;
+				}
+				break;
+		}
+
+		return skip();
+	}
+
+private:
+	void bindMembers(query::Tasks::Response::tasks_TaskConnection::edges_TaskEdge& result) noexcept final
+	{
+		_node.bind(result.node);
+	}
+
+	ModifiedSink<query::Tasks::Response::tasks_TaskConnection::edges_TaskEdge::node_Task, TypeModifier::Nullable> _node;
+};
+
 template <>
 query::Tasks::Response::tasks_TaskConnection Response<query::Tasks::Response::tasks_TaskConnection>::parse(response::Value&& response)
 {
@@ -360,10 +639,15 @@ query::Tasks::Response::tasks_TaskConnection Response<query::Tasks::Response::ta
 
 		for (auto& member : members)
 		{
-			if (member.first == R"js(edges)js"sv)
+			switch (member.first.size())
 			{
-				result.edges = ModifiedResponse<query::Tasks::Response::tasks_TaskConnection::edges_TaskEdge>::parse<TypeModifier::Nullable, TypeModifier::List, TypeModifier::Nullable>(std::move(member.second));
-				continue;
+				case 5:
+					if (member.first == R"js(edges)js"sv)
+					{
+						result.edges = ModifiedResponse<query::Tasks::Response::tasks_TaskConnection::edges_TaskEdge>::parse<TypeModifier::Nullable, TypeModifier::List, TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					break;
 			}
 		}
 	}
@@ -371,6 +655,64 @@ query::Tasks::Response::tasks_TaskConnection Response<query::Tasks::Response::ta
 	return result;
 }
 
+template <>
+class ResponseSink<query::Tasks::Response::tasks_TaskConnection>
+	: public ObjectSink<query::Tasks::Response::tasks_TaskConnection>
+{
+public:
+	ValueSink& add_member(std::string_view key) final
+	{
+		switch (key.size())
+		{
+			case 5:
+				if (key == R"js(edges)js"sv)
+				{
+					return _edges;
+				}
+				break;
+		}
+
+		return skip();
+	}
+
+private:
+	void bindMembers(query::Tasks::Response::tasks_TaskConnection& result) noexcept final
+	{
+		_edges.bind(result.edges);
+	}
+
+	ModifiedSink<query::Tasks::Response::tasks_TaskConnection::edges_TaskEdge, TypeModifier::Nullable, TypeModifier::List, TypeModifier::Nullable> _edges;
+};
+
+template <>
+class ResponseSink<query::Tasks::Response>
+	: public ObjectSink<query::Tasks::Response>
+{
+public:
+	ValueSink& add_member(std::string_view key) final
+	{
+		switch (key.size())
+		{
+			case 5:
+				if (key == R"js(tasks)js"sv)
+				{
+					return _tasks;
+				}
+				break;
+		}
+
+		return skip();
+	}
+
+private:
+	void bindMembers(query::Tasks::Response& result) noexcept final
+	{
+		_tasks.bind(result.tasks);
+	}
+
+	ModifiedSink<query::Tasks::Response::tasks_TaskConnection> _tasks;
+};
+
 namespace query::Tasks {
 
 const std::string& GetOperationName() noexcept
@@ -390,10 +732,15 @@ Response parseResponse(response::Value&& response)
 
 		for (auto& member : members)
 		{
-			if (member.first == R"js(tasks)js"sv)
+			switch (member.first.size())
 			{
-				result.tasks = ModifiedResponse<query::Tasks::Response::tasks_TaskConnection>::parse(std::move(member.second));
-				continue;
+				case 5:
+					if (member.first == R"js(tasks)js"sv)
+					{
+						result.tasks = ModifiedResponse<query::Tasks::Response::tasks_TaskConnection>::parse(std::move(member.second));
+						continue;
+					}
+					break;
 			}
 		}
 	}
@@ -401,6 +748,15 @@ Response parseResponse(response::Value&& response)
 	return result;
 }
 
+std::unique_ptr<ValueSink> makeResponseSink(Response& response)
+{
+	auto result = std::make_unique<ResponseSink<Response>>();
+
+	result->bind(response);
+
+	return result;
+}
+
 } // namespace query::Tasks
 
 template <>
@@ -414,25 +770,36 @@ query::UnreadCounts::Response::unreadCounts_FolderConnection::edges_FolderEdge::
 
 		for (auto& member : members)
 		{
-			if (member.first == R"js(id)js"sv)
-			{
-				result.id = ModifiedResponse<response::IdType>::parse(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(name)js"sv)
-			{
-				result.name = ModifiedResponse<std::string>::parse<TypeModifier::Nullable>(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(unreadCount)js"sv)
+			switch (member.first.size())
 			{
-				result.unreadCount = ModifiedResponse<int>::parse(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(__typename)js"sv)
-			{
-				result._typename = ModifiedResponse<std::string>::parse(std::move(member.second));
-				continue;
+				case 2:
+					if (member.first == R"js(id)js"sv)
+					{
+						result.id = ModifiedResponse<response::IdType>::parse(std::move(member.second));
+						continue;
+					}
+					break;
+				case 4:
+					if (member.first == R"js(name)js"sv)
+					{
+						result.name = ModifiedResponse<std::string>::parse<TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					break;
+				case 10:
+					if (member.first == R"js(__typename)js"sv)
+					{
+						result._typename = ModifiedResponse<std::string>::parse(std::move(member.second));
+						continue;
+					}
+					break;
+				case 11:
+					if (member.first == R"js(unreadCount)js"sv)
+					{
+						result.unreadCount = ModifiedResponse<int>::parse(std::move(member.second));
+						continue;
+					}
+					break;
 			}
 		}
 	}
@@ -440,6 +807,59 @@ query::UnreadCounts::Response::unreadCounts_FolderConnection::edges_FolderEdge::
 	return result;
 }
 
+template <>
+class ResponseSink<query::UnreadCounts::Response::unreadCounts_FolderConnection::edges_FolderEdge::node_Folder>
+	: public ObjectSink<query::UnreadCounts::Response::unreadCounts_FolderConnection::edges_FolderEdge::node_Folder>
+{
+public:
+	ValueSink& add_member(std::string_view key) final
+	{
+		switch (key.size())
+		{
+			case 2:
+				if (key == R"js(id)js"sv)
+				{
+					return _id;
+				}
+				break;
+			case 4:
+				if (key == R"js(name)js"sv)
+				{
+					return _name;
+				}
+				break;
+			case 10:
+				if (key == R"js(__typename)js"sv)
+				{
+					return __typename;
+				}
+				break;
+			case 11:
+				if (key == R"js(unreadCount)js"sv)
+				{
+					return _unreadCount;
+				}
+				break;
+		}
+
+		return skip();
+	}
+
+private:
+	void bindMembers(query::UnreadCounts::Response::unreadCounts_FolderConnection::edges_FolderEdge::node_Folder& result) noexcept final
+	{
+		_id.bind(result.id);
+		_name.bind(result.name);
+		_unreadCount.bind(result.unreadCount);
+		__typename.bind(result._typename);
+	}
+
+	ModifiedSink<response::IdType> _id;
+	ModifiedSink<std::string, TypeModifier::Nullable> _name;
+	ModifiedSink<int> _unreadCount;
+	ModifiedSink<std::string> __typename;
+};
+
 template <>
 query::UnreadCounts::Response::unreadCounts_FolderConnection::edges_FolderEdge Response<query::UnreadCounts::Response::unreadCounts_FolderConnection::edges_FolderEdge>::parse(response::Value&& response)
 {
@@ -451,10 +871,15 @@ query::UnreadCounts::Response::unreadCounts_FolderConnection::edges_FolderEdge R
 
 		for (auto& member : members)
 		{
-			if (member.first == R"js(node)js"sv)
+			switch (member.first.size())
 			{
-				result.node = ModifiedResponse<query::UnreadCounts::Response::unreadCounts_FolderConnection::edges_FolderEdge::node_Folder>::parse<TypeModifier::Nullable>(std::move(member.second));
-				continue;
+				case 4:
+					if (member.first == R"js(node)js"sv)
+					{
+						result.node = ModifiedResponse<query::UnreadCounts::Response::unreadCounts_FolderConnection::edges_FolderEdge::node_Folder>::parse<TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					break;
 			}
 		}
 	}
@@ -462,6 +887,35 @@ query::UnreadCounts::Response::unreadCounts_FolderConnection::edges_FolderEdge R
 	return result;
 }
 
+template <>
+class ResponseSink<query::UnreadCounts::Response::unreadCounts_FolderConnection::edges_FolderEdge>
+	: public ObjectSink<query::UnreadCounts::Response::unreadCounts_FolderConnection::edges_FolderEdge>
+{
+public:
+	ValueSink& add_member(std::string_view key) final
+	{
+		switch (key.size())
+		{
+			case 4:
+				if (key == R"js(node)js"sv)
+				{
+					return _node;
+				}
+				break;
+		}
+
+		return skip();
+	}
+
+private:
+	void bindMembers(query::UnreadCounts::Response::unreadCounts_FolderConnection::edges_FolderEdge& result) noexcept final
+	{
+		_node.bind(result.node);
+	}
+
+	ModifiedSink<query::UnreadCounts::Response::unreadCounts_FolderConnection::edges_FolderEdge::node_Folder, TypeModifier::Nullable> _node;
+};
+
 template <>
 query::UnreadCounts::Response::unreadCounts_FolderConnection Response<query::UnreadCounts::Response::unreadCounts_FolderConnection>::parse(response::Value&& response)
 {
@@ -473,10 +927,15 @@ query::UnreadCounts::Response::unreadCounts_FolderConnection Response<query::Unr
 
 		for (auto& member : members)
 		{
-			if (member.first == R"js(edges)js"sv)
+			switch (member.first.size())
 			{
-				result.edges = ModifiedResponse<query::UnreadCounts::Response::unreadCounts_FolderConnection::edges_FolderEdge>::parse<TypeModifier::Nullable, TypeModifier::List, TypeModifier::Nullable>(std::move(member.second));
-				continue;
+				case 5:
+					if (member.first == R"js(edges)js"sv)
+					{
+						result.edges = ModifiedResponse<query::UnreadCounts::Response::unreadCounts_FolderConnection::edges_FolderEdge>::parse<TypeModifier::Nullable, TypeModifier::List, TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					break;
 			}
 		}
 	}
@@ -484,6 +943,64 @@ query::UnreadCounts::Response::unreadCounts_FolderConnection Response<query::Unr
 	return result;
 }
 
+template <>
+class ResponseSink<query::UnreadCounts::Response::unreadCounts_FolderConnection>
+	: public ObjectSink<query::UnreadCounts::Response::unreadCounts_FolderConnection>
+{
+public:
+	ValueSink& add_member(std::string_view key) final
+	{
+		switch (key.size())
+		{
+			case 5:
+				if (key == R"js(edges)js"sv)
+				{
+					return _edges;
+				}
+				break;
+		}
+
+		return skip();
+	}
+
+private:
+	void bindMembers(query::UnreadCounts::Response::unreadCounts_FolderConnection& result) noexcept final
+	{
+		_edges.bind(result.edges);
+	}
+
+	ModifiedSink<query::UnreadCounts::Response::unreadCounts_FolderConnection::edges_FolderEdge, TypeModifier::Nullable, TypeModifier::List, TypeModifier::Nullable> _edges;
+};
+
+template <>
+class ResponseSink<query::UnreadCounts::Response>
+	: public ObjectSink<query::UnreadCounts::Response>
+{
+public:
+	ValueSink& add_member(std::string_view key) final
+	{
+		switch (key.size())
+		{
+			case 12:
+				if (key == R"js(unreadCounts)js"sv)
+				{
+					return _unreadCounts;
+				}
+				break;
+		}
+
+		return skip();
+	}
+
+private:
+	void bindMembers(query::UnreadCounts::Response& result) noexcept final
+	{
+		_unreadCounts.bind(result.unreadCounts);
+	}
+
+	ModifiedSink<query::UnreadCounts::Response::unreadCounts_FolderConnection> _unreadCounts;
+};
+
 namespace query::UnreadCounts {
 
 const std::string& GetOperationName() noexcept
@@ -503,10 +1020,15 @@ Response parseResponse(response::Value&& response)
 
 		for (auto& member : members)
 		{
-			if (member.first == R"js(unreadCounts)js"sv)
+			switch (member.first.size())
 			{
-				result.unreadCounts = ModifiedResponse<query::UnreadCounts::Response::unreadCounts_FolderConnection>::parse(std::move(member.second));
-				continue;
+				case 12:
+					if (member.first == R"js(unreadCounts)js"sv)
+					{
+						result.unreadCounts = ModifiedResponse<query::UnreadCounts::Response::unreadCounts_FolderConnection>::parse(std::move(member.second));
+						continue;
+					}
+					break;
 			}
 		}
 	}
@@ -514,6 +1036,15 @@ Response parseResponse(response::Value&& response)
 	return result;
 }
 
+std::unique_ptr<ValueSink> makeResponseSink(Response& response)
+{
+	auto result = std::make_unique<ResponseSink<Response>>();
+
+	result->bind(response);
+
+	return result;
+}
+
 } // namespace query::UnreadCounts
 
 template <>
@@ -554,40 +1085,53 @@ query::Miscellaneous::Response::anyType_UnionType Response<query::Miscellaneous:
 
 		for (auto& member : members)
 		{
-			if (member.first == R"js(__typename)js"sv)
-			{
-				result._typename = ModifiedResponse<std::string>::parse(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(id)js"sv)
-			{
-				result.id = ModifiedResponse<response::IdType>::parse(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(title)js"sv)
-			{
-				result.title = ModifiedResponse<std::string>::parse<TypeModifier::Nullable>(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(isComplete)js"sv)
-			{
-				result.isComplete = ModifiedResponse<bool>::parse(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(subject)js"sv)
+			switch (member.first.size())
 			{
-				result.subject = ModifiedResponse<std::string>::parse<TypeModifier::Nullable>(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(when)js"sv)
-			{
-				result.when = ModifiedResponse<response::Value>::parse<TypeModifier::Nullable>(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(isNow)js"sv)
-			{
-				result.isNow = ModifiedResponse<bool>::parse(std::move(member.second));
-				continue;
+				case 2:
+					if (member.first == R"js(id)js"sv)
+					{
+						result.id = ModifiedResponse<response::IdType>::parse(std::move(member.second));
+						continue;
+					}
+					break;
+				case 4:
+					if (member.first == R"js(when)js"sv)
+					{
+						result.when = ModifiedResponse<response::Value>::parse<TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					break;
+				case 5:
+					if (member.first == R"js(title)js"sv)
+					{
+						result.title = ModifiedResponse<std::string>::parse<TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					if (member.first == R"js(isNow)js"sv)
+					{
+						result.isNow = ModifiedResponse<bool>::parse(std::move(member.second));
+						continue;
+					}
+					break;
+				case 7:
+					if (member.first == R"js(subject)js"sv)
+					{
+						result.subject = ModifiedResponse<std::string>::parse<TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					break;
+				case 10:
+					if (member.first == R"js(__typename)js"sv)
+					{
+						result._typename = ModifiedResponse<std::string>::parse(std::move(member.second));
+						continue;
+					}
+					if (member.first == R"js(isComplete)js"sv)
+					{
+						result.isComplete = ModifiedResponse<bool>::parse(std::move(member.second));
+						continue;
+					}
+					break;
 			}
 		}
 	}
@@ -595,6 +1139,122 @@ query::Miscellaneous::Response::anyType_UnionType Response<query::Miscellaneous:
 	return result;
 }
 
+template <>
+class ResponseSink<query::Miscellaneous::Response::anyType_UnionType>
+	: public ObjectSink<query::Miscellaneous::Response::anyType_UnionType>
+{
+public:
+	ValueSink& add_member(std::string_view key) final
+	{
+		switch (key.size())
+		{
+			case 2:
+				if (key == R"js(id)js"sv)
+				{
+					return _id;
+				}
+				break;
+			case 4:
+				if (key == R"js(when)js"sv)
+				{
+					return _when;
+				}
+				break;
+			case 5:
+				if (key == R"js(title)js"sv)
+				{
+					return _title;
+				}
+				if (key == R"js(isNow)js"sv)
+				{
+					return _isNow;
+				}
+				break;
+			case 7:
+				if (key == R"js(subject)js"sv)
+				{
+					return _subject;
+				}
+				break;
+			case 10:
+				if (key == R"js(__typename)js"sv)
+				{
+					return __typename;
+				}
+				if (key == R"js(isComplete)js"sv)
+				{
+					return _isComplete;
+				}
+				break;
+		}
+
+		return skip();
+	}
+
+private:
+	void bindMembers(query::Miscellaneous::Response::anyType_UnionType& result) noexcept final
+	{
+		__typename.bind(result._typename);
+		_id.bind(result.id);
+		_title.bind(result.title);
+		_isComplete.bind(result.isComplete);
+		_subject.bind(result.subject);
+		_when.bind(result.when);
+		_isNow.bind(result.isNow);
+	}
+
+	ModifiedSink<std::string> __typename;
+	ModifiedSink<response::IdType> _id;
+	ModifiedSink<std::string, TypeModifier::Nullable> _title;
+	ModifiedSink<bool> _isComplete;
+	ModifiedSink<std::string, TypeModifier::Nullable> _subject;
+	ModifiedSink<response::Value, TypeModifier::Nullable> _when;
+	ModifiedSink<bool> _isNow;
+};
+
+template <>
+class ResponseSink<query::Miscellaneous::Response>
+	: public ObjectSink<query::Miscellaneous::Response>
+{
+public:
+	ValueSink& add_member(std::string_view key) final
+	{
+		switch (key.size())
+		{
+			case 7:
+				if (key == R"js(anyType)js"sv)
+				{
+					return _anyType;
+				}
+				if (key == R"js(default)js"sv)
+				{
+					return _default_;
+				}
+				break;
+			case 13:
+				if (key == R"js(testTaskState)js"sv)
+				{
+					return _testTaskState;
+				}
+				break;
+		}
+
+		return skip();
+	}
+
+private:
+	void bindMembers(query::Miscellaneous::Response& result) noexcept final
+	{
+		_testTaskState.bind(result.testTaskState);
+		_anyType.bind(result.anyType);
+		_default_.bind(result.default_);
+	}
+
+	ModifiedSink<TaskState> _testTaskState;
+	ModifiedSink<query::Miscellaneous::Response::anyType_UnionType, TypeModifier::List, TypeModifier::Nullable> _anyType;
+	ModifiedSink<std::string, TypeModifier::Nullable> _default_;
+};
+
 namespace query::Miscellaneous {
 
 const std::string& GetOperationName() noexcept
@@ -614,20 +1274,27 @@ Response parseResponse(response::Value&& response)
 
 		for (auto& member : members)
 		{
-			if (member.first == R"js(testTaskState)js"sv)
+			switch (member.first.size())
 			{
-				result.testTaskState = ModifiedResponse<TaskState>::parse(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(anyType)js"sv)
-			{
-				result.anyType = ModifiedResponse<query::Miscellaneous::Response::anyType_UnionType>::parse<TypeModifier::List, TypeModifier::Nullable>(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(default)js"sv)
-			{
-				result.default_ = ModifiedResponse<std::string>::parse<TypeModifier::Nullable>(std::move(member.second));
-				continue;
+				case 7:
+					if (member.first == R"js(anyType)js"sv)
+					{
+						result.anyType = ModifiedResponse<query::Miscellaneous::Response::anyType_UnionType>::parse<TypeModifier::List, TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					if (member.first == R"js(default)js"sv)
+					{
+						result.default_ = ModifiedResponse<std::string>::parse<TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					break;
+				case 13:
+					if (member.first == R"js(testTaskState)js"sv)
+					{
+						result.testTaskState = ModifiedResponse<TaskState>::parse(std::move(member.second));
+						continue;
+					}
+					break;
 			}
 		}
 	}
@@ -635,6 +1302,15 @@ Response parseResponse(response::Value&& response)
 	return result;
 }
 
+std::unique_ptr<ValueSink> makeResponseSink(Response& response)
+{
+	auto result = std::make_unique<ResponseSink<Response>>();
+
+	result->bind(response);
+
+	return result;
+}
+
 } // namespace query::Miscellaneous
 
 template <>
@@ -678,20 +1354,29 @@ mutation::CompleteTaskMutation::Response::completedTask_CompleteTaskPayload::com
 
 		for (auto& member : members)
 		{
-			if (member.first == R"js(completedTaskId)js"sv)
-			{
-				result.completedTaskId = ModifiedResponse<response::IdType>::parse(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(title)js"sv)
+			switch (member.first.size())
 			{
-				result.title = ModifiedResponse<std::string>::parse<TypeModifier::Nullable>(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(isComplete)js"sv)
-			{
-				result.isComplete = ModifiedResponse<bool>::parse(std::move(member.second));
-				continue;
+				case 5:
+					if (member.first == R"js(title)js"sv)
+					{
+						result.title = ModifiedResponse<std::string>::parse<TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					break;
+				case 10:
+					if (member.first == R"js(isComplete)js"sv)
+					{
+						result.isComplete = ModifiedResponse<bool>::parse(std::move(member.second));
+						continue;
+					}
+					break;
+				case 15:
+					if (member.first == R"js(completedTaskId)js"sv)
+					{
+						result.completedTaskId = ModifiedResponse<response::IdType>::parse(std::move(member.second));
+						continue;
+					}
+					break;
 			}
 		}
 	}
@@ -699,6 +1384,51 @@ mutation::CompleteTaskMutation::Response::completedTask_CompleteTaskPayload::com
 	return result;
 }
 
+template <>
+class ResponseSink<mutation::CompleteTaskMutation::Response::completedTask_CompleteTaskPayload::completedTask_Task>
+	: public ObjectSink<mutation::CompleteTaskMutation::Response::completedTask_CompleteTaskPayload::completedTask_Task>
+{
+public:
+	ValueSink& add_member(std::string_view key) final
+	{
+		switch (key.size())
+		{
+			case 5:
+				if (key == R"js(title)js"sv)
+				{
+					return _title;
+				}
+				break;
+			case 10:
+				if (key == R"js(isComplete)js"sv)
+				{
+					return _isComplete;
+				}
+				break;
+			case 15:
+				if (key == R"js(completedTaskId)js"sv)
+				{
+					return _completedTaskId;
+				}
+				break;
+		}
+
+		return skip();
+	}
+
+private:
+	void bindMembers(mutation::CompleteTaskMutation::Response::completedTask_CompleteTaskPayload::completedTask_Task& result) noexcept final
+	{
+		_completedTaskId.bind(result.completedTaskId);
+		_title.bind(result.title);
+		_isComplete.bind(result.isComplete);
+	}
+
+	ModifiedSink<response::IdType> _completedTaskId;
+	ModifiedSink<std::string, TypeModifier::Nullable> _title;
+	ModifiedSink<bool> _isComplete;
+};
+
 template <>
 mutation::CompleteTaskMutation::Response::completedTask_CompleteTaskPayload Response<mutation::CompleteTaskMutation::Response::completedTask_CompleteTaskPayload>::parse(response::Value&& response)
 {
@@ -710,15 +1440,22 @@ mutation::CompleteTaskMutation::Response::completedTask_CompleteTaskPayload Resp
 
 		for (auto& member : members)
 		{
-			if (member.first == R"js(completedTask)js"sv)
+			switch (member.first.size())
 			{
-				result.completedTask = ModifiedResponse<mutation::CompleteTaskMutation::Response::completedTask_CompleteTaskPayload::completedTask_Task>::parse<TypeModifier::Nullable>(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(clientMutationId)js"sv)
-			{
-				result.clientMutationId = ModifiedResponse<std::string>::parse<TypeModifier::Nullable>(std::move(member.second));
-				continue;
+				case 13:
+					if (member.first == R"js(completedTask)js"sv)
+					{
+						result.completedTask = ModifiedResponse<mutation::CompleteTaskMutation::Response::completedTask_CompleteTaskPayload::completedTask_Task>::parse<TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					break;
+				case 16:
+					if (member.first == R"js(clientMutationId)js"sv)
+					{
+						result.clientMutationId = ModifiedResponse<std::string>::parse<TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					break;
 			}
 		}
 	}
@@ -726,6 +1463,72 @@ mutation::CompleteTaskMutation::Response::completedTask_CompleteTaskPayload Resp
 	return result;
 }
 
+template <>
+class ResponseSink<mutation::CompleteTaskMutation::Response::completedTask_CompleteTaskPayload>
+	: public ObjectSink<mutation::CompleteTaskMutation::Response::completedTask_CompleteTaskPayload>
+{
+public:
+	ValueSink& add_member(std::string_view key) final
+	{
+		switch (key.size())
+		{
+			case 13:
+				if (key == R"js(completedTask)js"sv)
+				{
+					return _completedTask;
+				}
+				break;
+			case 16:
+				if (key == R"js(clientMutationId)js"sv)
+				{
+					return _clientMutationId;
+				}
+				break;
+		}
+
+		return skip();
+	}
+
+private:
+	void bindMembers(mutation::CompleteTaskMutation::Response::completedTask_CompleteTaskPayload& result) noexcept final
+	{
+		_completedTask.bind(result.completedTask);
+		_clientMutationId.bind(result.clientMutationId);
+	}
+
+	ModifiedSink<mutation::CompleteTaskMutation::Response::completedTask_CompleteTaskPayload::completedTask_Task, TypeModifier::Nullable> _completedTask;
+	ModifiedSink<std::string, TypeModifier::Nullable> _clientMutationId;
+};
+
+template <>
+class ResponseSink<mutation::CompleteTaskMutation::Response>
+	: public ObjectSink<mutation::CompleteTaskMutation::Response>
+{
+public:
+	ValueSink& add_member(std::string_view key) final
+	{
+		switch (key.size())
+		{
+			case 13:
+				if (key == R"js(completedTask)js"sv)
+				{
+					return _completedTask;
+				}
+				break;
+		}
+
+		return skip();
+	}
+
+private:
+	void bindMembers(mutation::CompleteTaskMutation::Response& result) noexcept final
+	{
+		_completedTask.bind(result.completedTask);
+	}
+
+	ModifiedSink<mutation::CompleteTaskMutation::Response::completedTask_CompleteTaskPayload> _completedTask;
+};
+
 namespace mutation::CompleteTaskMutation {
 
 const std::string& GetOperationName() noexcept
@@ -755,10 +1558,15 @@ Response parseResponse(response::Value&& response)
 
 		for (auto& member : members)
 		{
-			if (member.first == R"js(completedTask)js"sv)
+			switch (member.first.size())
 			{
-				result.completedTask = ModifiedResponse<mutation::CompleteTaskMutation::Response::completedTask_CompleteTaskPayload>::parse(std::move(member.second));
-				continue;
+				case 13:
+					if (member.first == R"js(completedTask)js"sv)
+					{
+						result.completedTask = ModifiedResponse<mutation::CompleteTaskMutation::Response::completedTask_CompleteTaskPayload>::parse(std::move(member.second));
+						continue;
+					}
+					break;
 			}
 		}
 	}
@@ -766,5 +1574,14 @@ Response parseResponse(response::Value&& response)
 	return result;
 }
 
+std::unique_ptr<ValueSink> makeResponseSink(Response& response)
+{
+	auto result = std::make_unique<ResponseSink<Response>>();
+
+	result->bind(response);
+
+	return result;
+}
+
 } // namespace mutation::CompleteTaskMutation
 } // namespace graphql::client
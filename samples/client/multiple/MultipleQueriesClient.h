@@ -18,6 +18,7 @@
 static_assert(graphql::internal::MajorVersion == 4, "regenerate with clientgen: major version mismatch");
 static_assert(graphql::internal::MinorVersion == 5, "regenerate with clientgen: minor version mismatch");
 
+#include <memory>
 #include <optional>
 #include <string>
 #include <vector>
@@ -180,6 +181,9 @@ struct [[nodiscard]] Response
 
 [[nodiscard]] Response parseResponse(response::Value&& response);
 
+// Parse the data directly into a Response with a ResponseVisitor, instead of parseResponse.
+[[nodiscard]] std::unique_ptr<ValueSink> makeResponseSink(Response& response);
+
 } // namespace query::Appointments
 
 namespace query::Tasks {
@@ -215,6 +219,9 @@ struct [[nodiscard]] Response
 
 [[nodiscard]] Response parseResponse(response::Value&& response);
 
+// Parse the data directly into a Response with a ResponseVisitor, instead of parseResponse.
+[[nodiscard]] std::unique_ptr<ValueSink> makeResponseSink(Response& response);
+
 } // namespace query::Tasks
 
 namespace query::UnreadCounts {
@@ -250,6 +257,9 @@ struct [[nodiscard]] Response
 
 [[nodiscard]] Response parseResponse(response::Value&& response);
 
+// Parse the data directly into a Response with a ResponseVisitor, instead of parseResponse.
+[[nodiscard]] std::unique_ptr<ValueSink> makeResponseSink(Response& response);
+
 } // namespace query::UnreadCounts
 
 namespace query::Miscellaneous {
@@ -282,6 +292,9 @@ struct [[nodiscard]] Response
 
 [[nodiscard]] Response parseResponse(response::Value&& response);
 
+// Parse the data directly into a Response with a ResponseVisitor, instead of parseResponse.
+[[nodiscard]] std::unique_ptr<ValueSink> makeResponseSink(Response& response);
+
 } // namespace query::Miscellaneous
 
 namespace mutation::CompleteTaskMutation {
@@ -324,6 +337,9 @@ struct [[nodiscard]] Response
 
 [[nodiscard]] Response parseResponse(response::Value&& response);
 
+// Parse the data directly into a Response with a ResponseVisitor, instead of parseResponse.
+[[nodiscard]] std::unique_ptr<ValueSink> makeResponseSink(Response& response);
+
 } // namespace mutation::CompleteTaskMutation
 } // namespace graphql::client
 
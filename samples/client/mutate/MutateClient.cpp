@@ -173,20 +173,29 @@ mutation::CompleteTaskMutation::Response::completedTask_CompleteTaskPayload::com
 
 		for (auto& member : members)
 		{
-			if (member.first == R"js(completedTaskId)js"sv)
+			switch (member.first.size())
 			{
-				result.completedTaskId = ModifiedResponse<response::IdType>::parse(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(title)js"sv)
-			{
-				result.title = ModifiedResponse<std::string>::parse<TypeModifier::Nullable>(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(isComplete)js"sv)
-			{
-				result.isComplete = ModifiedResponse<bool>::parse(std::move(member.second));
-				continue;
+				case 5:
+					if (member.first == R"js(title)js"sv)
+					{
+						result.title = ModifiedResponse<std::string>::parse<TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					break;
+				case 10:
+					if (member.first == R"js(isComplete)js"sv)
+					{
+						result.isComplete = ModifiedResponse<bool>::parse(std::move(member.second));
+						continue;
+					}
+					break;
+				case 15:
+					if (member.first == R"js(completedTaskId)js"sv)
+					{
+						result.completedTaskId = ModifiedResponse<response::IdType>::parse(std::move(member.second));
+						continue;
+					}
+					break;
 			}
 		}
 	}
@@ -194,6 +203,51 @@ mutation::CompleteTaskMutation::Response::completedTask_CompleteTaskPayload::com
 	return result;
 }
 
+template <>
+class ResponseSink<mutation::CompleteTaskMutation::Response::completedTask_CompleteTaskPayload::completedTask_Task>
+	: public ObjectSink<mutation::CompleteTaskMutation::Response::completedTask_CompleteTaskPayload::completedTask_Task>
+{
+public:
+	ValueSink& add_member(std::string_view key) final
+	{
+		switch (key.size())
+		{
+			case 5:
+				if (key == R"js(title)js"sv)
+				{
+					return _title;
+				}
+				break;
+			case 10:
+				if (key == R"js(isComplete)js"sv)
+				{
+					return _isComplete;
+				}
+				break;
+			case 15:
+				if (key == R"js(completedTaskId)js"sv)
+				{
+					return _completedTaskId;
+				}
+				break;
+		}
+
+		return skip();
+	}
+
+private:
+	void bindMembers(mutation::CompleteTaskMutation::Response::completedTask_CompleteTaskPayload::completedTask_Task& result) noexcept final
+	{
+		_completedTaskId.bind(result.completedTaskId);
+		_title.bind(result.title);
+		_isComplete.bind(result.isComplete);
+	}
+
+	ModifiedSink<response::IdType> _completedTaskId;
+	ModifiedSink<std::string, TypeModifier::Nullable> _title;
+	ModifiedSink<bool> _isComplete;
+};
+
 template <>
 mutation::CompleteTaskMutation::Response::completedTask_CompleteTaskPayload Response<mutation::CompleteTaskMutation::Response::completedTask_CompleteTaskPayload>::parse(response::Value&& response)
 {
@@ -205,15 +259,22 @@ mutation::CompleteTaskMutation::Response::completedTask_CompleteTaskPayload Resp
 
 		for (auto& member : members)
 		{
-			if (member.first == R"js(completedTask)js"sv)
-			{
-				result.completedTask = ModifiedResponse<mutation::CompleteTaskMutation::Response::completedTask_CompleteTaskPayload::completedTask_Task>::parse<TypeModifier::Nullable>(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(clientMutationId)js"sv)
+			switch (member.first.size())
 			{
-				result.clientMutationId = ModifiedResponse<std::string>::parse<TypeModifier::Nullable>(std::move(member.second));
-				continue;
+				case 13:
+					if (member.first == R"js(completedTask)js"sv)
+					{
+						result.completedTask = ModifiedResponse<mutation::CompleteTaskMutation::Response::completedTask_CompleteTaskPayload::completedTask_Task>::parse<TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					break;
+				case 16:
+					if (member.first == R"js(clientMutationId)js"sv)
+					{
+						result.clientMutationId = ModifiedResponse<std::string>::parse<TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					break;
 			}
 		}
 	}
@@ -221,6 +282,72 @@ mutation::CompleteTaskMutation::Response::completedTask_CompleteTaskPayload Resp
 	return result;
 }
 
+template <>
+class ResponseSink<mutation::CompleteTaskMutation::Response::completedTask_CompleteTaskPayload>
+	: public ObjectSink<mutation::CompleteTaskMutation::Response::completedTask_CompleteTaskPayload>
+{
+public:
+	ValueSink& add_member(std::string_view key) final
+	{
+		switch (key.size())
+		{
+			case 13:
+				if (key == R"js(completedTask)js"sv)
+				{
+					return _completedTask;
+				}
+				break;
+			case 16:
+				if (key == R"js(clientMutationId)js"sv)
+				{
+					return _clientMutationId;
+				}
+				break;
+		}
+
+		return skip();
+	}
+
+private:
+	void bindMembers(mutation::CompleteTaskMutation::Response::completedTask_CompleteTaskPayload& result) noexcept final
+	{
+		_completedTask.bind(result.completedTask);
+		_clientMutationId.bind(result.clientMutationId);
+	}
+
+	ModifiedSink<mutation::CompleteTaskMutation::Response::completedTask_CompleteTaskPayload::completedTask_Task, TypeModifier::Nullable> _completedTask;
+	ModifiedSink<std::string, TypeModifier::Nullable> _clientMutationId;
+};
+
+template <>
+class ResponseSink<mutation::CompleteTaskMutation::Response>
+	: public ObjectSink<mutation::CompleteTaskMutation::Response>
+{
+public:
+	ValueSink& add_member(std::string_view key) final
+	{
+		switch (key.size())
+		{
+			case 13:
+				if (key == R"js(completedTask)js"sv)
+				{
+					return _completedTask;
+				}
+				break;
+		}
+
+		return skip();
+	}
+
+private:
+	void bindMembers(mutation::CompleteTaskMutation::Response& result) noexcept final
+	{
+		_completedTask.bind(result.completedTask);
+	}
+
+	ModifiedSink<mutation::CompleteTaskMutation::Response::completedTask_CompleteTaskPayload> _completedTask;
+};
+
 namespace mutation::CompleteTaskMutation {
 
 const std::string& GetOperationName() noexcept
@@ -250,10 +377,15 @@ Response parseResponse(response::Value&& response)
 
 		for (auto& member : members)
 		{
-			if (member.first == R"js(completedTask)js"sv)
+			switch (member.first.size())
 			{
-				result.completedTask = ModifiedResponse<mutation::CompleteTaskMutation::Response::completedTask_CompleteTaskPayload>::parse(std::move(member.second));
-				continue;
+				case 13:
+					if (member.first == R"js(completedTask)js"sv)
+					{
+						result.completedTask = ModifiedResponse<mutation::CompleteTaskMutation::Response::completedTask_CompleteTaskPayload>::parse(std::move(member.second));
+						continue;
+					}
+					break;
 			}
 		}
 	}
@@ -261,5 +393,14 @@ Response parseResponse(response::Value&& response)
 	return result;
 }
 
+std::unique_ptr<ValueSink> makeResponseSink(Response& response)
+{
+	auto result = std::make_unique<ResponseSink<Response>>();
+
+	result->bind(response);
+
+	return result;
+}
+
 } // namespace mutation::CompleteTaskMutation
 } // namespace graphql::client
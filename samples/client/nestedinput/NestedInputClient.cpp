@@ -255,10 +255,15 @@ query::testQuery::Response::control_Control::test_Output Response<query::testQue
 
 		for (auto& member : members)
 		{
-			if (member.first == R"js(id)js"sv)
+			switch (member.first.size())
 			{
-				result.id = ModifiedResponse<bool>::parse<TypeModifier::Nullable>(std::move(member.second));
-				continue;
+				case 2:
+					if (member.first == R"js(id)js"sv)
+					{
+						result.id = ModifiedResponse<bool>::parse<TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					break;
 			}
 		}
 	}
@@ -266,6 +271,35 @@ query::testQuery::Response::control_Control::test_Output Response<query::testQue
 	return result;
 }
 
+template <>
+class ResponseSink<query::testQuery::Response::control_Control::test_Output>
+	: public ObjectSink<query::testQuery::Response::control_Control::test_Output>
+{
+public:
+	ValueSink& add_member(std::string_view key) final
+	{
+		switch (key.size())
+		{
+			case 2:
+				if (key == R"js(id)js"sv)
+				{
+					return _id;
+				}
+				break;
+		}
+
+		return skip();
+	}
+
+private:
+	void bindMembers(query::testQuery::Response::control_Control::test_Output& result) noexcept final
+	{
+		_id.bind(result.id);
+	}
+
+	ModifiedSink<bool, TypeModifier::Nullable> _id;
+};
+
 template <>
 query::testQuery::Response::control_Control Response<query::testQuery::Response::control_Control>::parse(response::Value&& response)
 {
@@ -277,10 +311,15 @@ query::testQuery::Response::control_Control Response<query::testQuery::Response:
 
 		for (auto& member : members)
 		{
-			if (member.first == R"js(test)js"sv)
+			switch (member.first.size())
 			{
-				result.test = ModifiedResponse<query::testQuery::Response::control_Control::test_Output>::parse<TypeModifier::Nullable>(std::move(member.second));
-				continue;
+				case 4:
+					if (member.first == R"js(test)js"sv)
+					{
+						result.test = ModifiedResponse<query::testQuery::Response::control_Control::test_Output>::parse<TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					break;
 			}
 		}
 	}
@@ -288,6 +327,64 @@ query::testQuery::Response::control_Control Response<query::testQuery::Response:
 	return result;
 }
 
+template <>
+class ResponseSink<query::testQuery::Response::control_Control>
+	: public ObjectSink<query::testQuery::Response::control_Control>
+{
+public:
+	ValueSink& add_member(std::string_view key) final
+	{
+		switch (key.size())
+		{
+			case 4:
+				if (key == R"js(test)js"sv)
+				{
+					return _test;
+				}
+				break;
+		}
+
+		return skip();
+	}
+
+private:
+	void bindMembers(query::testQuery::Response::control_Control& result) noexcept final
+	{
+		_test.bind(result.test);
+	}
+
+	ModifiedSink<query::testQuery::Response::control_Control::test_Output, TypeModifier::Nullable> _test;
+};
+
+template <>
+class ResponseSink<query::testQuery::Response>
+	: public ObjectSink<query::testQuery::Response>
+{
+public:
+	ValueSink& add_member(std::string_view key) final
+	{
+		switch (key.size())
+		{
+			case 7:
+				if (key == R"js(control)js"sv)
+				{
+					return _control;
+				}
+				break;
+		}
+
+		return skip();
+	}
+
+private:
+	void bindMembers(query::testQuery::Response& result) noexcept final
+	{
+		_control.bind(result.control);
+	}
+
+	ModifiedSink<query::testQuery::Response::control_Control> _control;
+};
+
 namespace query::testQuery {
 
 const std::string& GetOperationName() noexcept
@@ -316,10 +413,15 @@ Response parseResponse(response::Value&& response)
 
 		for (auto& member : members)
 		{
-			if (member.first == R"js(control)js"sv)
+			switch (member.first.size())
 			{
-				result.control = ModifiedResponse<query::testQuery::Response::control_Control>::parse(std::move(member.second));
-				continue;
+				case 7:
+					if (member.first == R"js(control)js"sv)
+					{
+						result.control = ModifiedResponse<query::testQuery::Response::control_Control>::parse(std::move(member.second));
+						continue;
+					}
+					break;
 			}
 		}
 	}
@@ -327,5 +429,14 @@ Response parseResponse(response::Value&& response)
 	return result;
 }
 
+std::unique_ptr<ValueSink> makeResponseSink(Response& response)
+{
+	auto result = std::make_unique<ResponseSink<Response>>();
+
+	result->bind(response);
+
+	return result;
+}
+
 } // namespace query::testQuery
 } // namespace graphql::client
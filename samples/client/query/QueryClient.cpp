@@ -144,30 +144,43 @@ query::Query::Response::appointments_AppointmentConnection::edges_AppointmentEdg
 
 		for (auto& member : members)
 		{
-			if (member.first == R"js(id)js"sv)
+			switch (member.first.size())
 			{
-				result.id = ModifiedResponse<response::IdType>::parse(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(subject)js"sv)
-			{
-				result.subject = ModifiedResponse<std::string>::parse<TypeModifier::Nullable>(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(when)js"sv)
-			{
-				result.when = ModifiedResponse<response::Value>::parse<TypeModifier::Nullable>(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(isNow)js"sv)
-			{
-				result.isNow = ModifiedResponse<bool>::parse(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(__typename)js"sv)
-			{
-				result._typename = ModifiedResponse<std::string>::parse(std::move(member.second));
-				continue;
+				case 2:
+					if (member.first == R"js(id)js"sv)
+					{
+						result.id = ModifiedResponse<response::IdType>::parse(std::move(member.second));
+						continue;
+					}
+					break;
+				case 4:
+					if (member.first == R"js(when)js"sv)
+					{
+						result.when = ModifiedResponse<response::Value>::parse<TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					break;
+				case 5:
+					if (member.first == R"js(isNow)js"sv)
+					{
+						result.isNow = ModifiedResponse<bool>::parse(std::move(member.second));
+						continue;
+					}
+					break;
+				case 7:
+					if (member.first == R"js(subject)js"sv)
+					{
+						result.subject = ModifiedResponse<std::string>::parse<TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					break;
+				case 10:
+					if (member.first == R"js(__typename)js"sv)
+					{
+						result._typename = ModifiedResponse<std::string>::parse(std::move(member.second));
+						continue;
+					}
+					break;
 			}
 		}
 	}
@@ -175,6 +188,67 @@ query::Query::Response::appointments_AppointmentConnection::edges_AppointmentEdg
 	return result;
 }
 
+template <>
+class ResponseSink<query::Query::Response::appointments_AppointmentConnection::edges_AppointmentEdge::node_Appointment>
+	: public ObjectSink<query::Query::Response::appointments_AppointmentConnection::edges_AppointmentEdge::node_Appointment>
+{
+public:
+	ValueSink& add_member(std::string_view key) final
+	{
+		switch (key.size())
+		{
+			case 2:
+				if (key == R"js(id)js"sv)
+				{
+					return _id;
+				}
+				break;
+			case 4:
+				if (key == R"js(when)js"sv)
+				{
+					return _when;
+				}
+				break;
+			case 5:
+				if (key == R"js(isNow)js"sv)
+				{
+					return _isNow;
+				}
+				break;
+			case 7:
+				if (key == R"js(subject)js"sv)
+				{
+					return _subject;
+				}
+				break;
+			case 10:
+				if (key == R"js(__typename)js"sv)
+				{
+					return __typename;
+				}
+				break;
+		}
+
+		return skip();
+	}
+
+private:
+	void bindMembers(query::Query::Response::appointments_AppointmentConnection::edges_AppointmentEdge::node_Appointment& result) noexcept final
+	{
+		_id.bind(result.id);
+		_subject.bind(result.subject);
+		_when.bind(result.when);
+		_isNow.bind(result.isNow);
+		__typename.bind(result._typename);
+	}
+
+	ModifiedSink<response::IdType> _id;
+	ModifiedSink<std::string, TypeModifier::Nullable> _subject;
+	ModifiedSink<response::Value, TypeModifier::Nullable> _when;
+	ModifiedSink<bool> _isNow;
+	ModifiedSink<std::string> __typename;
+};
+
 template <>
 query::Query::Response::appointments_AppointmentConnection::edges_AppointmentEdge Response<query::Query::Response::appointments_AppointmentConnection::edges_AppointmentEdge>::parse(response::Value&& response)
 {
@@ -186,10 +260,15 @@ query::Query::Response::appointments_AppointmentConnection::edges_AppointmentEdg
 
 		for (auto& member : members)
 		{
-			if (member.first == R"js(node)js"sv)
+			switch (member.first.size())
 			{
-				result.node = ModifiedResponse<query::Query::Response::appointments_AppointmentConnection::edges_AppointmentEdge::node_Appointment>::parse<TypeModifier::Nullable>(std::move(member.second));
-				continue;
+				case 4:
+					if (member.first == R"js(node)js"sv)
+					{
+						result.node = ModifiedResponse<query::Query::Response::appointments_AppointmentConnection::edges_AppointmentEdge::node_Appointment>::parse<TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					break;
 			}
 		}
 	}
@@ -197,6 +276,35 @@ query::Query::Response::appointments_AppointmentConnection::edges_AppointmentEdg
 	return result;
 }
 
+template <>
+class ResponseSink<query::Query::Response::appointments_AppointmentConnection::edges_AppointmentEdge>
+	: public ObjectSink<query::Query::Response::appointments_AppointmentConnection::edges_AppointmentEdge>
+{
+public:
+	ValueSink& add_member(std::string_view key) final
+	{
+		switch (key.size())
+		{
+			case 4:
+				if (key == R"js(node)js"sv)
+				{
+					return _node;
+				}
+				break;
+		}
+
+		return skip();
+	}
+
+private:
+	void bindMembers(query::Query::Response::appointments_AppointmentConnection::edges_AppointmentEdge& result) noexcept final
+	{
+		_node.bind(result.node);
+	}
+
+	ModifiedSink<query::Query::Response::appointments_AppointmentConnection::edges_AppointmentEdge::node_Appointment, TypeModifier::Nullable> _node;
+};
+
 template <>
 query::Query::Response::appointments_AppointmentConnection Response<query::Query::Response::appointments_AppointmentConnection>::parse(response::Value&& response)
 {
@@ -208,10 +316,15 @@ query::Query::Response::appointments_AppointmentConnection Response<query::Query
 
 		for (auto& member : members)
 		{
-			if (member.first == R"js(edges)js"sv)
+			switch (member.first.size())
 			{
-				result.edges = ModifiedResponse<query::Query::Response::appointments_AppointmentConnection::edges_AppointmentEdge>::parse<TypeModifier::Nullable, TypeModifier::List, TypeModifier::Nullable>(std::move(member.second));
-				continue;
+				case 5:
+					if (member.first == R"js(edges)js"sv)
+					{
+						result.edges = ModifiedResponse<query::Query::Response::appointments_AppointmentConnection::edges_AppointmentEdge>::parse<TypeModifier::Nullable, TypeModifier::List, TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					break;
 			}
 		}
 	}
@@ -219,6 +332,35 @@ query::Query::Response::appointments_AppointmentConnection Response<query::Query
 	return result;
 }
 
+template <>
+class ResponseSink<query::Query::Response::appointments_AppointmentConnection>
+	: public ObjectSink<query::Query::Response::appointments_AppointmentConnection>
+{
+public:
+	ValueSink& add_member(std::string_view key) final
+	{
+		switch (key.size())
+		{
+			case 5:
+				if (key == R"js(edges)js"sv)
+				{
+					return _edges;
+				}
+				break;
+		}
+
+		return skip();
+	}
+
+private:
+	void bindMembers(query::Query::Response::appointments_AppointmentConnection& result) noexcept final
+	{
+		_edges.bind(result.edges);
+	}
+
+	ModifiedSink<query::Query::Response::appointments_AppointmentConnection::edges_AppointmentEdge, TypeModifier::Nullable, TypeModifier::List, TypeModifier::Nullable> _edges;
+};
+
 template <>
 query::Query::Response::tasks_TaskConnection::edges_TaskEdge::node_Task Response<query::Query::Response::tasks_TaskConnection::edges_TaskEdge::node_Task>::parse(response::Value&& response)
 {
@@ -230,25 +372,34 @@ query::Query::Response::tasks_TaskConnection::edges_TaskEdge::node_Task Response
 
 		for (auto& member : members)
 		{
-			if (member.first == R"js(id)js"sv)
-			{
-				result.id = ModifiedResponse<response::IdType>::parse(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(title)js"sv)
-			{
-				result.title = ModifiedResponse<std::string>::parse<TypeModifier::Nullable>(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(isComplete)js"sv)
+			switch (member.first.size())
 			{
-				result.isComplete = ModifiedResponse<bool>::parse(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(__typename)js"sv)
-			{
-				result._typename = ModifiedResponse<std::string>::parse(std::move(member.second));
-				continue;
+				case 2:
+					if (member.first == R"js(id)js"sv)
+					{
+						result.id = ModifiedResponse<response::IdType>::parse(std::move(member.second));
+						continue;
+					}
+					break;
+				case 5:
+					if (member.first == R"js(title)js"sv)
+					{
+						result.title = ModifiedResponse<std::string>::parse<TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					break;
+				case 10:
+					if (member.first == R"js(isComplete)js"sv)
+					{
+						result.isComplete = ModifiedResponse<bool>::parse(std::move(member.second));
+						continue;
+					}
+					if (member.first == R"js(__typename)js"sv)
+					{
+						result._typename = ModifiedResponse<std::string>::parse(std::move(member.second));
+						continue;
+					}
+					break;
 			}
 		}
 	}
@@ -256,6 +407,57 @@ query::Query::Response::tasks_TaskConnection::edges_TaskEdge::node_Task Response
 	return result;
 }
 
+template <>
+class ResponseSink<query::Query::Response::tasks_TaskConnection::edges_TaskEdge::node_Task>
+	: public ObjectSink<query::Query::Response::tasks_TaskConnection::edges_TaskEdge::node_Task>
+{
+public:
+	ValueSink& add_member(std::string_view key) final
+	{
+		switch (key.size())
+		{
+			case 2:
+				if (key == R"js(id)js"sv)
+				{
+					return _id;
+				}
+				break;
+			case 5:
+				if (key == R"js(title)js"sv)
+				{
+					return _title;
+				}
+				break;
+			case 10:
+				if (key == R"js(isComplete)js"sv)
+				{
+					return _isComplete;
+				}
+				if (key == R"js(__typename)js"sv)
+				{
+					return __typename;
+				}
+				break;
+		}
+
+		return skip();
+	}
+
+private:
+	void bindMembers(query::Query::Response::tasks_TaskConnection::edges_TaskEdge::node_Task& result) noexcept final
+	{
+		_id.bind(result.id);
+		_title.bind(result.title);
+		_isComplete.bind(result.isComplete);
+		__typename.bind(result._typename);
+	}
+
+	ModifiedSink<response::IdType> _id;
+	ModifiedSink<std::string, TypeModifier::Nullable> _title;
+	ModifiedSink<bool> _isComplete;
+	ModifiedSink<std::string> __typename;
+};
+
 template <>
 query::Query::Response::tasks_TaskConnection::edges_TaskEdge Response<query::Query::Response::tasks_TaskConnection::edges_TaskEdge>::parse(response::Value&& response)
 {
@@ -267,10 +469,15 @@ query::Query::Response::tasks_TaskConnection::edges_TaskEdge Response<query::Que
 
 		for (auto& member : members)
 		{
-			if (member.first == R"js(node)js"sv)
+			switch (member.first.size())
 			{
-				result.node = ModifiedResponse<query::Query::Response::tasks_TaskConnection::edges_TaskEdge::node_Task>::parse<TypeModifier::Nullable>(std::move(member.second));
-				continue;
+				case 4:
+					if (member.first == R"js(node)js"sv)
+					{
+						result.node = ModifiedResponse<query::Query::Response::tasks_TaskConnection::edges_TaskEdge::node_Task>::parse<TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					break;
 			}
 		}
 	}
@@ -278,6 +485,35 @@ query::Query::Response::tasks_TaskConnection::edges_TaskEdge Response<query::Que
 	return result;
 }
 
+template <>
+class ResponseSink<query::Query::Response::tasks_TaskConnection::edges_TaskEdge>
+	: public ObjectSink<query::Query::Response::tasks_TaskConnection::edges_TaskEdge>
+{
+public:
+	ValueSink& add_member(std::string_view key) final
+	{
+		switch (key.size())
+		{
+			case 4:
+				if (key == R"js(node)js"sv)
+				{
+					return _node;
+				}
+				break;
+		}
+
+		return skip();
+	}
+
+private:
+	void bindMembers(query::Query::Response::tasks_TaskConnection::edges_TaskEdge& result) noexcept final
+	{
+		_node.bind(result.node);
+	}
+
+	ModifiedSink<query::Query::Response::tasks_TaskConnection::edges_TaskEdge::node_Task, TypeModifier::Nullable> _node;
+};
+
 template <>
 query::Query::Response::tasks_TaskConnection Response<query::Query::Response::tasks_TaskConnection>::parse(response::Value&& response)
 {
@@ -289,10 +525,15 @@ query::Query::Response::tasks_TaskConnection Response<query::Query::Response::ta
 
 		for (auto& member : members)
 		{
-			if (member.first == R"js(edges)js"sv)
+			switch (member.first.size())
 			{
-				result.edges = ModifiedResponse<query::Query::Response::tasks_TaskConnection::edges_TaskEdge>::parse<TypeModifier::Nullable, TypeModifier::List, TypeModifier::Nullable>(std::move(member.second));
-				continue;
+				case 5:
+					if (member.first == R"js(edges)js"sv)
+					{
+						result.edges = ModifiedResponse<query::Query::Response::tasks_TaskConnection::edges_TaskEdge>::parse<TypeModifier::Nullable, TypeModifier::List, TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					break;
 			}
 		}
 	}
@@ -300,6 +541,35 @@ query::Query::Response::tasks_TaskConnection Response<query::Query::Response::ta
 	return result;
 }
 
+template <>
+class ResponseSink<query::Query::Response::tasks_TaskConnection>
+	: public ObjectSink<query::Query::Response::tasks_TaskConnection>
+{
+public:
+	ValueSink& add_member(std::string_view key) final
+	{
+		switch (key.size())
+		{
+			case 5:
+				if (key == R"js(edges)js"sv)
+				{
+					return _edges;
+				}
+				break;
+		}
+
+		return skip();
+	}
+
+private:
+	void bindMembers(query::Query::Response::tasks_TaskConnection& result) noexcept final
+	{
+		_edges.bind(result.edges);
+	}
+
+	ModifiedSink<query::Query::Response::tasks_TaskConnection::edges_TaskEdge, TypeModifier::Nullable, TypeModifier::List, TypeModifier::Nullable> _edges;
+};
+
 template <>
 query::Query::Response::unreadCounts_FolderConnection::edges_FolderEdge::node_Folder Response<query::Query::Response::unreadCounts_FolderConnection::edges_FolderEdge::node_Folder>::parse(response::Value&& response)
 {
@@ -311,25 +581,36 @@ query::Query::Response::unreadCounts_FolderConnection::edges_FolderEdge::node_Fo
 
 		for (auto& member : members)
 		{
-			if (member.first == R"js(id)js"sv)
-			{
-				result.id = ModifiedResponse<response::IdType>::parse(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(name)js"sv)
-			{
-				result.name = ModifiedResponse<std::string>::parse<TypeModifier::Nullable>(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(unreadCount)js"sv)
+			switch (member.first.size())
 			{
-				result.unreadCount = ModifiedResponse<int>::parse(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(__typename)js"sv)
-			{
-				result._typename = ModifiedResponse<std::string>::parse(std::move(member.second));
-				continue;
+				case 2:
+					if (member.first == R"js(id)js"sv)
+					{
+						result.id = ModifiedResponse<response::IdType>::parse(std::move(member.second));
+						continue;
+					}
+					break;
+				case 4:
+					if (member.first == R"js(name)js"sv)
+					{
+						result.name = ModifiedResponse<std::string>::parse<TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					break;
+				case 10:
+					if (member.first == R"js(__typename)js"sv)
+					{
+						result._typename = ModifiedResponse<std::string>::parse(std::move(member.second));
+						continue;
+					}
+					break;
+				case 11:
+					if (member.first == R"js(unreadCount)js"sv)
+					{
+						result.unreadCount = ModifiedResponse<int>::parse(std::move(member.second));
+						continue;
+					}
+					break;
 			}
 		}
 	}
@@ -337,6 +618,59 @@ query::Query::Response::unreadCounts_FolderConnection::edges_FolderEdge::node_Fo
 	return result;
 }
 
+template <>
+class ResponseSink<query::Query::Response::unreadCounts_FolderConnection::edges_FolderEdge::node_Folder>
+	: public ObjectSink<query::Query::Response::unreadCounts_FolderConnection::edges_FolderEdge::node_Folder>
+{
+public:
+	ValueSink& add_member(std::string_view key) final
+	{
+		switch (key.size())
+		{
+			case 2:
+				if (key == R"js(id)js"sv)
+				{
+					return _id;
+				}
+				break;
+			case 4:
+				if (key == R"js(name)js"sv)
+				{
+					return _name;
+				}
+				break;
+			case 10:
+				if (key == R"js(__typename)js"sv)
+				{
+					return __typename;
+				}
+				break;
+			case 11:
+				if (key == R"js(unreadCount)js"sv)
+				{
+					return _unreadCount;
+				}
+				break;
+		}
+
+		return skip();
+	}
+
+private:
+	void bindMembers(query::Query::Response::unreadCounts_FolderConnection::edges_FolderEdge::node_Folder& result) noexcept final
+	{
+		_id.bind(result.id);
+		_name.bind(result.name);
+		_unreadCount.bind(result.unreadCount);
+		__typename.bind(result._typename);
+	}
+
+	ModifiedSink<response::IdType> _id;
+	ModifiedSink<std::string, TypeModifier::Nullable> _name;
+	ModifiedSink<int> _unreadCount;
+	ModifiedSink<std::string> __typename;
+};
+
 template <>
 query::Query::Response::unreadCounts_FolderConnection::edges_FolderEdge Response<query::Query::Response::unreadCounts_FolderConnection::edges_FolderEdge>::parse(response::Value&& response)
 {
@@ -348,10 +682,15 @@ query::Query::Response::unreadCounts_FolderConnection::edges_FolderEdge Response
 
 		for (auto& member : members)
 		{
-			if (member.first == R"js(node)js"sv)
+			switch (member.first.size())
 			{
-				result.node = ModifiedResponse<query::Query::Response::unreadCounts_FolderConnection::edges_FolderEdge::node_Folder>::parse<TypeModifier::Nullable>(std::move(member.second));
-				continue;
+				case 4:
+					if (member.first == R"js(node)js"sv)
+					{
+						result.node = ModifiedResponse<query::Query::Response::unreadCounts_FolderConnection::edges_FolderEdge::node_Folder>::parse<TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					break;
 			}
 		}
 	}
@@ -359,6 +698,35 @@ query::Query::Response::unreadCounts_FolderConnection::edges_FolderEdge Response
 	return result;
 }
 
+template <>
+class ResponseSink<query::Query::Response::unreadCounts_FolderConnection::edges_FolderEdge>
+	: public ObjectSink<query::Query::Response::unreadCounts_FolderConnection::edges_FolderEdge>
+{
+public:
+	ValueSink& add_member(std::string_view key) final
+	{
+		switch (key.size())
+		{
+			case 4:
+				if (key == R"js(node)js"sv)
+				{
+					return _node;
+				}
+				break;
+		}
+
+		return skip();
+	}
+
+private:
+	void bindMembers(query::Query::Response::unreadCounts_FolderConnection::edges_FolderEdge& result) noexcept final
+	{
+		_node.bind(result.node);
+	}
+
+	ModifiedSink<query::Query::Response::unreadCounts_FolderConnection::edges_FolderEdge::node_Folder, TypeModifier::Nullable> _node;
+};
+
 template <>
 query::Query::Response::unreadCounts_FolderConnection Response<query::Query::Response::unreadCounts_FolderConnection>::parse(response::Value&& response)
 {
@@ -370,10 +738,15 @@ query::Query::Response::unreadCounts_FolderConnection Response<query::Query::Res
 
 		for (auto& member : members)
 		{
-			if (member.first == R"js(edges)js"sv)
+			switch (member.first.size())
 			{
-				result.edges = ModifiedResponse<query::Query::Response::unreadCounts_FolderConnection::edges_FolderEdge>::parse<TypeModifier::Nullable, TypeModifier::List, TypeModifier::Nullable>(std::move(member.second));
-				continue;
+				case 5:
+					if (member.first == R"js(edges)js"sv)
+					{
+						result.edges = ModifiedResponse<query::Query::Response::unreadCounts_FolderConnection::edges_FolderEdge>::parse<TypeModifier::Nullable, TypeModifier::List, TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					break;
 			}
 		}
 	}
@@ -381,6 +754,35 @@ query::Query::Response::unreadCounts_FolderConnection Response<query::Query::Res
 	return result;
 }
 
+template <>
+class ResponseSink<query::Query::Response::unreadCounts_FolderConnection>
+	: public ObjectSink<query::Query::Response::unreadCounts_FolderConnection>
+{
+public:
+	ValueSink& add_member(std::string_view key) final
+	{
+		switch (key.size())
+		{
+			case 5:
+				if (key == R"js(edges)js"sv)
+				{
+					return _edges;
+				}
+				break;
+		}
+
+		return skip();
+	}
+
+private:
+	void bindMembers(query::Query::Response::unreadCounts_FolderConnection& result) noexcept final
+	{
+		_edges.bind(result.edges);
+	}
+
+	ModifiedSink<query::Query::Response::unreadCounts_FolderConnection::edges_FolderEdge, TypeModifier::Nullable, TypeModifier::List, TypeModifier::Nullable> _edges;
+};
+
 template <>
 query::Query::Response::anyType_UnionType Response<query::Query::Response::anyType_UnionType>::parse(response::Value&& response)
 {
@@ -392,40 +794,53 @@ query::Query::Response::anyType_UnionType Response<query::Query::Response::anyTy
 
 		for (auto& member : members)
 		{
-			if (member.first == R"js(__typename)js"sv)
-			{
-				result._typename = ModifiedResponse<std::string>::parse(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(id)js"sv)
-			{
-				result.id = ModifiedResponse<response::IdType>::parse(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(title)js"sv)
-			{
-				result.title = ModifiedResponse<std::string>::parse<TypeModifier::Nullable>(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(isComplete)js"sv)
-			{
-				result.isComplete = ModifiedResponse<bool>::parse(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(subject)js"sv)
-			{
-				result.subject = ModifiedResponse<std::string>::parse<TypeModifier::Nullable>(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(when)js"sv)
+			switch (member.first.size())
 			{
-				result.when = ModifiedResponse<response::Value>::parse<TypeModifier::Nullable>(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(isNow)js"sv)
-			{
-				result.isNow = ModifiedResponse<bool>::parse(std::move(member.second));
-				continue;
+				case 2:
+					if (member.first == R"js(id)js"sv)
+					{
+						result.id = ModifiedResponse<response::IdType>::parse(std::move(member.second));
+						continue;
+					}
+					break;
+				case 4:
+					if (member.first == R"js(when)js"sv)
+					{
+						result.when = ModifiedResponse<response::Value>::parse<TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					break;
+				case 5:
+					if (member.first == R"js(title)js"sv)
+					{
+						result.title = ModifiedResponse<std::string>::parse<TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					if (member.first == R"js(isNow)js"sv)
+					{
+						result.isNow = ModifiedResponse<bool>::parse(std::move(member.second));
+						continue;
+					}
+					break;
+				case 7:
+					if (member.first == R"js(subject)js"sv)
+					{
+						result.subject = ModifiedResponse<std::string>::parse<TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					break;
+				case 10:
+					if (member.first == R"js(__typename)js"sv)
+					{
+						result._typename = ModifiedResponse<std::string>::parse(std::move(member.second));
+						continue;
+					}
+					if (member.first == R"js(isComplete)js"sv)
+					{
+						result.isComplete = ModifiedResponse<bool>::parse(std::move(member.second));
+						continue;
+					}
+					break;
 			}
 		}
 	}
@@ -433,6 +848,144 @@ query::Query::Response::anyType_UnionType Response<query::Query::Response::anyTy
 	return result;
 }
 
+template <>
+class ResponseSink<query::Query::Response::anyType_UnionType>
+	: public ObjectSink<query::Query::Response::anyType_UnionType>
+{
+public:
+	ValueSink& add_member(std::string_view key) final
+	{
+		switch (key.size())
+		{
+			case 2:
+				if (key == R"js(id)js"sv)
+				{
+					return _id;
+				}
+				break;
+			case 4:
+				if (key == R"js(when)js"sv)
+				{
+					return _when;
+				}
+				break;
+			case 5:
+				if (key == R"js(title)js"sv)
+				{
+					return _title;
+				}
+				if (key == R"js(isNow)js"sv)
+				{
+					return _isNow;
+				}
+				break;
+			case 7:
+				if (key == R"js(subject)js"sv)
+				{
+					return _subject;
+				}
+				break;
+			case 10:
+				if (key == R"js(__typename)js"sv)
+				{
+					return __typename;
+				}
+				if (key == R"js(isComplete)js"sv)
+				{
+					return _isComplete;
+				}
+				break;
+		}
+
+		return skip();
+	}
+
+private:
+	void bindMembers(query::Query::Response::anyType_UnionType& result) noexcept final
+	{
+		__typename.bind(result._typename);
+		_id.bind(result.id);
+		_title.bind(result.title);
+		_isComplete.bind(result.isComplete);
+		_subject.bind(result.subject);
+		_when.bind(result.when);
+		_isNow.bind(result.isNow);
+	}
+
+	ModifiedSink<std::string> __typename;
+	ModifiedSink<response::IdType> _id;
+	ModifiedSink<std::string, TypeModifier::Nullable> _title;
+	ModifiedSink<bool> _isComplete;
+	ModifiedSink<std::string, TypeModifier::Nullable> _subject;
+	ModifiedSink<response::Value, TypeModifier::Nullable> _when;
+	ModifiedSink<bool> _isNow;
+};
+
+template <>
+class ResponseSink<query::Query::Response>
+	: public ObjectSink<query::Query::Response>
+{
+public:
+	ValueSink& add_member(std::string_view key) final
+	{
+		switch (key.size())
+		{
+			case 5:
+				if (key == R"js(tasks)js"sv)
+				{
+					return _tasks;
+				}
+				break;
+			case 7:
+				if (key == R"js(anyType)js"sv)
+				{
+					return _anyType;
+				}
+				if (key == R"js(default)js"sv)
+				{
+					return _default_;
+				}
+				break;
+			case 12:
+				if (key == R"js(appointments)js"sv)
+				{
+					return _appointments;
+				}
+				if (key == R"js(unreadCounts)js"sv)
+				{
+					return _unreadCounts;
+				}
+				break;
+			case 13:
+				if (key == R"js(testTaskState)js"sv)
+				{
+					return _testTaskState;
+				}
+				break;
+		}
+
+		return skip();
+	}
+
+private:
+	void bindMembers(query::Query::Response& result) noexcept final
+	{
+		_appointments.bind(result.appointments);
+		_tasks.bind(result.tasks);
+		_unreadCounts.bind(result.unreadCounts);
+		_testTaskState.bind(result.testTaskState);
+		_anyType.bind(result.anyType);
+		_default_.bind(result.default_);
+	}
+
+	ModifiedSink<query::Query::Response::appointments_AppointmentConnection> _appointments;
+	ModifiedSink<query::Query::Response::tasks_TaskConnection> _tasks;
+	ModifiedSink<query::Query::Response::unreadCounts_FolderConnection> _unreadCounts;
+	ModifiedSink<TaskState> _testTaskState;
+	ModifiedSink<query::Query::Response::anyType_UnionType, TypeModifier::List, TypeModifier::Nullable> _anyType;
+	ModifiedSink<std::string, TypeModifier::Nullable> _default_;
+};
+
 namespace query::Query {
 
 const std::string& GetOperationName() noexcept
@@ -452,35 +1005,46 @@ Response parseResponse(response::Value&& response)
 
 		for (auto& member : members)
 		{
-			if (member.first == R"js(appointments)js"sv)
-			{
-				result.appointments = ModifiedResponse<query::Query::Response::appointments_AppointmentConnection>::parse(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(tasks)js"sv)
-			{
-				result.tasks = ModifiedResponse<query::Query::Response::tasks_TaskConnection>::parse(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(unreadCounts)js"sv)
-			{
-				result.unreadCounts = ModifiedResponse<query::Query::Response::unreadCounts_FolderConnection>::parse(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(testTaskState)js"sv)
-			{
-				result.testTaskState = ModifiedResponse<TaskState>::parse(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(anyType)js"sv)
+			switch (member.first.size())
 			{
-				result.anyType = ModifiedResponse<query::Query::Response::anyType_UnionType>::parse<TypeModifier::List, TypeModifier::Nullable>(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(default)js"sv)
-			{
-				result.default_ = ModifiedResponse<std::string>::parse<TypeModifier::Nullable>(std::move(member.second));
-				continue;
+				case 5:
+					if (member.first == R"js(tasks)js"sv)
+					{
+						result.tasks = ModifiedResponse<query::Query::Response::tasks_TaskConnection>::parse(std::move(member.second));
+						continue;
+					}
+					break;
+				case 7:
+					if (member.first == R"js(anyType)js"sv)
+					{
+						result.anyType = ModifiedResponse<query::Query::Response::anyType_UnionType>::parse<TypeModifier::List, TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					if (member.first == R"js(default)js"sv)
+					{
+						result.default_ = ModifiedResponse<std::string>::parse<TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					break;
+				case 12:
+					if (member.first == R"js(appointments)js"sv)
+					{
+						result.appointments = ModifiedResponse<query::Query::Response::appointments_AppointmentConnection>::parse(std::move(member.second));
+						continue;
+					}
+					if (member.first == R"js(unreadCounts)js"sv)
+					{
+						result.unreadCounts = ModifiedResponse<query::Query::Response::unreadCounts_FolderConnection>::parse(std::move(member.second));
+						continue;
+					}
+					break;
+				case 13:
+					if (member.first == R"js(testTaskState)js"sv)
+					{
+						result.testTaskState = ModifiedResponse<TaskState>::parse(std::move(member.second));
+						continue;
+					}
+					break;
 			}
 		}
 	}
@@ -488,5 +1052,14 @@ Response parseResponse(response::Value&& response)
 	return result;
 }
 
+std::unique_ptr<ValueSink> makeResponseSink(Response& response)
+{
+	auto result = std::make_unique<ResponseSink<Response>>();
+
+	result->bind(response);
+
+	return result;
+}
+
 } // namespace query::Query
 } // namespace graphql::client
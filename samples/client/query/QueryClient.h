@@ -18,6 +18,7 @@
 static_assert(graphql::internal::MajorVersion == 4, "regenerate with clientgen: major version mismatch");
 static_assert(graphql::internal::MinorVersion == 5, "regenerate with clientgen: minor version mismatch");
 
+#include <memory>
 #include <optional>
 #include <string>
 #include <vector>
@@ -196,6 +197,9 @@ struct [[nodiscard]] Response
 
 [[nodiscard]] Response parseResponse(response::Value&& response);
 
+// Parse the data directly into a Response with a ResponseVisitor, instead of parseResponse.
+[[nodiscard]] std::unique_ptr<ValueSink> makeResponseSink(Response& response);
+
 } // namespace query::Query
 } // namespace graphql::client
 
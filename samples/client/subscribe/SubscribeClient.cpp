@@ -67,25 +67,36 @@ subscription::TestSubscription::Response::nextAppointment_Appointment Response<s
 
 		for (auto& member : members)
 		{
-			if (member.first == R"js(nextAppointmentId)js"sv)
+			switch (member.first.size())
 			{
-				result.nextAppointmentId = ModifiedResponse<response::IdType>::parse(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(when)js"sv)
-			{
-				result.when = ModifiedResponse<response::Value>::parse<TypeModifier::Nullable>(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(subject)js"sv)
-			{
-				result.subject = ModifiedResponse<std::string>::parse<TypeModifier::Nullable>(std::move(member.second));
-				continue;
-			}
-			if (member.first == R"js(isNow)js"sv)
-			{
-				result.isNow = ModifiedResponse<bool>::parse(std::move(member.second));
-				continue;
+				case 4:
+					if (member.first == R"js(when)js"sv)
+					{
+						result.when = ModifiedResponse<response::Value>::parse<TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					break;
+				case 5:
+					if (member.first == R"js(isNow)js"sv)
+					{
+						result.isNow = ModifiedResponse<bool>::parse(std::move(member.second));
+						continue;
+					}
+					break;
+				case 7:
+					if (member.first == R"js(subject)js"sv)
+					{
+						result.subject = ModifiedResponse<std::string>::parse<TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					break;
+				case 17:
+					if (member.first == R"js(nextAppointmentId)js"sv)
+					{
+						result.nextAppointmentId = ModifiedResponse<response::IdType>::parse(std::move(member.second));
+						continue;
+					}
+					break;
 			}
 		}
 	}
@@ -93,6 +104,88 @@ subscription::TestSubscription::Response::nextAppointment_Appointment Response<s
 	return result;
 }
 
+template <>
+class ResponseSink<subscription::TestSubscription::Response::nextAppointment_Appointment>
+	: public ObjectSink<subscription::TestSubscription::Response::nextAppointment_Appointment>
+{
+public:
+	ValueSink& add_member(std::string_view key) final
+	{
+		switch (key.size())
+		{
+			case 4:
+				if (key == R"js(when)js"sv)
+				{
+					return _when;
+				}
+				break;
+			case 5:
+				if (key == R"js(isNow)js"sv)
+				{
+					return _isNow;
+				}
+				break;
+			case 7:
+				if (key == R"js(subject)js"sv)
+				{
+					return _subject;
+				}
+				break;
+			case 17:
+				if (key == R"js(nextAppointmentId)js"sv)
+				{
+					return _nextAppointmentId;
+				}
+				break;
+		}
+
+		return skip();
+	}
+
+private:
+	void bindMembers(subscription::TestSubscription::Response::nextAppointment_Appointment& result) noexcept final
+	{
+		_nextAppointmentId.bind(result.nextAppointmentId);
+		_when.bind(result.when);
+		_subject.bind(result.subject);
+		_isNow.bind(result.isNow);
+	}
+
+	ModifiedSink<response::IdType> _nextAppointmentId;
+	ModifiedSink<response::Value, TypeModifier::Nullable> _when;
+	ModifiedSink<std::string, TypeModifier::Nullable> _subject;
+	ModifiedSink<bool> _isNow;
+};
+
+template <>
+class ResponseSink<subscription::TestSubscription::Response>
+	: public ObjectSink<subscription::TestSubscription::Response>
+{
+public:
+	ValueSink& add_member(std::string_view key) final
+	{
+		switch (key.size())
+		{
+			case 15:
+				if (key == R"js(nextAppointment)js"sv)
+				{
+					return _nextAppointment;
+				}
+				break;
+		}
+
+		return skip();
+	}
+
+private:
+	void bindMembers(subscription::TestSubscription::Response& result) noexcept final
+	{
+		_nextAppointment.bind(result.nextAppointment);
+	}
+
+	ModifiedSink<subscription::TestSubscription::Response::nextAppointment_Appointment, TypeModifier::Nullable> _nextAppointment;
+};
+
 namespace subscription::TestSubscription {
 
 const std::string& GetOperationName() noexcept
@@ -112,10 +205,15 @@ Response parseResponse(response::Value&& response)
 
 		for (auto& member : members)
 		{
-			if (member.first == R"js(nextAppointment)js"sv)
+			switch (member.first.size())
 			{
-				result.nextAppointment = ModifiedResponse<subscription::TestSubscription::Response::nextAppointment_Appointment>::parse<TypeModifier::Nullable>(std::move(member.second));
-				continue;
+				case 15:
+					if (member.first == R"js(nextAppointment)js"sv)
+					{
+						result.nextAppointment = ModifiedResponse<subscription::TestSubscription::Response::nextAppointment_Appointment>::parse<TypeModifier::Nullable>(std::move(member.second));
+						continue;
+					}
+					break;
 			}
 		}
 	}
@@ -123,5 +221,14 @@ Response parseResponse(response::Value&& response)
 	return result;
 }
 
+std::unique_ptr<ValueSink> makeResponseSink(Response& response)
+{
+	auto result = std::make_unique<ResponseSink<Response>>();
+
+	result->bind(response);
+
+	return result;
+}
+
 } // namespace subscription::TestSubscription
 } // namespace graphql::client
@@ -54,8 +54,8 @@ void Mutation::endSelectionSet(const service::SelectionSetParams& params) const
 
 service::AwaitableResolver Mutation::resolveCreateReview(service::ResolverParams&& params) const
 {
-	auto argEp = service::ModifiedArgument<learn::Episode>::require("ep", params.arguments);
-	auto argReview = service::ModifiedArgument<learn::ReviewInput>::require("review", params.arguments);
+	auto argEp = service::ModifiedArgument<learn::Episode>::require("ep", params);
+	auto argReview = service::ModifiedArgument<learn::ReviewInput>::require("review", params);
 	std::unique_lock resolverLock(_resolverMutex);
 	auto directives = std::move(params.fieldDirectives);
 	auto result = _pimpl->applyCreateReview(service::FieldParams(service::SelectionSetParams{ params }, std::move(directives)), std::move(argEp), std::move(argReview));
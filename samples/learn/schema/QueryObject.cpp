@@ -62,7 +62,7 @@ void Query::endSelectionSet(const service::SelectionSetParams& params) const
 
 service::AwaitableResolver Query::resolveHero(service::ResolverParams&& params) const
 {
-	auto argEpisode = service::ModifiedArgument<learn::Episode>::require<service::TypeModifier::Nullable>("episode", params.arguments);
+	auto argEpisode = service::ModifiedArgument<learn::Episode>::require<service::TypeModifier::Nullable>("episode", params);
 	std::unique_lock resolverLock(_resolverMutex);
 	auto directives = std::move(params.fieldDirectives);
 	auto result = _pimpl->getHero(service::FieldParams(service::SelectionSetParams{ params }, std::move(directives)), std::move(argEpisode));
@@ -73,7 +73,7 @@ service::AwaitableResolver Query::resolveHero(service::ResolverParams&& params)
 
 service::AwaitableResolver Query::resolveHuman(service::ResolverParams&& params) const
 {
-	auto argId = service::ModifiedArgument<response::IdType>::require("id", params.arguments);
+	auto argId = service::ModifiedArgument<response::IdType>::require("id", params);
 	std::unique_lock resolverLock(_resolverMutex);
 	auto directives = std::move(params.fieldDirectives);
 	auto result = _pimpl->getHuman(service::FieldParams(service::SelectionSetParams{ params }, std::move(directives)), std::move(argId));
@@ -84,7 +84,7 @@ service::AwaitableResolver Query::resolveHuman(service::ResolverParams&& params)
 
 service::AwaitableResolver Query::resolveDroid(service::ResolverParams&& params) const
 {
-	auto argId = service::ModifiedArgument<response::IdType>::require("id", params.arguments);
+	auto argId = service::ModifiedArgument<response::IdType>::require("id", params);
 	std::unique_lock resolverLock(_resolverMutex);
 	auto directives = std::move(params.fieldDirectives);
 	auto result = _pimpl->getDroid(service::FieldParams(service::SelectionSetParams{ params }, std::move(directives)), std::move(argId));
@@ -107,7 +107,7 @@ service::AwaitableResolver Query::resolve_type(service::ResolverParams&& params)
 {
 	auto argName = service::ModifiedArgument<std::string>::require("name", params.arguments);
 	const auto& baseType = _schema->LookupType(argName);
-	std::shared_ptr<introspection::object::Type> result { baseType ? std::make_shared<introspection::object::Type>(std::make_shared<introspection::Type>(baseType)) : nullptr };
+	std::shared_ptr<introspection::object::Type> result { baseType ? _schema->introspectionCache()->get(baseType) : nullptr };
 
 	return service::ModifiedResult<introspection::object::Type>::convert<service::TypeModifier::Nullable>(result, std::move(params));
 }
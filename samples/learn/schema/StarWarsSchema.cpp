@@ -26,10 +26,16 @@ namespace service {
 
 static const auto s_namesEpisode = learn::getEpisodeNames();
 static const auto s_valuesEpisode = learn::getEpisodeValues();
+static const auto s_enumNamesEpisode = makeEnumNames(s_namesEpisode);
 
 template <>
 learn::Episode Argument<learn::Episode>::convert(const response::Value& value)
 {
+	if (const auto index = findEnumName(s_enumNamesEpisode, value))
+	{
+		return static_cast<learn::Episode>(*index);
+	}
+
 	if (!value.maybe_enum())
 	{
 		throw service::schema_exception { { R"ex(not a valid Episode value)ex" } };
@@ -53,17 +59,18 @@ service::AwaitableResolver Result<learn::Episode>::convert(service::AwaitableSca
 	return ModifiedResult<learn::Episode>::resolve(std::move(result), std::move(params),
 		[](learn::Episode value, const ResolverParams&)
 		{
-			response::Value result(response::Type::EnumValue);
-
-			result.set<std::string>(std::string { s_namesEpisode[static_cast<size_t>(value)] });
-
-			return result;
+			return response::Value { response::EnumName { s_enumNamesEpisode[static_cast<size_t>(value)] } };
 		});
 }
 
 template <>
 void Result<learn::Episode>::validateScalar(const response::Value& value)
 {
+	if (findEnumName(s_enumNamesEpisode, value))
+	{
+		return;
+	}
+
 	if (!value.maybe_enum())
 	{
 		throw service::schema_exception { { R"ex(not a valid Episode value)ex" } };
@@ -83,8 +90,32 @@ void Result<learn::Episode>::validateScalar(const response::Value& value)
 template <>
 learn::ReviewInput Argument<learn::ReviewInput>::convert(const response::Value& value)
 {
-	auto valueStars = service::ModifiedArgument<int>::require("stars", value);
-	auto valueCommentary = service::ModifiedArgument<std::string>::require<service::TypeModifier::Nullable>("commentary", value);
+	const response::Value* memberStars = nullptr;
+	const response::Value* memberCommentary = nullptr;
+
+	for (const auto& [name, member] : value.get<response::MapType>())
+	{
+		switch (name.size())
+		{
+			case 5:
+				if (name == "stars"sv)
+				{
+					memberStars = &member;
+					continue;
+				}
+				break;
+			case 10:
+				if (name == "commentary"sv)
+				{
+					memberCommentary = &member;
+					continue;
+				}
+				break;
+		}
+	}
+
+	auto valueStars = service::ModifiedArgument<int>::requireMember("stars", memberStars);
+	auto valueCommentary = service::ModifiedArgument<std::string>::requireMember<service::TypeModifier::Nullable>("commentary", memberCommentary);
 
 	return learn::ReviewInput {
 		std::move(valueStars),
@@ -161,8 +161,14 @@ bool Appointment::getIsNow() const noexcept
 	return _isNow;
 }
 
-std::optional<std::string> Appointment::getForceError() const
+service::AwaitableScalar<std::optional<std::string>> Appointment::getForceError(
+	service::FieldParams&& params) const
 {
+	if (params.state && std::static_pointer_cast<RequestState>(params.state)->forceErrorAsValue)
+	{
+		return service::schema_error { R"ex(this error was forced)ex" };
+	}
+
 	throw std::runtime_error(R"ex(this error was forced)ex");
 }
 
@@ -54,6 +54,9 @@ struct RequestState : service::RequestState
 	size_t loadAppointmentsCount = 0;
 	size_t loadTasksCount = 0;
 	size_t loadUnreadCountsCount = 0;
+
+	// Return the forceError field error by value instead of throwing an exception.
+	bool forceErrorAsValue = false;
 };
 
 class Appointment;
@@ -145,7 +148,8 @@ public:
 	std::shared_ptr<const response::Value> getWhen() const noexcept;
 	std::shared_ptr<const response::Value> getSubject() const noexcept;
 	bool getIsNow() const noexcept;
-	std::optional<std::string> getForceError() const;
+	service::AwaitableScalar<std::optional<std::string>> getForceError(
+		service::FieldParams&& params) const;
 
 private:
 	response::IdType _id;
@@ -3,15 +3,23 @@
 
 #include "TodayMock.h"
 
+#include "graphqlservice/BinaryResponse.h"
 #include "graphqlservice/JSONResponse.h"
 
+#include "graphqlservice/internal/Base64.h"
+
+#include "graphqlservice/introspection/IntrospectionSchema.h"
+
+#include <atomic>
 #include <chrono>
 #include <iostream>
 #include <iterator>
 #include <numeric>
+#include <sstream>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <thread>
 
 using namespace graphql;
 
@@ -59,6 +67,26 @@ void outputSegment(
 			  << " average" << std::endl;
 }
 
+void outputFrameStats(size_t iterations, const internal::CoroutineFrameStats& stats) noexcept
+{
+	const auto heapAllocations = stats.allocations - stats.reused;
+
+	std::cout << "Coroutine frames: " << stats.allocations << " total, "
+			  << (static_cast<double>(stats.allocations) / static_cast<double>(iterations))
+			  << " per request, " << heapAllocations << " from the heap, " << stats.oversized
+			  << " oversized, " << stats.largestFrame << " bytes largest" << std::endl;
+
+	for (size_t i = 0; i < stats.buckets.size(); ++i)
+	{
+		if (stats.buckets[i] > 0)
+		{
+			std::cout << "Coroutine frames up to "
+					  << ((i + 1) * internal::CoroutineFrameStats::BucketGranularity)
+					  << " bytes: " << stats.buckets[i] << std::endl;
+		}
+	}
+}
+
 int main(int argc, char** argv)
 {
 	const size_t iterations = [](const char* arg) noexcept -> size_t {
@@ -86,6 +114,8 @@ int main(int argc, char** argv)
 	std::vector<std::chrono::steady_clock::duration> durationToJson(iterations);
 	const auto startTime = std::chrono::steady_clock::now();
 
+	internal::CoroutineFramePool::resetStats();
+
 	try
 	{
 		for (size_t i = 0; i < iterations; ++i)
@@ -138,6 +168,7 @@ int main(int argc, char** argv)
 
 	const auto endTime = std::chrono::steady_clock::now();
 	const auto totalDuration = endTime - startTime;
+	const auto frameStats = internal::CoroutineFramePool::getStats();
 
 	outputOverview(iterations, totalDuration);
 
@@ -146,5 +177,565 @@ int main(int argc, char** argv)
 	outputSegment("Resolve"sv, durationResolve);
 	outputSegment("ToJSON"sv, durationToJson);
 
+	outputFrameStats(iterations, frameStats);
+
+	// Resolve the same query again with the frame pool disabled, so every coroutine frame goes
+	// through the global allocator, and then with the frame pool enabled again.
+	const auto resolveFrames = [iterations, &service](
+								   std::vector<std::chrono::steady_clock::duration>& durations) {
+		auto query = peg::parseString(R"gql(query {
+			appointments {
+				pageInfo { hasNextPage }
+				edges {
+					node {
+						id
+						when
+						subject
+						isNow
+					}
+				}
+			}
+		})gql"sv);
+
+		if (!service->validate(query).empty())
+		{
+			throw std::runtime_error("Failed to validate the query!");
+		}
+
+		internal::CoroutineFramePool::resetStats();
+
+		for (size_t i = 0; i < iterations; ++i)
+		{
+			const auto startResolve = std::chrono::steady_clock::now();
+			auto response = service->resolve({ query }).get();
+
+			durations[i] = std::chrono::steady_clock::now() - startResolve;
+		}
+
+		const auto stats = internal::CoroutineFramePool::getStats();
+
+		return stats.allocations - stats.reused;
+	};
+	std::vector<std::chrono::steady_clock::duration> durationResolveGlobal(iterations);
+	std::vector<std::chrono::steady_clock::duration> durationResolvePooled(iterations);
+	const auto maxFreeBytes = internal::CoroutineFramePool::getMaxFreeBytes();
+	size_t heapFramesGlobal = 0;
+	size_t heapFramesPooled = 0;
+
+	try
+	{
+		internal::CoroutineFramePool::setMaxFreeBytes(0);
+		heapFramesGlobal = resolveFrames(durationResolveGlobal);
+		internal::CoroutineFramePool::setMaxFreeBytes(maxFreeBytes);
+		heapFramesPooled = resolveFrames(durationResolvePooled);
+	}
+	catch (const std::runtime_error& ex)
+	{
+		std::cerr << ex.what() << std::endl;
+		return 1;
+	}
+
+	outputSegment("Resolve (global allocator)"sv, durationResolveGlobal);
+	outputSegment("Resolve (frame pool)"sv, durationResolvePooled);
+	std::cout << "Coroutine frames from the heap: " << heapFramesGlobal
+			  << " with the global allocator, " << heapFramesPooled << " with the frame pool"
+			  << std::endl;
+
+	// Resolve a selection set full of field errors, which is what a partially failing backend
+	// looks like, both with accessors that throw and with accessors that return the error.
+	constexpr size_t forceErrorFields = 100;
+	std::ostringstream forceErrorQuery;
+
+	forceErrorQuery << "query { appointments { edges { node {";
+
+	for (size_t i = 0; i < forceErrorFields; ++i)
+	{
+		forceErrorQuery << " error" << i << ": forceError";
+	}
+
+	forceErrorQuery << " } } } }";
+
+	const auto errorCount = [](const response::Value& result) {
+		const auto itr = result.find("errors"sv);
+
+		return itr == result.get<response::MapType>().cend() ? size_t { 0 } : itr->second.size();
+	};
+	std::vector<std::chrono::steady_clock::duration> durationForceErrorThrow(iterations);
+	std::vector<std::chrono::steady_clock::duration> durationForceErrorValue(iterations);
+
+	try
+	{
+		auto query = peg::parseString(forceErrorQuery.str());
+
+		if (!service->validate(query).empty())
+		{
+			std::cerr << "Failed to validate the forceError query!" << std::endl;
+			return 1;
+		}
+
+		for (size_t i = 0; i < iterations; ++i)
+		{
+			auto throwState = std::make_shared<today::RequestState>(i);
+			auto valueState = std::make_shared<today::RequestState>(i);
+
+			valueState->forceErrorAsValue = true;
+
+			const auto startThrow = std::chrono::steady_clock::now();
+			auto throwResponse = service->resolve({ query, {}, {}, {}, throwState }).get();
+			const auto startValue = std::chrono::steady_clock::now();
+			auto valueResponse = service->resolve({ query, {}, {}, {}, valueState }).get();
+			const auto endValue = std::chrono::steady_clock::now();
+
+			if (errorCount(throwResponse) != forceErrorFields
+				|| errorCount(valueResponse) != forceErrorFields)
+			{
+				std::cerr << "Missing forceError field errors!" << std::endl;
+				return 1;
+			}
+
+			durationForceErrorThrow[i] = startValue - startThrow;
+			durationForceErrorValue[i] = endValue - startValue;
+		}
+	}
+	catch (const std::runtime_error& ex)
+	{
+		std::cerr << ex.what() << std::endl;
+		return 1;
+	}
+
+	outputSegment("ForceError (exceptions)"sv, durationForceErrorThrow);
+	outputSegment("ForceError (values)"sv, durationForceErrorValue);
+
+	// Validate a document with lots of list variables on several threads at once. Each thread has
+	// its own service, but they all share the same schema and its wrapper types.
+	constexpr size_t listVariables = 20;
+	std::ostringstream listVariablesQuery;
+
+	listVariablesQuery << "query ListVariables(";
+
+	for (size_t i = 0; i < listVariables; ++i)
+	{
+		listVariablesQuery << (i == 0 ? "" : ", ") << "$ids" << i << ": [ID!]!";
+	}
+
+	listVariablesQuery << ") {";
+
+	for (size_t i = 0; i < listVariables; ++i)
+	{
+		listVariablesQuery << " appointments" << i << ": appointmentsById(ids: $ids" << i
+						   << ") { id }";
+	}
+
+	listVariablesQuery << " }";
+
+	const auto listVariablesText = listVariablesQuery.str();
+	const size_t threadCount =
+		std::max(size_t { 2 }, static_cast<size_t>(std::thread::hardware_concurrency()));
+	std::vector<std::unique_ptr<today::TodayMockService>> threadServices(threadCount);
+	std::vector<std::vector<std::chrono::steady_clock::duration>> threadDurations(threadCount,
+		std::vector<std::chrono::steady_clock::duration>(iterations));
+	std::vector<std::thread> threads;
+	std::atomic_bool listVariablesFailed = false;
+
+	// Create the services up front, GetSchema should not race with itself.
+	std::generate(threadServices.begin(), threadServices.end(), today::mock_service);
+	threads.reserve(threadCount);
+
+	for (size_t i = 0; i < threadCount; ++i)
+	{
+		threads.emplace_back([&listVariablesText,
+								 &listVariablesFailed,
+								 &threadService = threadServices[i]->service,
+								 &durations = threadDurations[i]]() noexcept {
+			try
+			{
+				for (auto& duration : durations)
+				{
+					auto query = peg::parseString(listVariablesText);
+					const auto startValidate = std::chrono::steady_clock::now();
+
+					if (!threadService->validate(query).empty())
+					{
+						listVariablesFailed = true;
+						return;
+					}
+
+					duration = std::chrono::steady_clock::now() - startValidate;
+				}
+			}
+			catch (const std::exception&)
+			{
+				listVariablesFailed = true;
+			}
+		});
+	}
+
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+
+	if (listVariablesFailed)
+	{
+		std::cerr << "Failed to validate the list variables query!" << std::endl;
+		return 1;
+	}
+
+	std::vector<std::chrono::steady_clock::duration> durationListVariables;
+
+	durationListVariables.reserve(threadCount * iterations);
+
+	for (const auto& durations : threadDurations)
+	{
+		durationListVariables.insert(durationListVariables.end(),
+			durations.begin(),
+			durations.end());
+	}
+
+	std::cout << "Validation threads: " << threadCount << std::endl;
+	outputSegment("Validate list variables (threaded)"sv, durationListVariables);
+
+	// Validate a document against a wide schema, which has as many types as a large generated
+	// schema. Every field and fragment in the document looks up a name in the validator's tables
+	// for the schema, so this is dominated by those lookups.
+	constexpr size_t wideTypes = 5000;
+	std::vector<std::string> wideNames(wideTypes);
+	std::vector<std::string> wideFieldNames(wideTypes);
+	const auto wideSchema = std::make_shared<schema::Schema>(true);
+	const auto wideIdType = schema::ScalarType::Make("ID"sv, ""sv, ""sv);
+	const auto wideQueryType = schema::ObjectType::Make("Query"sv, ""sv);
+	std::vector<std::shared_ptr<const schema::Field>> wideQueryFields(wideTypes);
+	std::ostringstream wideQuery;
+
+	wideSchema->AddType("ID"sv, wideIdType);
+	wideSchema->AddType("String"sv, schema::ScalarType::Make("String"sv, ""sv, ""sv));
+	wideSchema->AddType("Query"sv, wideQueryType);
+	wideSchema->AddQueryType(wideQueryType);
+	wideQuery << "{";
+
+	for (size_t i = 0; i < wideTypes; ++i)
+	{
+		wideNames[i] = "GeneratedType" + std::to_string(i);
+		wideFieldNames[i] = "generated" + std::to_string(i);
+
+		const auto wideType = schema::ObjectType::Make(wideNames[i], ""sv);
+
+		wideType->AddFields({ schema::Field::Make("id"sv,
+			""sv,
+			std::nullopt,
+			wideSchema->WrapType(introspection::TypeKind::NON_NULL, wideIdType)) });
+		wideSchema->AddType(wideNames[i], wideType);
+		wideQueryFields[i] = schema::Field::Make(wideFieldNames[i], ""sv, std::nullopt, wideType);
+		wideQuery << " " << wideFieldNames[i] << " { ...Fragment" << i << " }";
+	}
+
+	wideQueryType->AddFields(std::move(wideQueryFields));
+	wideQuery << " }";
+
+	for (size_t i = 0; i < wideTypes; ++i)
+	{
+		wideQuery << " fragment Fragment" << i << " on " << wideNames[i] << " { id }";
+	}
+
+	class WideRequest : public service::Request
+	{
+	public:
+		explicit WideRequest(std::shared_ptr<schema::Schema> schema)
+			: service::Request({}, std::move(schema))
+		{
+		}
+	};
+
+	const auto wideQueryText = wideQuery.str();
+	const auto wideService = std::make_shared<WideRequest>(wideSchema);
+	std::vector<std::chrono::steady_clock::duration> durationWideValidate(iterations);
+
+	try
+	{
+		for (auto& duration : durationWideValidate)
+		{
+			auto query = peg::parseString(wideQueryText);
+			const auto startValidate = std::chrono::steady_clock::now();
+
+			if (!wideService->validate(query).empty())
+			{
+				std::cerr << "Failed to validate the wide schema query!" << std::endl;
+				return 1;
+			}
+
+			duration = std::chrono::steady_clock::now() - startValidate;
+		}
+	}
+	catch (const std::exception& ex)
+	{
+		std::cerr << ex.what() << std::endl;
+		return 1;
+	}
+
+	// Replay the schema table lookups which the validator performs for the same document, once
+	// with sorted maps and once with the hashed index ValidateSchema uses, so the two can still be
+	// compared on the wide schema. Each field looks up the fields of its parent type and then the
+	// field name, and each fragment also looks up its type condition.
+	internal::string_view_map<const schema::BaseType*> sortedWideTypes;
+	internal::string_view_map<internal::string_view_map<const schema::Field*>> sortedWideFields;
+	internal::string_view_map<internal::string_view_hash_map<const schema::Field*>>
+		hashedWideFieldsEntries;
+
+	for (const auto& [name, type] : wideSchema->types())
+	{
+		sortedWideTypes.emplace(name, type.get());
+
+		if (type->kind() != introspection::TypeKind::OBJECT)
+		{
+			continue;
+		}
+
+		internal::string_view_map<const schema::Field*> fields;
+
+		for (const auto& field : type->fields())
+		{
+			fields.emplace(field->name(), field.get());
+		}
+
+		hashedWideFieldsEntries.emplace(name,
+			internal::string_view_hash_map<const schema::Field*> {
+				internal::string_view_map<const schema::Field*> { fields } });
+		sortedWideFields.emplace(name, std::move(fields));
+	}
+
+	const internal::string_view_hash_map<const schema::BaseType*> hashedWideTypes {
+		internal::string_view_map<const schema::BaseType*> { sortedWideTypes }
+	};
+	const internal::string_view_hash_map<internal::string_view_hash_map<const schema::Field*>>
+		hashedWideFields { std::move(hashedWideFieldsEntries) };
+	const auto replayWideLookups = [&wideNames, &wideFieldNames](
+									   const auto& types, const auto& typeFields) noexcept {
+		size_t found = 0;
+		const auto& queryFields = typeFields.find("Query"sv)->second;
+
+		for (size_t i = 0; i < wideTypes; ++i)
+		{
+			found += (queryFields.find(wideFieldNames[i]) != queryFields.end()) ? 1 : 0;
+		}
+
+		for (size_t i = 0; i < wideTypes; ++i)
+		{
+			found += (types.find(wideNames[i]) != types.end()) ? 1 : 0;
+
+			const auto& fields = typeFields.find(wideNames[i])->second;
+
+			found += (fields.find("id"sv) != fields.end()) ? 1 : 0;
+		}
+
+		return found;
+	};
+	std::vector<std::chrono::steady_clock::duration> durationSortedLookups(iterations);
+	std::vector<std::chrono::steady_clock::duration> durationHashedLookups(iterations);
+
+	for (size_t i = 0; i < iterations; ++i)
+	{
+		const auto startSorted = std::chrono::steady_clock::now();
+		const auto foundSorted = replayWideLookups(sortedWideTypes, sortedWideFields);
+		const auto startHashed = std::chrono::steady_clock::now();
+		const auto foundHashed = replayWideLookups(hashedWideTypes, hashedWideFields);
+		const auto endHashed = std::chrono::steady_clock::now();
+
+		if (foundSorted != wideTypes * 3 || foundHashed != foundSorted)
+		{
+			std::cerr << "Mismatched wide schema lookups!" << std::endl;
+			return 1;
+		}
+
+		durationSortedLookups[i] = startHashed - startSorted;
+		durationHashedLookups[i] = endHashed - startHashed;
+	}
+
+	std::cout << "Wide schema types: " << wideTypes << std::endl;
+	outputSegment("Validate wide schema"sv, durationWideValidate);
+	outputSegment("Wide schema lookups (sorted)"sv, durationSortedLookups);
+	outputSegment("Wide schema lookups (hashed)"sv, durationHashedLookups);
+
+	// Serialize a large shared value, like the ones scalar resolvers can hand back without copying,
+	// and compare it with serializing a private copy of the same value.
+	constexpr size_t sharedEntries = 1000;
+	response::Value sharedList { response::Type::List };
+
+	sharedList.reserve(sharedEntries);
+
+	for (size_t i = 0; i < sharedEntries; ++i)
+	{
+		response::Value entry { response::Type::Map };
+
+		entry.emplace_back("id"s,
+			response::Value { response::IdType { "entry" + std::to_string(i) } });
+		entry.emplace_back("name"s, response::Value { "Shared entry " + std::to_string(i) });
+		entry.emplace_back("index"s, response::Value { static_cast<int>(i) });
+		sharedList.emplace_back(std::move(entry));
+	}
+
+	const auto shared = std::make_shared<const response::Value>(std::move(sharedList));
+	std::vector<std::chrono::steady_clock::duration> durationSharedToJson(iterations);
+	std::vector<std::chrono::steady_clock::duration> durationCopiedToJson(iterations);
+
+	for (size_t i = 0; i < iterations; ++i)
+	{
+		const auto startShared = std::chrono::steady_clock::now();
+		const auto sharedJson = response::toJSON(response::Value { shared });
+		const auto startCopied = std::chrono::steady_clock::now();
+		const auto copiedJson = response::toJSON(response::Value { *shared });
+		const auto endCopied = std::chrono::steady_clock::now();
+
+		if (sharedJson != copiedJson)
+		{
+			std::cerr << "Mismatched shared serialization!" << std::endl;
+			return 1;
+		}
+
+		durationSharedToJson[i] = startCopied - startShared;
+		durationCopiedToJson[i] = endCopied - startCopied;
+	}
+
+	std::cout << "Shared entries: " << sharedEntries << std::endl;
+	outputSegment("ToJSON (shared)"sv, durationSharedToJson);
+	outputSegment("ToJSON (copied)"sv, durationCopiedToJson);
+
+	// Encode and decode the same today response as JSON, CBOR and MessagePack.
+	auto encodingQuery = peg::parseString(R"gql(query {
+		appointments {
+			pageInfo { hasNextPage }
+			edges {
+				node {
+					id
+					when
+					subject
+					isNow
+				}
+			}
+		}
+	})gql"sv);
+	const auto encodingResponse = service->resolve({ encodingQuery }).get();
+	std::vector<std::chrono::steady_clock::duration> durationEncodeJson(iterations);
+	std::vector<std::chrono::steady_clock::duration> durationDecodeJson(iterations);
+	std::vector<std::chrono::steady_clock::duration> durationEncodeCBOR(iterations);
+	std::vector<std::chrono::steady_clock::duration> durationDecodeCBOR(iterations);
+	std::vector<std::chrono::steady_clock::duration> durationEncodeMessagePack(iterations);
+	std::vector<std::chrono::steady_clock::duration> durationDecodeMessagePack(iterations);
+	size_t jsonSize = 0;
+	size_t cborSize = 0;
+	size_t msgpackSize = 0;
+
+	for (size_t i = 0; i < iterations; ++i)
+	{
+		response::Value jsonResponse { encodingResponse };
+		response::Value cborResponse { encodingResponse };
+		response::Value msgpackResponse { encodingResponse };
+
+		const auto startEncodeJson = std::chrono::steady_clock::now();
+		const auto json = response::toJSON(std::move(jsonResponse));
+		const auto startDecodeJson = std::chrono::steady_clock::now();
+		const auto parsedJson = response::parseJSON(json);
+		const auto startEncodeCBOR = std::chrono::steady_clock::now();
+		const auto cbor = response::toCBOR(std::move(cborResponse));
+		const auto startDecodeCBOR = std::chrono::steady_clock::now();
+		const auto parsedCBOR = response::parseCBOR(cbor);
+		const auto startEncodeMessagePack = std::chrono::steady_clock::now();
+		const auto msgpack = response::toMessagePack(std::move(msgpackResponse));
+		const auto startDecodeMessagePack = std::chrono::steady_clock::now();
+		const auto parsedMessagePack = response::parseMessagePack(msgpack);
+		const auto endDecodeMessagePack = std::chrono::steady_clock::now();
+
+		if (parsedJson.size() != encodingResponse.size()
+			|| parsedCBOR.size() != encodingResponse.size()
+			|| parsedMessagePack.size() != encodingResponse.size())
+		{
+			std::cerr << "Mismatched encoding round trip!" << std::endl;
+			return 1;
+		}
+
+		jsonSize = json.size();
+		cborSize = cbor.size();
+		msgpackSize = msgpack.size();
+		durationEncodeJson[i] = startDecodeJson - startEncodeJson;
+		durationDecodeJson[i] = startEncodeCBOR - startDecodeJson;
+		durationEncodeCBOR[i] = startDecodeCBOR - startEncodeCBOR;
+		durationDecodeCBOR[i] = startEncodeMessagePack - startDecodeCBOR;
+		durationEncodeMessagePack[i] = startDecodeMessagePack - startEncodeMessagePack;
+		durationDecodeMessagePack[i] = endDecodeMessagePack - startDecodeMessagePack;
+	}
+
+	std::cout << "Encoded bytes: JSON " << jsonSize << ", CBOR " << cborSize << ", MessagePack "
+			  << msgpackSize << std::endl;
+	outputSegment("Encode JSON"sv, durationEncodeJson);
+	outputSegment("Decode JSON"sv, durationDecodeJson);
+	outputSegment("Encode CBOR"sv, durationEncodeCBOR);
+	outputSegment("Decode CBOR"sv, durationDecodeCBOR);
+	outputSegment("Encode MessagePack"sv, durationEncodeMessagePack);
+	outputSegment("Decode MessagePack"sv, durationDecodeMessagePack);
+
+	// Measure Base64 throughput for typical short IDs and for long opaque IDs.
+	constexpr size_t base64Ids = 1000;
+
+	for (const size_t idLength : { size_t { 16 }, size_t { 32 }, size_t { 1024 } })
+	{
+		std::vector<std::vector<std::uint8_t>> ids(base64Ids, std::vector<std::uint8_t>(idLength));
+		std::vector<std::string> encodedIds(base64Ids);
+		std::vector<std::chrono::steady_clock::duration> durationEncode(iterations);
+		std::vector<std::chrono::steady_clock::duration> durationDecode(iterations);
+		std::vector<std::chrono::steady_clock::duration> durationCompare(iterations);
+
+		for (size_t i = 0; i < base64Ids; ++i)
+		{
+			for (size_t j = 0; j < idLength; ++j)
+			{
+				ids[i][j] = static_cast<std::uint8_t>(i * 31 + j * 7);
+			}
+		}
+
+		for (size_t i = 0; i < iterations; ++i)
+		{
+			size_t matches = 0;
+			const auto startEncode = std::chrono::steady_clock::now();
+
+			for (size_t j = 0; j < base64Ids; ++j)
+			{
+				encodedIds[j] = internal::Base64::toBase64(ids[j]);
+			}
+
+			const auto startDecode = std::chrono::steady_clock::now();
+
+			for (const auto& encodedId : encodedIds)
+			{
+				matches += internal::Base64::fromBase64(encodedId).size() == idLength ? 1 : 0;
+			}
+
+			const auto startCompare = std::chrono::steady_clock::now();
+
+			for (size_t j = 0; j < base64Ids; ++j)
+			{
+				matches += internal::Base64::compareBase64(ids[j], encodedIds[j])
+						== internal::Base64::Comparison::EqualTo
+					? 1
+					: 0;
+			}
+
+			const auto endCompare = std::chrono::steady_clock::now();
+
+			if (matches != 2 * base64Ids)
+			{
+				std::cerr << "Mismatched Base64 results!" << std::endl;
+				return 1;
+			}
+
+			durationEncode[i] = startDecode - startEncode;
+			durationDecode[i] = startCompare - startDecode;
+			durationCompare[i] = endCompare - startCompare;
+		}
+
+		std::cout << "Base64 IDs: " << base64Ids << " x " << idLength << " bytes" << std::endl;
+		outputSegment("Base64 encode"sv, durationEncode);
+		outputSegment("Base64 decode"sv, durationDecode);
+		outputSegment("Base64 compare"sv, durationCompare);
+	}
+
 	return 0;
 }
@@ -27,10 +27,16 @@ namespace service {
 
 static const auto s_namesTaskState = today::getTaskStateNames();
 static const auto s_valuesTaskState = today::getTaskStateValues();
+static const auto s_enumNamesTaskState = makeEnumNames(s_namesTaskState);
 
 template <>
 today::TaskState Argument<today::TaskState>::convert(const response::Value& value)
 {
+	if (const auto index = findEnumName(s_enumNamesTaskState, value))
+	{
+		return static_cast<today::TaskState>(*index);
+	}
+
 	if (!value.maybe_enum())
 	{
 		throw service::schema_exception { { R"ex(not a valid TaskState value)ex" } };
@@ -54,17 +60,18 @@ service::AwaitableResolver Result<today::TaskState>::convert(service::AwaitableS
 	return ModifiedResult<today::TaskState>::resolve(std::move(result), std::move(params),
 		[](today::TaskState value, const ResolverParams&)
 		{
-			response::Value result(response::Type::EnumValue);
-
-			result.set<std::string>(std::string { s_namesTaskState[static_cast<size_t>(value)] });
-
-			return result;
+			return response::Value { response::EnumName { s_enumNamesTaskState[static_cast<size_t>(value)] } };
 		});
 }
 
 template <>
 void Result<today::TaskState>::validateScalar(const response::Value& value)
 {
+	if (findEnumName(s_enumNamesTaskState, value))
+	{
+		return;
+	}
+
 	if (!value.maybe_enum())
 	{
 		throw service::schema_exception { { R"ex(not a valid TaskState value)ex" } };
@@ -84,7 +91,7 @@ void Result<today::TaskState>::validateScalar(const response::Value& value)
 template <>
 today::CompleteTaskInput Argument<today::CompleteTaskInput>::convert(const response::Value& value)
 {
-	const auto defaultValue = []()
+	static const auto defaultValue = []()
 	{
 		response::Value values(response::Type::Map);
 		response::Value entry;
@@ -95,13 +102,53 @@ today::CompleteTaskInput Argument<today::CompleteTaskInput>::convert(const respo
 		return values;
 	}();
 
-	auto valueId = service::ModifiedArgument<response::IdType>::require("id", value);
-	auto valueTestTaskState = service::ModifiedArgument<today::TaskState>::require<service::TypeModifier::Nullable>("testTaskState", value);
-	auto pairIsComplete = service::ModifiedArgument<bool>::find<service::TypeModifier::Nullable>("isComplete", value);
+	const response::Value* memberId = nullptr;
+	const response::Value* memberTestTaskState = nullptr;
+	const response::Value* memberIsComplete = nullptr;
+	const response::Value* memberClientMutationId = nullptr;
+
+	for (const auto& [name, member] : value.get<response::MapType>())
+	{
+		switch (name.size())
+		{
+			case 2:
+				if (name == "id"sv)
+				{
+					memberId = &member;
+					continue;
+				}
+				break;
+			case 10:
+				if (name == "isComplete"sv)
+				{
+					memberIsComplete = &member;
+					continue;
+				}
+				break;
+			case 13:
+				if (name == "testTaskState"sv)
+				{
+					memberTestTaskState = &member;
+					continue;
+				}
+				break;
+			case 16:
+				if (name == "clientMutationId"sv)
+				{
+					memberClientMutationId = &member;
+					continue;
+				}
+				break;
+		}
+	}
+
+	auto valueId = service::ModifiedArgument<response::IdType>::requireMember("id", memberId);
+	auto valueTestTaskState = service::ModifiedArgument<today::TaskState>::requireMember<service::TypeModifier::Nullable>("testTaskState", memberTestTaskState);
+	auto pairIsComplete = service::ModifiedArgument<bool>::findMember<service::TypeModifier::Nullable>("isComplete", memberIsComplete);
 	auto valueIsComplete = (pairIsComplete.second
 		? std::move(pairIsComplete.first)
 		: service::ModifiedArgument<bool>::require<service::TypeModifier::Nullable>("isComplete", defaultValue));
-	auto valueClientMutationId = service::ModifiedArgument<std::string>::require<service::TypeModifier::Nullable>("clientMutationId", value);
+	auto valueClientMutationId = service::ModifiedArgument<std::string>::requireMember<service::TypeModifier::Nullable>("clientMutationId", memberClientMutationId);
 
 	return today::CompleteTaskInput {
 		std::move(valueId),
@@ -114,8 +161,32 @@ today::CompleteTaskInput Argument<today::CompleteTaskInput>::convert(const respo
 template <>
 today::ThirdNestedInput Argument<today::ThirdNestedInput>::convert(const response::Value& value)
 {
-	auto valueId = service::ModifiedArgument<response::IdType>::require("id", value);
-	auto valueSecond = service::ModifiedArgument<today::SecondNestedInput>::require<service::TypeModifier::Nullable>("second", value);
+	const response::Value* memberId = nullptr;
+	const response::Value* memberSecond = nullptr;
+
+	for (const auto& [name, member] : value.get<response::MapType>())
+	{
+		switch (name.size())
+		{
+			case 2:
+				if (name == "id"sv)
+				{
+					memberId = &member;
+					continue;
+				}
+				break;
+			case 6:
+				if (name == "second"sv)
+				{
+					memberSecond = &member;
+					continue;
+				}
+				break;
+		}
+	}
+
+	auto valueId = service::ModifiedArgument<response::IdType>::requireMember("id", memberId);
+	auto valueSecond = service::ModifiedArgument<today::SecondNestedInput>::requireMember<service::TypeModifier::Nullable>("second", memberSecond);
 
 	return today::ThirdNestedInput {
 		std::move(valueId),
@@ -126,7 +197,23 @@ today::ThirdNestedInput Argument<today::ThirdNestedInput>::convert(const respons
 template <>
 today::FourthNestedInput Argument<today::FourthNestedInput>::convert(const response::Value& value)
 {
-	auto valueId = service::ModifiedArgument<response::IdType>::require("id", value);
+	const response::Value* memberId = nullptr;
+
+	for (const auto& [name, member] : value.get<response::MapType>())
+	{
+		switch (name.size())
+		{
+			case 2:
+				if (name == "id"sv)
+				{
+					memberId = &member;
+					continue;
+				}
+				break;
+		}
+	}
+
+	auto valueId = service::ModifiedArgument<response::IdType>::requireMember("id", memberId);
 
 	return today::FourthNestedInput {
 		std::move(valueId)
@@ -136,7 +223,23 @@ today::FourthNestedInput Argument<today::FourthNestedInput>::convert(const respo
 template <>
 today::IncludeNullableSelfInput Argument<today::IncludeNullableSelfInput>::convert(const response::Value& value)
 {
-	auto valueSelf = service::ModifiedArgument<today::IncludeNullableSelfInput>::require<service::TypeModifier::Nullable>("self", value);
+	const response::Value* memberSelf = nullptr;
+
+	for (const auto& [name, member] : value.get<response::MapType>())
+	{
+		switch (name.size())
+		{
+			case 4:
+				if (name == "self"sv)
+				{
+					memberSelf = &member;
+					continue;
+				}
+				break;
+		}
+	}
+
+	auto valueSelf = service::ModifiedArgument<today::IncludeNullableSelfInput>::requireMember<service::TypeModifier::Nullable>("self", memberSelf);
 
 	return today::IncludeNullableSelfInput {
 		std::move(valueSelf)
@@ -146,7 +249,23 @@ today::IncludeNullableSelfInput Argument<today::IncludeNullableSelfInput>::conve
 template <>
 today::IncludeNonNullableListSelfInput Argument<today::IncludeNonNullableListSelfInput>::convert(const response::Value& value)
 {
-	auto valueSelves = service::ModifiedArgument<today::IncludeNonNullableListSelfInput>::require<service::TypeModifier::List>("selves", value);
+	const response::Value* memberSelves = nullptr;
+
+	for (const auto& [name, member] : value.get<response::MapType>())
+	{
+		switch (name.size())
+		{
+			case 6:
+				if (name == "selves"sv)
+				{
+					memberSelves = &member;
+					continue;
+				}
+				break;
+		}
+	}
+
+	auto valueSelves = service::ModifiedArgument<today::IncludeNonNullableListSelfInput>::requireMember<service::TypeModifier::List>("selves", memberSelves);
 
 	return today::IncludeNonNullableListSelfInput {
 		std::move(valueSelves)
@@ -156,18 +275,112 @@ today::IncludeNonNullableListSelfInput Argument<today::IncludeNonNullableListSel
 template <>
 today::StringOperationFilterInput Argument<today::StringOperationFilterInput>::convert(const response::Value& value)
 {
-	auto valueAnd_ = service::ModifiedArgument<today::StringOperationFilterInput>::require<service::TypeModifier::Nullable, service::TypeModifier::List>("and", value);
-	auto valueOr_ = service::ModifiedArgument<today::StringOperationFilterInput>::require<service::TypeModifier::Nullable, service::TypeModifier::List>("or", value);
-	auto valueEqual = service::ModifiedArgument<std::string>::require<service::TypeModifier::Nullable>("equal", value);
-	auto valueNotEqual = service::ModifiedArgument<std::string>::require<service::TypeModifier::Nullable>("notEqual", value);
-	auto valueContains = service::ModifiedArgument<std::string>::require<service::TypeModifier::Nullable>("contains", value);
-	auto valueNotContains = service::ModifiedArgument<std::string>::require<service::TypeModifier::Nullable>("notContains", value);
-	auto valueIn = service::ModifiedArgument<std::string>::require<service::TypeModifier::Nullable, service::TypeModifier::List>("in", value);
-	auto valueNotIn = service::ModifiedArgument<std::string>::require<service::TypeModifier::Nullable, service::TypeModifier::List>("notIn", value);
-	auto valueStartsWith = service::ModifiedArgument<std::string>::require<service::TypeModifier::Nullable>("startsWith", value);
-	auto valueNotStartsWith = service::ModifiedArgument<std::string>::require<service::TypeModifier::Nullable>("notStartsWith", value);
-	auto valueEndsWith = service::ModifiedArgument<std::string>::require<service::TypeModifier::Nullable>("endsWith", value);
-	auto valueNotEndsWith = service::ModifiedArgument<std::string>::require<service::TypeModifier::Nullable>("notEndsWith", value);
+	const response::Value* memberAnd_ = nullptr;
+	const response::Value* memberOr_ = nullptr;
+	const response::Value* memberEqual = nullptr;
+	const response::Value* memberNotEqual = nullptr;
+	const response::Value* memberContains = nullptr;
+	const response::Value* memberNotContains = nullptr;
+	const response::Value* memberIn = nullptr;
+	const response::Value* memberNotIn = nullptr;
+	const response::Value* memberStartsWith = nullptr;
+	const response::Value* memberNotStartsWith = nullptr;
+	const response::Value* memberEndsWith = nullptr;
+	const response::Value* memberNotEndsWith = nullptr;
+
+	for (const auto& [name, member] : value.get<response::MapType>())
+	{
+		switch (name.size())
+		{
+			case 2:
+				if (name == "or"sv)
+				{
+					memberOr_ = &member;
+					continue;
+				}
+				if (name == "in"sv)
+				{
+					memberIn = &member;
+					continue;
+				}
+				break;
+			case 3:
+				if (name == "and"sv)
+				{
+					memberAnd_ = &member;
+					continue;
+				}
+				break;
+			case 5:
+				if (name == "equal"sv)
+				{
+					memberEqual = &member;
+					continue;
+				}
+				if (name == "notIn"sv)
+				{
+					memberNotIn = &member;
+					continue;
+				}
+				break;
+			case 8:
+				if (name == "notEqual"sv)
+				{
+					memberNotEqual = &member;
+					continue;
+				}
+				if (name == "contains"sv)
+				{
+					memberContains = &member;
+					continue;
+				}
+				if (name == "endsWith"sv)
+				{
+					memberEndsWith = &member;
+					continue;
+				}
+				break;
+			case 10:
+				if (name == "startsWith"sv)
+				{
+					memberStartsWith = &member;
+					continue;
+				}
+				break;
+			case 11:
+				if (name == "notContains"sv)
+				{
+					memberNotContains = &member;
+					continue;
+				}
+				if (name == "notEndsWith"sv)
+				{
+					memberNotEndsWith = &member;
+					continue;
+				}
+				break;
+			case 13:
+				if (name == "notStartsWith"sv)
+				{
+					memberNotStartsWith = &member;
+					continue;
+				}
+				break;
+		}
+	}
+
+	auto valueAnd_ = service::ModifiedArgument<today::StringOperationFilterInput>::requireMember<service::TypeModifier::Nullable, service::TypeModifier::List>("and", memberAnd_);
+	auto valueOr_ = service::ModifiedArgument<today::StringOperationFilterInput>::requireMember<service::TypeModifier::Nullable, service::TypeModifier::List>("or", memberOr_);
+	auto valueEqual = service::ModifiedArgument<std::string>::requireMember<service::TypeModifier::Nullable>("equal", memberEqual);
+	auto valueNotEqual = service::ModifiedArgument<std::string>::requireMember<service::TypeModifier::Nullable>("notEqual", memberNotEqual);
+	auto valueContains = service::ModifiedArgument<std::string>::requireMember<service::TypeModifier::Nullable>("contains", memberContains);
+	auto valueNotContains = service::ModifiedArgument<std::string>::requireMember<service::TypeModifier::Nullable>("notContains", memberNotContains);
+	auto valueIn = service::ModifiedArgument<std::string>::requireMember<service::TypeModifier::Nullable, service::TypeModifier::List>("in", memberIn);
+	auto valueNotIn = service::ModifiedArgument<std::string>::requireMember<service::TypeModifier::Nullable, service::TypeModifier::List>("notIn", memberNotIn);
+	auto valueStartsWith = service::ModifiedArgument<std::string>::requireMember<service::TypeModifier::Nullable>("startsWith", memberStartsWith);
+	auto valueNotStartsWith = service::ModifiedArgument<std::string>::requireMember<service::TypeModifier::Nullable>("notStartsWith", memberNotStartsWith);
+	auto valueEndsWith = service::ModifiedArgument<std::string>::requireMember<service::TypeModifier::Nullable>("endsWith", memberEndsWith);
+	auto valueNotEndsWith = service::ModifiedArgument<std::string>::requireMember<service::TypeModifier::Nullable>("notEndsWith", memberNotEndsWith);
 
 	return today::StringOperationFilterInput {
 		std::move(valueAnd_),
@@ -188,8 +401,32 @@ today::StringOperationFilterInput Argument<today::StringOperationFilterInput>::c
 template <>
 today::SecondNestedInput Argument<today::SecondNestedInput>::convert(const response::Value& value)
 {
-	auto valueId = service::ModifiedArgument<response::IdType>::require("id", value);
-	auto valueThird = service::ModifiedArgument<today::ThirdNestedInput>::require("third", value);
+	const response::Value* memberId = nullptr;
+	const response::Value* memberThird = nullptr;
+
+	for (const auto& [name, member] : value.get<response::MapType>())
+	{
+		switch (name.size())
+		{
+			case 2:
+				if (name == "id"sv)
+				{
+					memberId = &member;
+					continue;
+				}
+				break;
+			case 5:
+				if (name == "third"sv)
+				{
+					memberThird = &member;
+					continue;
+				}
+				break;
+		}
+	}
+
+	auto valueId = service::ModifiedArgument<response::IdType>::requireMember("id", memberId);
+	auto valueThird = service::ModifiedArgument<today::ThirdNestedInput>::requireMember("third", memberThird);
 
 	return today::SecondNestedInput {
 		std::move(valueId),
@@ -200,8 +437,32 @@ today::SecondNestedInput Argument<today::SecondNestedInput>::convert(const respo
 template <>
 today::ForwardDeclaredInput Argument<today::ForwardDeclaredInput>::convert(const response::Value& value)
 {
-	auto valueNullableSelf = service::ModifiedArgument<today::IncludeNullableSelfInput>::require<service::TypeModifier::Nullable>("nullableSelf", value);
-	auto valueListSelves = service::ModifiedArgument<today::IncludeNonNullableListSelfInput>::require("listSelves", value);
+	const response::Value* memberNullableSelf = nullptr;
+	const response::Value* memberListSelves = nullptr;
+
+	for (const auto& [name, member] : value.get<response::MapType>())
+	{
+		switch (name.size())
+		{
+			case 10:
+				if (name == "listSelves"sv)
+				{
+					memberListSelves = &member;
+					continue;
+				}
+				break;
+			case 12:
+				if (name == "nullableSelf"sv)
+				{
+					memberNullableSelf = &member;
+					continue;
+				}
+				break;
+		}
+	}
+
+	auto valueNullableSelf = service::ModifiedArgument<today::IncludeNullableSelfInput>::requireMember<service::TypeModifier::Nullable>("nullableSelf", memberNullableSelf);
+	auto valueListSelves = service::ModifiedArgument<today::IncludeNonNullableListSelfInput>::requireMember("listSelves", memberListSelves);
 
 	return today::ForwardDeclaredInput {
 		std::move(valueNullableSelf),
@@ -212,9 +473,41 @@ today::ForwardDeclaredInput Argument<today::ForwardDeclaredInput>::convert(const
 template <>
 today::FirstNestedInput Argument<today::FirstNestedInput>::convert(const response::Value& value)
 {
-	auto valueId = service::ModifiedArgument<response::IdType>::require("id", value);
-	auto valueSecond = service::ModifiedArgument<today::SecondNestedInput>::require("second", value);
-	auto valueThird = service::ModifiedArgument<today::ThirdNestedInput>::require("third", value);
+	const response::Value* memberId = nullptr;
+	const response::Value* memberSecond = nullptr;
+	const response::Value* memberThird = nullptr;
+
+	for (const auto& [name, member] : value.get<response::MapType>())
+	{
+		switch (name.size())
+		{
+			case 2:
+				if (name == "id"sv)
+				{
+					memberId = &member;
+					continue;
+				}
+				break;
+			case 5:
+				if (name == "third"sv)
+				{
+					memberThird = &member;
+					continue;
+				}
+				break;
+			case 6:
+				if (name == "second"sv)
+				{
+					memberSecond = &member;
+					continue;
+				}
+				break;
+		}
+	}
+
+	auto valueId = service::ModifiedArgument<response::IdType>::requireMember("id", memberId);
+	auto valueSecond = service::ModifiedArgument<today::SecondNestedInput>::requireMember("second", memberSecond);
+	auto valueThird = service::ModifiedArgument<today::ThirdNestedInput>::requireMember("third", memberThird);
 
 	return today::FirstNestedInput {
 		std::move(valueId),
@@ -55,7 +55,7 @@ void Mutation::endSelectionSet(const service::SelectionSetParams& params) const
 
 service::AwaitableResolver Mutation::resolveCompleteTask(service::ResolverParams&& params) const
 {
-	auto argInput = service::ModifiedArgument<today::CompleteTaskInput>::require("input", params.arguments);
+	auto argInput = service::ModifiedArgument<today::CompleteTaskInput>::require("input", params);
 	std::unique_lock resolverLock(_resolverMutex);
 	auto directives = std::move(params.fieldDirectives);
 	auto result = _pimpl->applyCompleteTask(service::FieldParams(service::SelectionSetParams{ params }, std::move(directives)), std::move(argInput));
@@ -66,7 +66,7 @@ service::AwaitableResolver Mutation::resolveCompleteTask(service::ResolverParams
 
 service::AwaitableResolver Mutation::resolveSetFloat(service::ResolverParams&& params) const
 {
-	auto argValue = service::ModifiedArgument<double>::require("value", params.arguments);
+	auto argValue = service::ModifiedArgument<double>::require("value", params);
 	std::unique_lock resolverLock(_resolverMutex);
 	auto directives = std::move(params.fieldDirectives);
 	auto result = _pimpl->applySetFloat(service::FieldParams(service::SelectionSetParams{ params }, std::move(directives)), std::move(argValue));
@@ -60,8 +60,8 @@ void Arguments::endSelectionSet(const service::SelectionSetParams& params) const
 
 service::AwaitableResolver Arguments::resolveMultipleReqs(service::ResolverParams&& params) const
 {
-	auto argX = service::ModifiedArgument<int>::require("x", params.arguments);
-	auto argY = service::ModifiedArgument<int>::require("y", params.arguments);
+	auto argX = service::ModifiedArgument<int>::require("x", params);
+	auto argY = service::ModifiedArgument<int>::require("y", params);
 	std::unique_lock resolverLock(_resolverMutex);
 	auto directives = std::move(params.fieldDirectives);
 	auto result = _pimpl->getMultipleReqs(service::FieldParams(service::SelectionSetParams{ params }, std::move(directives)), std::move(argX), std::move(argY));
@@ -72,7 +72,7 @@ service::AwaitableResolver Arguments::resolveMultipleReqs(service::ResolverParam
 
 service::AwaitableResolver Arguments::resolveBooleanArgField(service::ResolverParams&& params) const
 {
-	auto argBooleanArg = service::ModifiedArgument<bool>::require<service::TypeModifier::Nullable>("booleanArg", params.arguments);
+	auto argBooleanArg = service::ModifiedArgument<bool>::require<service::TypeModifier::Nullable>("booleanArg", params);
 	std::unique_lock resolverLock(_resolverMutex);
 	auto directives = std::move(params.fieldDirectives);
 	auto result = _pimpl->getBooleanArgField(service::FieldParams(service::SelectionSetParams{ params }, std::move(directives)), std::move(argBooleanArg));
@@ -83,7 +83,7 @@ service::AwaitableResolver Arguments::resolveBooleanArgField(service::ResolverPa
 
 service::AwaitableResolver Arguments::resolveFloatArgField(service::ResolverParams&& params) const
 {
-	auto argFloatArg = service::ModifiedArgument<double>::require<service::TypeModifier::Nullable>("floatArg", params.arguments);
+	auto argFloatArg = service::ModifiedArgument<double>::require<service::TypeModifier::Nullable>("floatArg", params);
 	std::unique_lock resolverLock(_resolverMutex);
 	auto directives = std::move(params.fieldDirectives);
 	auto result = _pimpl->getFloatArgField(service::FieldParams(service::SelectionSetParams{ params }, std::move(directives)), std::move(argFloatArg));
@@ -94,7 +94,7 @@ service::AwaitableResolver Arguments::resolveFloatArgField(service::ResolverPara
 
 service::AwaitableResolver Arguments::resolveIntArgField(service::ResolverParams&& params) const
 {
-	auto argIntArg = service::ModifiedArgument<int>::require<service::TypeModifier::Nullable>("intArg", params.arguments);
+	auto argIntArg = service::ModifiedArgument<int>::require<service::TypeModifier::Nullable>("intArg", params);
 	std::unique_lock resolverLock(_resolverMutex);
 	auto directives = std::move(params.fieldDirectives);
 	auto result = _pimpl->getIntArgField(service::FieldParams(service::SelectionSetParams{ params }, std::move(directives)), std::move(argIntArg));
@@ -105,7 +105,7 @@ service::AwaitableResolver Arguments::resolveIntArgField(service::ResolverParams
 
 service::AwaitableResolver Arguments::resolveNonNullBooleanArgField(service::ResolverParams&& params) const
 {
-	auto argNonNullBooleanArg = service::ModifiedArgument<bool>::require("nonNullBooleanArg", params.arguments);
+	auto argNonNullBooleanArg = service::ModifiedArgument<bool>::require("nonNullBooleanArg", params);
 	std::unique_lock resolverLock(_resolverMutex);
 	auto directives = std::move(params.fieldDirectives);
 	auto result = _pimpl->getNonNullBooleanArgField(service::FieldParams(service::SelectionSetParams{ params }, std::move(directives)), std::move(argNonNullBooleanArg));
@@ -116,7 +116,7 @@ service::AwaitableResolver Arguments::resolveNonNullBooleanArgField(service::Res
 
 service::AwaitableResolver Arguments::resolveNonNullBooleanListField(service::ResolverParams&& params) const
 {
-	auto argNonNullBooleanListArg = service::ModifiedArgument<bool>::require<service::TypeModifier::Nullable, service::TypeModifier::List>("nonNullBooleanListArg", params.arguments);
+	auto argNonNullBooleanListArg = service::ModifiedArgument<bool>::require<service::TypeModifier::Nullable, service::TypeModifier::List>("nonNullBooleanListArg", params);
 	std::unique_lock resolverLock(_resolverMutex);
 	auto directives = std::move(params.fieldDirectives);
 	auto result = _pimpl->getNonNullBooleanListField(service::FieldParams(service::SelectionSetParams{ params }, std::move(directives)), std::move(argNonNullBooleanListArg));
@@ -127,7 +127,7 @@ service::AwaitableResolver Arguments::resolveNonNullBooleanListField(service::Re
 
 service::AwaitableResolver Arguments::resolveBooleanListArgField(service::ResolverParams&& params) const
 {
-	auto argBooleanListArg = service::ModifiedArgument<bool>::require<service::TypeModifier::List, service::TypeModifier::Nullable>("booleanListArg", params.arguments);
+	auto argBooleanListArg = service::ModifiedArgument<bool>::require<service::TypeModifier::List, service::TypeModifier::Nullable>("booleanListArg", params);
 	std::unique_lock resolverLock(_resolverMutex);
 	auto directives = std::move(params.fieldDirectives);
 	auto result = _pimpl->getBooleanListArgField(service::FieldParams(service::SelectionSetParams{ params }, std::move(directives)), std::move(argBooleanListArg));
@@ -149,7 +149,7 @@ service::AwaitableResolver Arguments::resolveOptionalNonNullBooleanArgField(serv
 		return values;
 	}();
 
-	auto pairOptionalBooleanArg = service::ModifiedArgument<bool>::find("optionalBooleanArg", params.arguments);
+	auto pairOptionalBooleanArg = service::ModifiedArgument<bool>::find("optionalBooleanArg", params);
 	auto argOptionalBooleanArg = (pairOptionalBooleanArg.second
 		? std::move(pairOptionalBooleanArg.first)
 		: service::ModifiedArgument<bool>::require("optionalBooleanArg", defaultArguments));
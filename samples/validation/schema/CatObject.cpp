@@ -78,7 +78,7 @@ service::AwaitableResolver Cat::resolveNickname(service::ResolverParams&& params
 
 service::AwaitableResolver Cat::resolveDoesKnowCommand(service::ResolverParams&& params) const
 {
-	auto argCatCommand = service::ModifiedArgument<CatCommand>::require("catCommand", params.arguments);
+	auto argCatCommand = service::ModifiedArgument<CatCommand>::require("catCommand", params);
 	std::unique_lock resolverLock(_resolverMutex);
 	auto directives = std::move(params.fieldDirectives);
 	auto result = _pimpl->getDoesKnowCommand(service::FieldParams(service::SelectionSetParams{ params }, std::move(directives)), std::move(argCatCommand));
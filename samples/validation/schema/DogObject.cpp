@@ -92,7 +92,7 @@ service::AwaitableResolver Dog::resolveBarkVolume(service::ResolverParams&& para
 
 service::AwaitableResolver Dog::resolveDoesKnowCommand(service::ResolverParams&& params) const
 {
-	auto argDogCommand = service::ModifiedArgument<DogCommand>::require("dogCommand", params.arguments);
+	auto argDogCommand = service::ModifiedArgument<DogCommand>::require("dogCommand", params);
 	std::unique_lock resolverLock(_resolverMutex);
 	auto directives = std::move(params.fieldDirectives);
 	auto result = _pimpl->getDoesKnowCommand(service::FieldParams(service::SelectionSetParams{ params }, std::move(directives)), std::move(argDogCommand));
@@ -103,7 +103,7 @@ service::AwaitableResolver Dog::resolveDoesKnowCommand(service::ResolverParams&&
 
 service::AwaitableResolver Dog::resolveIsHousetrained(service::ResolverParams&& params) const
 {
-	auto argAtOtherHomes = service::ModifiedArgument<bool>::require<service::TypeModifier::Nullable>("atOtherHomes", params.arguments);
+	auto argAtOtherHomes = service::ModifiedArgument<bool>::require<service::TypeModifier::Nullable>("atOtherHomes", params);
 	std::unique_lock resolverLock(_resolverMutex);
 	auto directives = std::move(params.fieldDirectives);
 	auto result = _pimpl->getIsHousetrained(service::FieldParams(service::SelectionSetParams{ params }, std::move(directives)), std::move(argAtOtherHomes));
@@ -27,10 +27,16 @@ namespace service {
 
 static const auto s_namesDogCommand = validation::getDogCommandNames();
 static const auto s_valuesDogCommand = validation::getDogCommandValues();
+static const auto s_enumNamesDogCommand = makeEnumNames(s_namesDogCommand);
 
 template <>
 validation::DogCommand Argument<validation::DogCommand>::convert(const response::Value& value)
 {
+	if (const auto index = findEnumName(s_enumNamesDogCommand, value))
+	{
+		return static_cast<validation::DogCommand>(*index);
+	}
+
 	if (!value.maybe_enum())
 	{
 		throw service::schema_exception { { R"ex(not a valid DogCommand value)ex" } };
@@ -54,17 +60,18 @@ service::AwaitableResolver Result<validation::DogCommand>::convert(service::Awai
 	return ModifiedResult<validation::DogCommand>::resolve(std::move(result), std::move(params),
 		[](validation::DogCommand value, const ResolverParams&)
 		{
-			response::Value result(response::Type::EnumValue);
-
-			result.set<std::string>(std::string { s_namesDogCommand[static_cast<size_t>(value)] });
-
-			return result;
+			return response::Value { response::EnumName { s_enumNamesDogCommand[static_cast<size_t>(value)] } };
 		});
 }
 
 template <>
 void Result<validation::DogCommand>::validateScalar(const response::Value& value)
 {
+	if (findEnumName(s_enumNamesDogCommand, value))
+	{
+		return;
+	}
+
 	if (!value.maybe_enum())
 	{
 		throw service::schema_exception { { R"ex(not a valid DogCommand value)ex" } };
@@ -83,10 +90,16 @@ void Result<validation::DogCommand>::validateScalar(const response::Value& value
 
 static const auto s_namesCatCommand = validation::getCatCommandNames();
 static const auto s_valuesCatCommand = validation::getCatCommandValues();
+static const auto s_enumNamesCatCommand = makeEnumNames(s_namesCatCommand);
 
 template <>
 validation::CatCommand Argument<validation::CatCommand>::convert(const response::Value& value)
 {
+	if (const auto index = findEnumName(s_enumNamesCatCommand, value))
+	{
+		return static_cast<validation::CatCommand>(*index);
+	}
+
 	if (!value.maybe_enum())
 	{
 		throw service::schema_exception { { R"ex(not a valid CatCommand value)ex" } };
@@ -110,17 +123,18 @@ service::AwaitableResolver Result<validation::CatCommand>::convert(service::Awai
 	return ModifiedResult<validation::CatCommand>::resolve(std::move(result), std::move(params),
 		[](validation::CatCommand value, const ResolverParams&)
 		{
-			response::Value result(response::Type::EnumValue);
-
-			result.set<std::string>(std::string { s_namesCatCommand[static_cast<size_t>(value)] });
-
-			return result;
+			return response::Value { response::EnumName { s_enumNamesCatCommand[static_cast<size_t>(value)] } };
 		});
 }
 
 template <>
 void Result<validation::CatCommand>::validateScalar(const response::Value& value)
 {
+	if (findEnumName(s_enumNamesCatCommand, value))
+	{
+		return;
+	}
+
 	if (!value.maybe_enum())
 	{
 		throw service::schema_exception { { R"ex(not a valid CatCommand value)ex" } };
@@ -140,8 +154,32 @@ void Result<validation::CatCommand>::validateScalar(const response::Value& value
 template <>
 validation::ComplexInput Argument<validation::ComplexInput>::convert(const response::Value& value)
 {
-	auto valueName = service::ModifiedArgument<std::string>::require<service::TypeModifier::Nullable>("name", value);
-	auto valueOwner = service::ModifiedArgument<std::string>::require<service::TypeModifier::Nullable>("owner", value);
+	const response::Value* memberName = nullptr;
+	const response::Value* memberOwner = nullptr;
+
+	for (const auto& [name, member] : value.get<response::MapType>())
+	{
+		switch (name.size())
+		{
+			case 4:
+				if (name == "name"sv)
+				{
+					memberName = &member;
+					continue;
+				}
+				break;
+			case 5:
+				if (name == "owner"sv)
+				{
+					memberOwner = &member;
+					continue;
+				}
+				break;
+		}
+	}
+
+	auto valueName = service::ModifiedArgument<std::string>::requireMember<service::TypeModifier::Nullable>("name", memberName);
+	auto valueOwner = service::ModifiedArgument<std::string>::requireMember<service::TypeModifier::Nullable>("owner", memberOwner);
 
 	return validation::ComplexInput {
 		std::move(valueName),
@@ -3,14 +3,520 @@
 
 #include "graphqlservice/internal/Base64.h"
 
+#include <algorithm>
 #include <array>
+#include <cstring>
 #include <stdexcept>
 
+// clang-format off
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+	#define GRAPHQL_BASE64_SIMD
+	#include <immintrin.h>
+	#ifdef _MSC_VER
+		#include <intrin.h>
+	#endif // _MSC_VER
+#endif // x86 or x64
+
+#if defined(GRAPHQL_BASE64_SIMD) && (defined(__GNUC__) || defined(__clang__))
+	#define GRAPHQL_BASE64_TARGET(isa) __attribute__((target(isa)))
+#else // !__GNUC__ && !__clang__
+	#define GRAPHQL_BASE64_TARGET(isa)
+#endif // !__GNUC__ && !__clang__
+// clang-format on
+
 namespace graphql::internal {
+namespace {
+
+#ifdef GRAPHQL_BASE64_SIMD
+
+enum class Base64Kernel
+{
+	Scalar,
+	SSE41,
+	AVX2,
+};
+
+Base64Kernel detectKernel() noexcept
+{
+#ifdef _MSC_VER
+	std::array<int, 4> info {};
+
+	__cpuid(info.data(), 0);
+
+	const int maxLeaf = info[0];
+
+	__cpuid(info.data(), 1);
+
+	const bool sse41 = (info[2] & (1 << 19)) != 0;
+	const bool osxsave = (info[2] & (1 << 27)) != 0;
+
+	if (maxLeaf >= 7 && osxsave && (_xgetbv(0) & 0x6) == 0x6)
+	{
+		__cpuidex(info.data(), 7, 0);
+
+		if ((info[1] & (1 << 5)) != 0)
+		{
+			return Base64Kernel::AVX2;
+		}
+	}
+
+	return sse41 ? Base64Kernel::SSE41 : Base64Kernel::Scalar;
+#else  // !_MSC_VER
+	__builtin_cpu_init();
+
+	if (__builtin_cpu_supports("avx2"))
+	{
+		return Base64Kernel::AVX2;
+	}
+
+	return __builtin_cpu_supports("sse4.1") ? Base64Kernel::SSE41 : Base64Kernel::Scalar;
+#endif // !_MSC_VER
+}
+
+Base64Kernel selectedKernel() noexcept
+{
+	static const auto kernel = detectKernel();
+
+	return kernel;
+}
+
+// The SIMD kernels follow Wojciech Muła's vectorized Base64 algorithms:
+// http://0x80.pl/notesen/2016-01-12-sse-base64-encoding.html
+// http://0x80.pl/notesen/2016-01-17-sse-base64-decoding.html
+// They only handle complete blocks of unpadded input, and they return how much of the input they
+// consumed so the scalar code can pick up the rest, including any padding or invalid characters.
+
+// Encode 12 bytes in each 16 byte lane to 16 Base64 characters. Each block reads 16 bytes.
+GRAPHQL_BASE64_TARGET("sse4.1")
+size_t encodeSSE41(const std::uint8_t* data, size_t count, char* output) noexcept
+{
+	const auto reshuffle = _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+	const auto shiftLUT = _mm_setr_epi8('a' - 26,
+		'0' - 52,
+		'0' - 52,
+		'0' - 52,
+		'0' - 52,
+		'0' - 52,
+		'0' - 52,
+		'0' - 52,
+		'0' - 52,
+		'0' - 52,
+		'0' - 52,
+		'+' - 62,
+		'/' - 63,
+		'A',
+		0,
+		0);
+	size_t consumed = 0;
+
+	for (; count - consumed >= 16; consumed += 12, output += 16)
+	{
+		const auto input = _mm_shuffle_epi8(
+			_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + consumed)),
+			reshuffle);
+		const auto indices = _mm_or_si128(
+			_mm_mulhi_epu16(_mm_and_si128(input, _mm_set1_epi32(0x0FC0FC00)),
+				_mm_set1_epi32(0x04000040)),
+			_mm_mullo_epi16(_mm_and_si128(input, _mm_set1_epi32(0x003F03F0)),
+				_mm_set1_epi32(0x01000010)));
+		const auto less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+		const auto range = _mm_or_si128(_mm_subs_epu8(indices, _mm_set1_epi8(51)),
+			_mm_and_si128(less, _mm_set1_epi8(13)));
+
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(output),
+			_mm_add_epi8(indices, _mm_shuffle_epi8(shiftLUT, range)));
+	}
+
+	return consumed;
+}
+
+// Encode 24 bytes to 32 Base64 characters, 12 bytes in each 128-bit lane. Each block reads 28
+// bytes.
+GRAPHQL_BASE64_TARGET("avx2")
+size_t encodeAVX2(const std::uint8_t* data, size_t count, char* output) noexcept
+{
+	const auto reshuffle = _mm256_setr_epi8(1,
+		0,
+		2,
+		1,
+		4,
+		3,
+		5,
+		4,
+		7,
+		6,
+		8,
+		7,
+		10,
+		9,
+		11,
+		10,
+		1,
+		0,
+		2,
+		1,
+		4,
+		3,
+		5,
+		4,
+		7,
+		6,
+		8,
+		7,
+		10,
+		9,
+		11,
+		10);
+	const auto shiftLUT = _mm256_setr_epi8('a' - 26,
+		'0' - 52,
+		'0' - 52,
+		'0' - 52,
+		'0' - 52,
+		'0' - 52,
+		'0' - 52,
+		'0' - 52,
+		'0' - 52,
+		'0' - 52,
+		'0' - 52,
+		'+' - 62,
+		'/' - 63,
+		'A',
+		0,
+		0,
+		'a' - 26,
+		'0' - 52,
+		'0' - 52,
+		'0' - 52,
+		'0' - 52,
+		'0' - 52,
+		'0' - 52,
+		'0' - 52,
+		'0' - 52,
+		'0' - 52,
+		'0' - 52,
+		'+' - 62,
+		'/' - 63,
+		'A',
+		0,
+		0);
+	size_t consumed = 0;
+
+	for (; count - consumed >= 28; consumed += 24, output += 32)
+	{
+		const auto low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + consumed));
+		const auto high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + consumed + 12));
+		const auto input =
+			_mm256_shuffle_epi8(_mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1),
+				reshuffle);
+		const auto indices = _mm256_or_si256(
+			_mm256_mulhi_epu16(_mm256_and_si256(input, _mm256_set1_epi32(0x0FC0FC00)),
+				_mm256_set1_epi32(0x04000040)),
+			_mm256_mullo_epi16(_mm256_and_si256(input, _mm256_set1_epi32(0x003F03F0)),
+				_mm256_set1_epi32(0x01000010)));
+		const auto less = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+		const auto range = _mm256_or_si256(_mm256_subs_epu8(indices, _mm256_set1_epi8(51)),
+			_mm256_and_si256(less, _mm256_set1_epi8(13)));
+
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(output),
+			_mm256_add_epi8(indices, _mm256_shuffle_epi8(shiftLUT, range)));
+	}
+
+	return consumed;
+}
+
+// Map 16 Base64 characters to their 6-bit values, or return false if any of them are not part of
+// the Base64 alphabet. Padding is not part of the alphabet either.
+GRAPHQL_BASE64_TARGET("sse4.1")
+inline bool toValuesSSE41(__m128i input, __m128i& values) noexcept
+{
+	const auto upper = _mm_and_si128(_mm_cmpgt_epi8(input, _mm_set1_epi8('A' - 1)),
+		_mm_cmplt_epi8(input, _mm_set1_epi8('Z' + 1)));
+	const auto lower = _mm_and_si128(_mm_cmpgt_epi8(input, _mm_set1_epi8('a' - 1)),
+		_mm_cmplt_epi8(input, _mm_set1_epi8('z' + 1)));
+	const auto digit = _mm_and_si128(_mm_cmpgt_epi8(input, _mm_set1_epi8('0' - 1)),
+		_mm_cmplt_epi8(input, _mm_set1_epi8('9' + 1)));
+	const auto plus = _mm_cmpeq_epi8(input, _mm_set1_epi8('+'));
+	const auto slash = _mm_cmpeq_epi8(input, _mm_set1_epi8('/'));
+	const auto valid =
+		_mm_or_si128(_mm_or_si128(_mm_or_si128(upper, lower), _mm_or_si128(digit, plus)), slash);
+
+	if (_mm_movemask_epi8(valid) != 0xFFFF)
+	{
+		return false;
+	}
+
+	const auto shift = _mm_or_si128(
+		_mm_or_si128(_mm_and_si128(upper, _mm_set1_epi8(-'A')),
+			_mm_and_si128(lower, _mm_set1_epi8(26 - 'a'))),
+		_mm_or_si128(_mm_and_si128(digit, _mm_set1_epi8(52 - '0')),
+			_mm_or_si128(_mm_and_si128(plus, _mm_set1_epi8(62 - '+')),
+				_mm_and_si128(slash, _mm_set1_epi8(63 - '/')))));
+
+	values = _mm_add_epi8(input, shift);
+	return true;
+}
+
+GRAPHQL_BASE64_TARGET("avx2")
+inline bool toValuesAVX2(__m256i input, __m256i& values) noexcept
+{
+	const auto upper = _mm256_and_si256(_mm256_cmpgt_epi8(input, _mm256_set1_epi8('A' - 1)),
+		_mm256_cmpgt_epi8(_mm256_set1_epi8('Z' + 1), input));
+	const auto lower = _mm256_and_si256(_mm256_cmpgt_epi8(input, _mm256_set1_epi8('a' - 1)),
+		_mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), input));
+	const auto digit = _mm256_and_si256(_mm256_cmpgt_epi8(input, _mm256_set1_epi8('0' - 1)),
+		_mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), input));
+	const auto plus = _mm256_cmpeq_epi8(input, _mm256_set1_epi8('+'));
+	const auto slash = _mm256_cmpeq_epi8(input, _mm256_set1_epi8('/'));
+	const auto valid = _mm256_or_si256(
+		_mm256_or_si256(_mm256_or_si256(upper, lower), _mm256_or_si256(digit, plus)),
+		slash);
+
+	if (_mm256_movemask_epi8(valid) != -1)
+	{
+		return false;
+	}
+
+	const auto shift = _mm256_or_si256(
+		_mm256_or_si256(_mm256_and_si256(upper, _mm256_set1_epi8(-'A')),
+			_mm256_and_si256(lower, _mm256_set1_epi8(26 - 'a'))),
+		_mm256_or_si256(_mm256_and_si256(digit, _mm256_set1_epi8(52 - '0')),
+			_mm256_or_si256(_mm256_and_si256(plus, _mm256_set1_epi8(62 - '+')),
+				_mm256_and_si256(slash, _mm256_set1_epi8(63 - '/')))));
+
+	values = _mm256_add_epi8(input, shift);
+	return true;
+}
+
+// Decode 16 Base64 characters at a time to 12 bytes.
+GRAPHQL_BASE64_TARGET("sse4.1")
+size_t decodeSSE41(const char* encoded, size_t length, std::uint8_t* output) noexcept
+{
+	const auto pack = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+	std::array<std::uint8_t, 16> block {};
+	size_t consumed = 0;
+
+	for (; length - consumed >= 16; consumed += 16, output += 12)
+	{
+		__m128i values;
+
+		if (!toValuesSSE41(_mm_loadu_si128(reinterpret_cast<const __m128i*>(encoded + consumed)),
+				values))
+		{
+			break;
+		}
+
+		// Merge each pair of 6-bit values into 12 bits, then each pair of those into 24 bits.
+		const auto merged = _mm_madd_epi16(_mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140)),
+			_mm_set1_epi32(0x00011000));
+
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(block.data()),
+			_mm_shuffle_epi8(merged, pack));
+		std::memcpy(output, block.data(), 12);
+	}
+
+	return consumed;
+}
+
+// Decode 32 Base64 characters at a time to 24 bytes.
+GRAPHQL_BASE64_TARGET("avx2")
+size_t decodeAVX2(const char* encoded, size_t length, std::uint8_t* output) noexcept
+{
+	const auto pack = _mm256_setr_epi8(2,
+		1,
+		0,
+		6,
+		5,
+		4,
+		10,
+		9,
+		8,
+		14,
+		13,
+		12,
+		-1,
+		-1,
+		-1,
+		-1,
+		2,
+		1,
+		0,
+		6,
+		5,
+		4,
+		10,
+		9,
+		8,
+		14,
+		13,
+		12,
+		-1,
+		-1,
+		-1,
+		-1);
+	std::array<std::uint8_t, 32> block {};
+	size_t consumed = 0;
+
+	for (; length - consumed >= 32; consumed += 32, output += 24)
+	{
+		__m256i values;
+
+		if (!toValuesAVX2(
+				_mm256_loadu_si256(reinterpret_cast<const __m256i*>(encoded + consumed)),
+				values))
+		{
+			break;
+		}
+
+		const auto merged =
+			_mm256_madd_epi16(_mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140)),
+				_mm256_set1_epi32(0x00011000));
+
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(block.data()),
+			_mm256_shuffle_epi8(merged, pack));
+		std::memcpy(output, block.data(), 12);
+		std::memcpy(output + 12, block.data() + 16, 12);
+	}
+
+	return consumed;
+}
+
+GRAPHQL_BASE64_TARGET("sse4.1")
+size_t validateSSE41(const char* encoded, size_t length) noexcept
+{
+	size_t consumed = 0;
+
+	for (; length - consumed >= 16; consumed += 16)
+	{
+		__m128i values;
+
+		if (!toValuesSSE41(_mm_loadu_si128(reinterpret_cast<const __m128i*>(encoded + consumed)),
+				values))
+		{
+			break;
+		}
+	}
+
+	return consumed;
+}
+
+GRAPHQL_BASE64_TARGET("avx2")
+size_t validateAVX2(const char* encoded, size_t length) noexcept
+{
+	size_t consumed = 0;
+
+	for (; length - consumed >= 32; consumed += 32)
+	{
+		__m256i values;
+
+		if (!toValuesAVX2(
+				_mm256_loadu_si256(reinterpret_cast<const __m256i*>(encoded + consumed)),
+				values))
+		{
+			break;
+		}
+	}
+
+	return consumed;
+}
+
+#endif // GRAPHQL_BASE64_SIMD
+
+// Encode as many complete blocks as the selected kernel can handle, and return the number of
+// bytes it consumed. That is always a multiple of 3, and it's 0 without SIMD support.
+size_t encodeBlocks([[maybe_unused]] const std::uint8_t* data, [[maybe_unused]] size_t count,
+	[[maybe_unused]] char* output) noexcept
+{
+#ifdef GRAPHQL_BASE64_SIMD
+	switch (selectedKernel())
+	{
+		case Base64Kernel::AVX2:
+		{
+			const auto consumed = encodeAVX2(data, count, output);
+
+			return consumed
+				+ encodeSSE41(data + consumed, count - consumed, output + consumed / 3 * 4);
+		}
+
+		case Base64Kernel::SSE41:
+			return encodeSSE41(data, count, output);
+
+		default:
+			break;
+	}
+#endif // GRAPHQL_BASE64_SIMD
+
+	return 0;
+}
+
+// Decode as many complete blocks of valid Base64 characters as the selected kernel can handle,
+// and return the number of characters it consumed. That is always a multiple of 4.
+size_t decodeBlocks([[maybe_unused]] const char* encoded, [[maybe_unused]] size_t length,
+	[[maybe_unused]] std::uint8_t* output) noexcept
+{
+#ifdef GRAPHQL_BASE64_SIMD
+	switch (selectedKernel())
+	{
+		case Base64Kernel::AVX2:
+		{
+			const auto consumed = decodeAVX2(encoded, length, output);
+
+			return consumed
+				+ decodeSSE41(encoded + consumed, length - consumed, output + consumed / 4 * 3);
+		}
+
+		case Base64Kernel::SSE41:
+			return decodeSSE41(encoded, length, output);
+
+		default:
+			break;
+	}
+#endif // GRAPHQL_BASE64_SIMD
+
+	return 0;
+}
+
+// Skip as many complete blocks of valid Base64 characters as the selected kernel can handle,
+// and return the number of characters it consumed. That is always a multiple of 4.
+size_t validateBlocks([[maybe_unused]] const char* encoded, [[maybe_unused]] size_t length) noexcept
+{
+#ifdef GRAPHQL_BASE64_SIMD
+	switch (selectedKernel())
+	{
+		case Base64Kernel::AVX2:
+		{
+			const auto consumed = validateAVX2(encoded, length);
+
+			return consumed + validateSSE41(encoded + consumed, length - consumed);
+		}
+
+		case Base64Kernel::SSE41:
+			return validateSSE41(encoded, length);
+
+		default:
+			break;
+	}
+#endif // GRAPHQL_BASE64_SIMD
+
+	return 0;
+}
+
+// Map every possible character to its 6-bit value, so the scalar loops only need a table lookup.
+constexpr auto c_fromBase64Table = []() noexcept {
+	std::array<std::uint8_t, 256> table {};
+
+	for (size_t i = 0; i < table.size(); ++i)
+	{
+		table[i] = Base64::fromBase64(static_cast<char>(i));
+	}
+
+	return table;
+}();
+
+} // namespace
 
 std::uint8_t Base64::verifyFromBase64(char ch)
 {
-	const std::uint8_t result = fromBase64(ch);
+	const std::uint8_t result = c_fromBase64Table[static_cast<unsigned char>(ch)];
 
 	if ((result & 0xC0) != 0)
 	{
@@ -29,9 +535,15 @@ std::vector<std::uint8_t> Base64::fromBase64(std::string_view encoded)
 		return result;
 	}
 
-	result.reserve((encoded.size() + (encoded.size() % 4)) * 3 / 4);
+	// Make room for every segment, including a partial one at the end, and trim it afterwards.
+	result.resize((encoded.size() + 3) / 4 * 3);
 
-	// First decode all of the full unpadded segments 24 bits at a time
+	const auto consumed = decodeBlocks(encoded.data(), encoded.size(), result.data());
+	auto output = result.data() + consumed / 4 * 3;
+
+	encoded.remove_prefix(consumed);
+
+	// Decode the rest of the full unpadded segments 24 bits at a time
 	while (encoded.size() >= 4 && encoded[3] != padding)
 	{
 		const uint32_t segment = (static_cast<uint32_t>(verifyFromBase64(encoded[0])) << 18)
@@ -39,11 +551,11 @@ std::vector<std::uint8_t> Base64::fromBase64(std::string_view encoded)
 			| (static_cast<uint32_t>(verifyFromBase64(encoded[2])) << 6)
 			| static_cast<uint32_t>(verifyFromBase64(encoded[3]));
 
-		result.emplace_back(static_cast<std::uint8_t>((segment & 0xFF0000) >> 16));
-		result.emplace_back(static_cast<std::uint8_t>((segment & 0xFF00) >> 8));
-		result.emplace_back(static_cast<std::uint8_t>(segment & 0xFF));
+		*output++ = static_cast<std::uint8_t>((segment & 0xFF0000) >> 16);
+		*output++ = static_cast<std::uint8_t>((segment & 0xFF00) >> 8);
+		*output++ = static_cast<std::uint8_t>(segment & 0xFF);
 
-		encoded = encoded.substr(4);
+		encoded.remove_prefix(4);
 	}
 
 	// Get any leftover partial segment with 2 or 3 non-padding characters
@@ -62,10 +574,10 @@ std::vector<std::uint8_t> Base64::fromBase64(std::string_view encoded)
 				throw std::logic_error { "invalid padding at the end of a base64 encoded string" };
 			}
 
-			result.emplace_back(static_cast<std::uint8_t>((segment & 0xFF00) >> 8));
-			result.emplace_back(static_cast<std::uint8_t>(segment & 0xFF));
+			*output++ = static_cast<std::uint8_t>((segment & 0xFF00) >> 8);
+			*output++ = static_cast<std::uint8_t>(segment & 0xFF);
 
-			encoded = encoded.substr(3);
+			encoded.remove_prefix(3);
 		}
 		else
 		{
@@ -74,9 +586,9 @@ std::vector<std::uint8_t> Base64::fromBase64(std::string_view encoded)
 				throw std::logic_error { "invalid padding at the end of a base64 encoded string" };
 			}
 
-			result.emplace_back(static_cast<std::uint8_t>((segment & 0xFF00) >> 8));
+			*output++ = static_cast<std::uint8_t>((segment & 0xFF00) >> 8);
 
-			encoded = encoded.substr(2);
+			encoded.remove_prefix(2);
 		}
 	}
 
@@ -87,6 +599,8 @@ std::vector<std::uint8_t> Base64::fromBase64(std::string_view encoded)
 		throw std::logic_error { "invalid padding at the end of a base64 encoded string" };
 	}
 
+	result.resize(static_cast<size_t>(output - result.data()));
+
 	return result;
 }
 
@@ -111,21 +625,32 @@ std::string Base64::toBase64(const std::vector<std::uint8_t>& bytes)
 		return result;
 	}
 
+	result.resize(encodedLength(bytes.size()));
+	toBase64(bytes, result.data());
+
+	return result;
+}
+
+void Base64::toBase64(const std::vector<std::uint8_t>& bytes, char* output)
+{
 	size_t count = bytes.size();
 	const std::uint8_t* data = bytes.data();
+	const auto consumed = encodeBlocks(data, count, output);
 
-	result.reserve((count + (count % 3)) * 4 / 3);
+	data += consumed;
+	count -= consumed;
+	output += consumed / 3 * 4;
 
-	// First encode all of the full unpadded segments 24 bits at a time
+	// Encode the rest of the full unpadded segments 24 bits at a time
 	while (count >= 3)
 	{
 		const uint32_t segment = (static_cast<uint32_t>(data[0]) << 16)
 			| (static_cast<uint32_t>(data[1]) << 8) | static_cast<uint32_t>(data[2]);
 
-		result.append({ verifyToBase64(static_cast<std::uint8_t>((segment & 0xFC0000) >> 18)),
-			verifyToBase64(static_cast<std::uint8_t>((segment & 0x3F000) >> 12)),
-			verifyToBase64(static_cast<std::uint8_t>((segment & 0xFC0) >> 6)),
-			verifyToBase64(static_cast<std::uint8_t>(segment & 0x3F)) });
+		*output++ = verifyToBase64(static_cast<std::uint8_t>((segment & 0xFC0000) >> 18));
+		*output++ = verifyToBase64(static_cast<std::uint8_t>((segment & 0x3F000) >> 12));
+		*output++ = verifyToBase64(static_cast<std::uint8_t>((segment & 0xFC0) >> 6));
+		*output++ = verifyToBase64(static_cast<std::uint8_t>(segment & 0x3F));
 
 		data += 3;
 		count -= 3;
@@ -137,16 +662,13 @@ std::string Base64::toBase64(const std::vector<std::uint8_t>& bytes)
 		const bool pair = (count > 1);
 		const uint16_t segment =
 			(static_cast<uint16_t>(data[0]) << 8) | (pair ? static_cast<uint16_t>(data[1]) : 0);
-		const std::array<char, 4> remainder { verifyToBase64(static_cast<std::uint8_t>(
-												  (segment & 0xFC00) >> 10)),
-			verifyToBase64(static_cast<std::uint8_t>((segment & 0x3F0) >> 4)),
-			(pair ? verifyToBase64(static_cast<std::uint8_t>((segment & 0xF) << 2)) : padding),
-			padding };
 
-		result.append(remainder.data(), remainder.size());
+		*output++ = verifyToBase64(static_cast<std::uint8_t>((segment & 0xFC00) >> 10));
+		*output++ = verifyToBase64(static_cast<std::uint8_t>((segment & 0x3F0) >> 4));
+		*output++ = (pair ? verifyToBase64(static_cast<std::uint8_t>((segment & 0xF) << 2))
+						  : padding);
+		*output = padding;
 	}
-
-	return result;
 }
 
 Base64::Comparison Base64::compareBase64(
@@ -167,14 +689,51 @@ Base64::Comparison Base64::compareBase64(
 	auto result = Comparison::EqualTo;
 	auto itr = bytes.cbegin();
 	const auto itrEnd = bytes.cend();
+	std::array<std::uint8_t, 48> block;
 
-	// First decode and compare all of the full unpadded segments 24 bits at a time
+	// Decode and compare as many complete blocks as the SIMD kernels can handle
+	while (maybeEncoded.size() >= block.size() / 3 * 4)
+	{
+		const auto consumed = decodeBlocks(maybeEncoded.data(), block.size() / 3 * 4, block.data());
+		const auto decoded = consumed / 4 * 3;
+		const auto compared = std::min(decoded, static_cast<size_t>(itrEnd - itr));
+		const auto blockEnd = block.cbegin() + static_cast<std::ptrdiff_t>(compared);
+		const auto mismatch = std::mismatch(block.cbegin(), blockEnd, itr);
+
+		maybeEncoded.remove_prefix(consumed);
+
+		if (mismatch.first != blockEnd)
+		{
+			result = *mismatch.second < *mismatch.first ? Comparison::LessThan
+														: Comparison::GreaterThan;
+		}
+		else if (compared < decoded)
+		{
+			result = Comparison::LessThan;
+		}
+
+		itr = mismatch.second;
+
+		if (Comparison::EqualTo != result)
+		{
+			// We only need to validate the rest of the string
+			maybeEncoded.remove_prefix(validateBlocks(maybeEncoded.data(), maybeEncoded.size()));
+			break;
+		}
+
+		if (consumed < block.size() / 3 * 4)
+		{
+			break;
+		}
+	}
+
+	// Decode and compare the rest of the full unpadded segments 24 bits at a time
 	while (maybeEncoded.size() >= 4 && maybeEncoded[3] != padding)
 	{
-		const auto a = fromBase64(maybeEncoded[0]);
-		const auto b = fromBase64(maybeEncoded[1]);
-		const auto c = fromBase64(maybeEncoded[2]);
-		const auto d = fromBase64(maybeEncoded[3]);
+		const auto a = c_fromBase64Table[static_cast<unsigned char>(maybeEncoded[0])];
+		const auto b = c_fromBase64Table[static_cast<unsigned char>(maybeEncoded[1])];
+		const auto c = c_fromBase64Table[static_cast<unsigned char>(maybeEncoded[2])];
+		const auto d = c_fromBase64Table[static_cast<unsigned char>(maybeEncoded[3])];
 
 		if (((a | b | c | d) & 0xC0) != 0)
 		{
@@ -209,7 +768,7 @@ Base64::Comparison Base64::compareBase64(
 			}
 		}
 
-		maybeEncoded = maybeEncoded.substr(4);
+		maybeEncoded.remove_prefix(4);
 	}
 
 	// Compare any leftover partial segment with 2 or 3 non-padding characters
@@ -253,7 +812,7 @@ Base64::Comparison Base64::compareBase64(
 				}
 			}
 
-			maybeEncoded = maybeEncoded.substr(3);
+			maybeEncoded.remove_prefix(3);
 		}
 		else
 		{
@@ -277,7 +836,7 @@ Base64::Comparison Base64::compareBase64(
 				++itr;
 			}
 
-			maybeEncoded = maybeEncoded.substr(2);
+			maybeEncoded.remove_prefix(2);
 		}
 	}
 
@@ -307,13 +866,16 @@ bool Base64::validateBase64(std::string_view maybeEncoded) noexcept
 		return true;
 	}
 
-	// First decode and compare all of the full unpadded segments 24 bits at a time
+	// Skip as many complete blocks of valid characters as the SIMD kernels can handle
+	maybeEncoded.remove_prefix(validateBlocks(maybeEncoded.data(), maybeEncoded.size()));
+
+	// Validate the rest of the full unpadded segments 24 bits at a time
 	while (maybeEncoded.size() >= 4 && maybeEncoded[3] != padding)
 	{
-		const auto a = fromBase64(maybeEncoded[0]);
-		const auto b = fromBase64(maybeEncoded[1]);
-		const auto c = fromBase64(maybeEncoded[2]);
-		const auto d = fromBase64(maybeEncoded[3]);
+		const auto a = c_fromBase64Table[static_cast<unsigned char>(maybeEncoded[0])];
+		const auto b = c_fromBase64Table[static_cast<unsigned char>(maybeEncoded[1])];
+		const auto c = c_fromBase64Table[static_cast<unsigned char>(maybeEncoded[2])];
+		const auto d = c_fromBase64Table[static_cast<unsigned char>(maybeEncoded[3])];
 
 		if (((a | b | c | d) & 0xC0) != 0)
 		{
@@ -321,7 +883,7 @@ bool Base64::validateBase64(std::string_view maybeEncoded) noexcept
 			return false;
 		}
 
-		maybeEncoded = maybeEncoded.substr(4);
+		maybeEncoded.remove_prefix(4);
 	}
 
 	// Compare any leftover partial segment with 2 or 3 non-padding characters
@@ -340,7 +902,7 @@ bool Base64::validateBase64(std::string_view maybeEncoded) noexcept
 
 		if (triplet)
 		{
-			maybeEncoded = maybeEncoded.substr(3);
+			maybeEncoded.remove_prefix(3);
 		}
 		else
 		{
@@ -353,7 +915,7 @@ bool Base64::validateBase64(std::string_view maybeEncoded) noexcept
 				return false;
 			}
 
-			maybeEncoded = maybeEncoded.substr(2);
+			maybeEncoded.remove_prefix(2);
 		}
 	}
 
@@ -0,0 +1,1194 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "graphqlservice/BinaryResponse.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+namespace graphql::response {
+namespace {
+
+// Destroying a Value recurses through its nested containers, so refuse to build anything deeper.
+constexpr size_t c_maxDepth = 512;
+
+// A container header can claim far more entries than it really has, so only reserve space for a
+// few of them up front and let the rest grow as the entries are added.
+constexpr size_t c_maxReserve = 64;
+
+template <typename T>
+void appendBigEndian(BinaryData& buffer, T value)
+{
+	for (size_t shift = sizeof(T) * 8; shift > 0; shift -= 8)
+	{
+		buffer.push_back(static_cast<std::uint8_t>(value >> (shift - 8)));
+	}
+}
+
+void appendString(BinaryData& buffer, const std::string& value)
+{
+	buffer.insert(buffer.end(), value.cbegin(), value.cend());
+}
+
+Value makeInt(std::int64_t value)
+{
+	if (value < std::numeric_limits<int>::min() || value > std::numeric_limits<int>::max())
+	{
+		// https://spec.graphql.org/October2021/#sec-Int
+		throw std::overflow_error("GraphQL only supports 32-bit signed integers");
+	}
+
+	return Value { static_cast<IntType>(value) };
+}
+
+Value makeUnsignedInt(std::uint64_t value)
+{
+	if (value > static_cast<std::uint64_t>(std::numeric_limits<int>::max()))
+	{
+		// https://spec.graphql.org/October2021/#sec-Int
+		throw std::overflow_error("GraphQL only supports 32-bit signed integers");
+	}
+
+	return Value { static_cast<IntType>(value) };
+}
+
+// Use the shorter single precision encoding when it does not lose anything. Converting a finite
+// double which is out of range for float is undefined, so check that first.
+std::optional<float> toSingle(double value) noexcept
+{
+	if (std::isfinite(value) && std::abs(value) > std::numeric_limits<float>::max())
+	{
+		return std::nullopt;
+	}
+
+	const auto single = static_cast<float>(value);
+
+	if (static_cast<double>(single) != value)
+	{
+		return std::nullopt;
+	}
+
+	return single;
+}
+
+Value makeEnumValue(std::string&& value)
+{
+	Value result { Type::EnumValue };
+
+	result.set<StringType>(std::move(value));
+
+	return result;
+}
+
+class BinaryReader
+{
+public:
+	explicit BinaryReader(const BinaryData& input) noexcept
+		: _input { input }
+	{
+	}
+
+	[[nodiscard]] bool done() const noexcept
+	{
+		return _position == _input.size();
+	}
+
+	[[nodiscard]] size_t remaining() const noexcept
+	{
+		return _input.size() - _position;
+	}
+
+	[[nodiscard]] std::uint8_t peek() const
+	{
+		require(1);
+		return _input[_position];
+	}
+
+	std::uint8_t readByte()
+	{
+		require(1);
+		return _input[_position++];
+	}
+
+	template <typename T>
+	[[nodiscard]] T readBigEndian()
+	{
+		static_assert(std::is_unsigned_v<T>, "read the unsigned value and cast it");
+
+		T value = 0;
+
+		require(sizeof(T));
+
+		for (size_t i = 0; i < sizeof(T); ++i)
+		{
+			value = static_cast<T>((value << 8) | _input[_position++]);
+		}
+
+		return value;
+	}
+
+	[[nodiscard]] std::string readString(size_t length)
+	{
+		require(length);
+
+		const auto itr = _input.cbegin() + static_cast<std::ptrdiff_t>(_position);
+		std::string result(itr, itr + static_cast<std::ptrdiff_t>(length));
+
+		_position += length;
+
+		return result;
+	}
+
+	[[nodiscard]] IdType::ByteData readBytes(size_t length)
+	{
+		require(length);
+
+		const auto itr = _input.cbegin() + static_cast<std::ptrdiff_t>(_position);
+		IdType::ByteData result(itr, itr + static_cast<std::ptrdiff_t>(length));
+
+		_position += length;
+
+		return result;
+	}
+
+private:
+	void require(size_t count) const
+	{
+		if (remaining() < count)
+		{
+			throw std::invalid_argument("Unexpected end of the binary response");
+		}
+	}
+
+	const BinaryData& _input;
+	size_t _position = 0;
+};
+
+// Build a Value out of SAX-style events, like the RapidJSON handler in JSONResponse.cpp does.
+// The binary formats prefix containers with their length, so this tracks how many entries are
+// left in each open container and closes it without waiting for an end event.
+class ResponseBuilder
+{
+public:
+	[[nodiscard]] bool complete() const noexcept
+	{
+		return _response.has_value();
+	}
+
+	[[nodiscard]] bool expectingKey() const noexcept
+	{
+		return !_stack.empty() && _stack.back().value.type() == Type::Map && !_key;
+	}
+
+	void addKey(std::string&& key)
+	{
+		_key = std::move(key);
+	}
+
+	void startContainer(Type type, size_t count, size_t available)
+	{
+		if (count == 0)
+		{
+			add(Value { type });
+			return;
+		}
+
+		requireDepth();
+
+		Value container { type };
+
+		// Every entry takes at least one byte, so don't trust a count that runs past the end.
+		container.reserve(std::min({ count, available, c_maxReserve }));
+		_stack.push_back({ std::move(container), count, false });
+	}
+
+	// CBOR containers may leave out the count and end with a break instead.
+	void startIndefiniteContainer(Type type)
+	{
+		requireDepth();
+		_stack.push_back({ Value { type }, 0, true });
+	}
+
+	void endContainer()
+	{
+		if (_stack.empty() || !_stack.back().indefinite || _key)
+		{
+			throw std::invalid_argument("Unexpected end of a container in the binary response");
+		}
+
+		auto container = std::move(_stack.back().value);
+
+		_stack.pop_back();
+		add(std::move(container));
+	}
+
+	void add(Value&& value)
+	{
+		while (!_stack.empty())
+		{
+			auto& container = _stack.back();
+
+			if (container.value.type() == Type::Map)
+			{
+				container.value.emplace_back(std::move(*_key), std::move(value));
+				_key.reset();
+			}
+			else
+			{
+				container.value.emplace_back(std::move(value));
+			}
+
+			if (container.indefinite || --container.remaining > 0)
+			{
+				return;
+			}
+
+			value = std::move(container.value);
+			_stack.pop_back();
+		}
+
+		_response = std::move(value);
+	}
+
+	[[nodiscard]] Value getResponse()
+	{
+		auto response = std::move(*_response);
+
+		_response.reset();
+
+		return response;
+	}
+
+private:
+	void requireDepth() const
+	{
+		if (_stack.size() >= c_maxDepth)
+		{
+			throw std::invalid_argument("Too many nested containers in the binary response");
+		}
+	}
+
+	struct Container
+	{
+		Value value;
+		size_t remaining;
+		bool indefinite;
+	};
+
+	std::vector<Container> _stack;
+	std::optional<std::string> _key;
+	std::optional<Value> _response;
+};
+
+// https://www.rfc-editor.org/rfc/rfc8949.html#name-major-types
+enum class CBORMajor : std::uint8_t
+{
+	Unsigned = 0,
+	Negative = 1,
+	Bytes = 2,
+	Text = 3,
+	Array = 4,
+	Map = 5,
+	Tag = 6,
+	Simple = 7,
+};
+
+constexpr std::uint8_t c_cborIndefinite = 31;
+constexpr std::uint8_t c_cborBreak = 0xFF;
+
+// Tags from the first come first served range which mark the text strings holding EnumValue and
+// opaque ID values. Other CBOR decoders can ignore them and read the text string.
+constexpr std::uint64_t c_cborEnumValueTag = 0xE700;
+constexpr std::uint64_t c_cborOpaqueIdTag = 0xE701;
+
+class CBORWriter
+{
+public:
+	explicit CBORWriter(BinaryData& buffer)
+		: _buffer { buffer }
+	{
+	}
+
+	void start_object(size_t count)
+	{
+		writeHeader(CBORMajor::Map, count);
+	}
+
+	void add_member(const std::string& key)
+	{
+		write_string(key);
+	}
+
+	void end_object()
+	{
+	}
+
+	void start_array(size_t count)
+	{
+		writeHeader(CBORMajor::Array, count);
+	}
+
+	void end_arrary()
+	{
+	}
+
+	void write_null()
+	{
+		_buffer.push_back(0xF6);
+	}
+
+	void write_string(const std::string& value)
+	{
+		writeHeader(CBORMajor::Text, value.size());
+		appendString(_buffer, value);
+	}
+
+	void write_enum(const std::string& value)
+	{
+		writeHeader(CBORMajor::Tag, c_cborEnumValueTag);
+		write_string(value);
+	}
+
+	void write_id(const IdType& value)
+	{
+		if (value.isByteData())
+		{
+			const auto& data = value.get<IdType::ByteData>();
+
+			writeHeader(CBORMajor::Bytes, data.size());
+			_buffer.insert(_buffer.end(), data.cbegin(), data.cend());
+		}
+		else
+		{
+			writeHeader(CBORMajor::Tag, c_cborOpaqueIdTag);
+			write_string(value.get<IdType::OpaqueString>());
+		}
+	}
+
+	void write_bool(bool value)
+	{
+		_buffer.push_back(value ? 0xF5 : 0xF4);
+	}
+
+	void write_int(int value)
+	{
+		if (value < 0)
+		{
+			const auto argument = static_cast<std::uint64_t>(-1 - std::int64_t { value });
+
+			writeHeader(CBORMajor::Negative, argument);
+		}
+		else
+		{
+			writeHeader(CBORMajor::Unsigned, static_cast<std::uint64_t>(value));
+		}
+	}
+
+	void write_float(double value)
+	{
+		if (const auto single = toSingle(value))
+		{
+			_buffer.push_back(0xFA);
+			appendBigEndian(_buffer, std::bit_cast<std::uint32_t>(*single));
+		}
+		else
+		{
+			_buffer.push_back(0xFB);
+			appendBigEndian(_buffer, std::bit_cast<std::uint64_t>(value));
+		}
+	}
+
+private:
+	void writeHeader(CBORMajor major, std::uint64_t argument)
+	{
+		const auto type = static_cast<std::uint8_t>(static_cast<std::uint8_t>(major) << 5);
+
+		if (argument < 24)
+		{
+			_buffer.push_back(static_cast<std::uint8_t>(type | argument));
+		}
+		else if (argument <= std::numeric_limits<std::uint8_t>::max())
+		{
+			_buffer.push_back(type | 24);
+			appendBigEndian(_buffer, static_cast<std::uint8_t>(argument));
+		}
+		else if (argument <= std::numeric_limits<std::uint16_t>::max())
+		{
+			_buffer.push_back(type | 25);
+			appendBigEndian(_buffer, static_cast<std::uint16_t>(argument));
+		}
+		else if (argument <= std::numeric_limits<std::uint32_t>::max())
+		{
+			_buffer.push_back(type | 26);
+			appendBigEndian(_buffer, static_cast<std::uint32_t>(argument));
+		}
+		else
+		{
+			_buffer.push_back(type | 27);
+			appendBigEndian(_buffer, argument);
+		}
+	}
+
+	BinaryData& _buffer;
+};
+
+class CBORReader
+{
+public:
+	explicit CBORReader(const BinaryData& cbor) noexcept
+		: _input { cbor }
+	{
+	}
+
+	[[nodiscard]] Value parse()
+	{
+		do
+		{
+			readItem();
+		} while (!_builder.complete());
+
+		if (!_input.done())
+		{
+			throw std::invalid_argument("Unexpected data after the CBOR response");
+		}
+
+		return _builder.getResponse();
+	}
+
+private:
+	void readItem()
+	{
+		const auto initial = _input.readByte();
+
+		if (initial == c_cborBreak)
+		{
+			if (_tag)
+			{
+				throw std::invalid_argument("Unexpected CBOR tag before a break");
+			}
+
+			_builder.endContainer();
+			return;
+		}
+
+		const auto major = static_cast<CBORMajor>(initial >> 5);
+		const auto info = static_cast<std::uint8_t>(initial & 0x1F);
+
+		if (major == CBORMajor::Tag)
+		{
+			_tag = readArgument(info);
+			return;
+		}
+
+		// Whatever this item is, the tag only applies to it and not to the next one.
+		const auto tag = _tag;
+
+		_tag.reset();
+
+		if (_builder.expectingKey())
+		{
+			if (major != CBORMajor::Text)
+			{
+				throw std::invalid_argument("CBOR map keys must be text strings");
+			}
+
+			_builder.addKey(readString(major, info));
+			return;
+		}
+
+		switch (major)
+		{
+			case CBORMajor::Unsigned:
+				_builder.add(makeUnsignedInt(readArgument(info)));
+				break;
+
+			case CBORMajor::Negative:
+			{
+				const auto argument = readArgument(info);
+
+				if (argument > static_cast<std::uint64_t>(std::numeric_limits<int>::max()))
+				{
+					// https://spec.graphql.org/October2021/#sec-Int
+					throw std::overflow_error("GraphQL only supports 32-bit signed integers");
+				}
+
+				_builder.add(
+					Value { static_cast<IntType>(-1 - static_cast<std::int64_t>(argument)) });
+				break;
+			}
+
+			case CBORMajor::Bytes:
+			{
+				const auto bytes = readString(major, info);
+				IdType::ByteData data { bytes.cbegin(), bytes.cend() };
+
+				_builder.add(Value { IdType { std::move(data) } });
+				break;
+			}
+
+			case CBORMajor::Text:
+			{
+				auto text = readString(major, info);
+
+				if (tag == c_cborEnumValueTag)
+				{
+					_builder.add(makeEnumValue(std::move(text)));
+				}
+				else if (tag == c_cborOpaqueIdTag)
+				{
+					_builder.add(Value { IdType { std::move(text) } });
+				}
+				else
+				{
+					_builder.add(Value { std::move(text) }.from_json());
+				}
+
+				break;
+			}
+
+			case CBORMajor::Array:
+			case CBORMajor::Map:
+			{
+				const auto type = (major == CBORMajor::Map) ? Type::Map : Type::List;
+
+				if (info == c_cborIndefinite)
+				{
+					_builder.startIndefiniteContainer(type);
+				}
+				else
+				{
+					_builder.startContainer(type,
+						static_cast<size_t>(readArgument(info)),
+						_input.remaining());
+				}
+
+				break;
+			}
+
+			case CBORMajor::Simple:
+				readSimple(info);
+				break;
+
+			default:
+				break;
+		}
+	}
+
+	[[nodiscard]] std::uint64_t readArgument(std::uint8_t info)
+	{
+		switch (info)
+		{
+			case 24:
+				return _input.readBigEndian<std::uint8_t>();
+
+			case 25:
+				return _input.readBigEndian<std::uint16_t>();
+
+			case 26:
+				return _input.readBigEndian<std::uint32_t>();
+
+			case 27:
+				return _input.readBigEndian<std::uint64_t>();
+
+			default:
+				if (info < 24)
+				{
+					return info;
+				}
+
+				throw std::invalid_argument("Invalid CBOR additional information");
+		}
+	}
+
+	// Read a byte or text string, concatenating the chunks of an indefinite length string.
+	[[nodiscard]] std::string readString(CBORMajor major, std::uint8_t info)
+	{
+		if (info != c_cborIndefinite)
+		{
+			return _input.readString(static_cast<size_t>(readArgument(info)));
+		}
+
+		std::string result;
+
+		while (_input.peek() != c_cborBreak)
+		{
+			const auto chunk = _input.readByte();
+
+			if (static_cast<CBORMajor>(chunk >> 5) != major
+				|| static_cast<std::uint8_t>(chunk & 0x1F) == c_cborIndefinite)
+			{
+				throw std::invalid_argument("Invalid chunk in an indefinite length CBOR string");
+			}
+
+			result.append(_input.readString(static_cast<size_t>(readArgument(chunk & 0x1F))));
+		}
+
+		static_cast<void>(_input.readByte());
+
+		return result;
+	}
+
+	void readSimple(std::uint8_t info)
+	{
+		switch (info)
+		{
+			case 20:
+				_builder.add(Value { false });
+				break;
+
+			case 21:
+				_builder.add(Value { true });
+				break;
+
+			case 22:
+			case 23:
+				_builder.add(Value {});
+				break;
+
+			case 25:
+				_builder.add(Value { decodeHalf(_input.readBigEndian<std::uint16_t>()) });
+				break;
+
+			case 26:
+				_builder.add(Value { static_cast<FloatType>(
+					std::bit_cast<float>(_input.readBigEndian<std::uint32_t>())) });
+				break;
+
+			case 27:
+				_builder.add(
+					Value { std::bit_cast<double>(_input.readBigEndian<std::uint64_t>()) });
+				break;
+
+			default:
+				throw std::invalid_argument("Unsupported CBOR simple value");
+		}
+	}
+
+	// https://www.rfc-editor.org/rfc/rfc8949.html#name-half-precision
+	[[nodiscard]] static FloatType decodeHalf(std::uint16_t half) noexcept
+	{
+		const int exponent = (half >> 10) & 0x1F;
+		const int mantissa = half & 0x3FF;
+		FloatType value;
+
+		if (exponent == 0)
+		{
+			value = std::ldexp(mantissa, -24);
+		}
+		else if (exponent != 31)
+		{
+			value = std::ldexp(mantissa + 1024, exponent - 25);
+		}
+		else
+		{
+			value = (mantissa == 0) ? std::numeric_limits<FloatType>::infinity()
+									: std::numeric_limits<FloatType>::quiet_NaN();
+		}
+
+		return (half & 0x8000) ? -value : value;
+	}
+
+	BinaryReader _input;
+	ResponseBuilder _builder;
+	std::optional<std::uint64_t> _tag;
+};
+
+// Application specific ext types which hold EnumValue and opaque ID values.
+constexpr std::uint8_t c_msgpackEnumValueExt = 1;
+constexpr std::uint8_t c_msgpackOpaqueIdExt = 2;
+
+class MessagePackWriter
+{
+public:
+	explicit MessagePackWriter(BinaryData& buffer)
+		: _buffer { buffer }
+	{
+	}
+
+	void start_object(size_t count)
+	{
+		writeHeader(count, 0x80, 0xDE, 0xDF);
+	}
+
+	void add_member(const std::string& key)
+	{
+		write_string(key);
+	}
+
+	void end_object()
+	{
+	}
+
+	void start_array(size_t count)
+	{
+		writeHeader(count, 0x90, 0xDC, 0xDD);
+	}
+
+	void end_arrary()
+	{
+	}
+
+	void write_null()
+	{
+		_buffer.push_back(0xC0);
+	}
+
+	void write_string(const std::string& value)
+	{
+		if (value.size() <= 31)
+		{
+			_buffer.push_back(static_cast<std::uint8_t>(0xA0 | value.size()));
+		}
+		else if (value.size() <= std::numeric_limits<std::uint8_t>::max())
+		{
+			_buffer.push_back(0xD9);
+			appendBigEndian(_buffer, static_cast<std::uint8_t>(value.size()));
+		}
+		else
+		{
+			writeLength(value.size(), 0xDA, 0xDB);
+		}
+
+		appendString(_buffer, value);
+	}
+
+	void write_enum(const std::string& value)
+	{
+		writeExt(c_msgpackEnumValueExt, value);
+	}
+
+	void write_id(const IdType& value)
+	{
+		if (value.isByteData())
+		{
+			const auto& data = value.get<IdType::ByteData>();
+
+			if (data.size() <= std::numeric_limits<std::uint8_t>::max())
+			{
+				_buffer.push_back(0xC4);
+				appendBigEndian(_buffer, static_cast<std::uint8_t>(data.size()));
+			}
+			else
+			{
+				writeLength(data.size(), 0xC5, 0xC6);
+			}
+
+			_buffer.insert(_buffer.end(), data.cbegin(), data.cend());
+		}
+		else
+		{
+			writeExt(c_msgpackOpaqueIdExt, value.get<IdType::OpaqueString>());
+		}
+	}
+
+	void write_bool(bool value)
+	{
+		_buffer.push_back(value ? 0xC3 : 0xC2);
+	}
+
+	void write_int(int value)
+	{
+		if (value >= 0)
+		{
+			if (value <= 0x7F)
+			{
+				_buffer.push_back(static_cast<std::uint8_t>(value));
+			}
+			else if (value <= std::numeric_limits<std::uint8_t>::max())
+			{
+				_buffer.push_back(0xCC);
+				appendBigEndian(_buffer, static_cast<std::uint8_t>(value));
+			}
+			else if (value <= std::numeric_limits<std::uint16_t>::max())
+			{
+				_buffer.push_back(0xCD);
+				appendBigEndian(_buffer, static_cast<std::uint16_t>(value));
+			}
+			else
+			{
+				_buffer.push_back(0xCE);
+				appendBigEndian(_buffer, static_cast<std::uint32_t>(value));
+			}
+		}
+		else if (value >= -32)
+		{
+			_buffer.push_back(static_cast<std::uint8_t>(value));
+		}
+		else if (value >= std::numeric_limits<std::int8_t>::min())
+		{
+			_buffer.push_back(0xD0);
+			appendBigEndian(_buffer, static_cast<std::uint8_t>(value));
+		}
+		else if (value >= std::numeric_limits<std::int16_t>::min())
+		{
+			_buffer.push_back(0xD1);
+			appendBigEndian(_buffer, static_cast<std::uint16_t>(value));
+		}
+		else
+		{
+			_buffer.push_back(0xD2);
+			appendBigEndian(_buffer, static_cast<std::uint32_t>(value));
+		}
+	}
+
+	void write_float(double value)
+	{
+		if (const auto single = toSingle(value))
+		{
+			_buffer.push_back(0xCA);
+			appendBigEndian(_buffer, std::bit_cast<std::uint32_t>(*single));
+		}
+		else
+		{
+			_buffer.push_back(0xCB);
+			appendBigEndian(_buffer, std::bit_cast<std::uint64_t>(value));
+		}
+	}
+
+private:
+	void writeHeader(size_t count, std::uint8_t fixed, std::uint8_t format16, std::uint8_t format32)
+	{
+		if (count <= 15)
+		{
+			_buffer.push_back(static_cast<std::uint8_t>(fixed | count));
+		}
+		else
+		{
+			writeLength(count, format16, format32);
+		}
+	}
+
+	void writeLength(size_t length, std::uint8_t format16, std::uint8_t format32)
+	{
+		if (length <= std::numeric_limits<std::uint16_t>::max())
+		{
+			_buffer.push_back(format16);
+			appendBigEndian(_buffer, static_cast<std::uint16_t>(length));
+		}
+		else
+		{
+			_buffer.push_back(format32);
+			appendBigEndian(_buffer, static_cast<std::uint32_t>(length));
+		}
+	}
+
+	void writeExt(std::uint8_t extType, const std::string& value)
+	{
+		switch (value.size())
+		{
+			case 1:
+				_buffer.push_back(0xD4);
+				break;
+
+			case 2:
+				_buffer.push_back(0xD5);
+				break;
+
+			case 4:
+				_buffer.push_back(0xD6);
+				break;
+
+			case 8:
+				_buffer.push_back(0xD7);
+				break;
+
+			case 16:
+				_buffer.push_back(0xD8);
+				break;
+
+			default:
+				if (value.size() <= std::numeric_limits<std::uint8_t>::max())
+				{
+					_buffer.push_back(0xC7);
+					appendBigEndian(_buffer, static_cast<std::uint8_t>(value.size()));
+				}
+				else
+				{
+					writeLength(value.size(), 0xC8, 0xC9);
+				}
+
+				break;
+		}
+
+		_buffer.push_back(extType);
+		appendString(_buffer, value);
+	}
+
+	BinaryData& _buffer;
+};
+
+class MessagePackReader
+{
+public:
+	explicit MessagePackReader(const BinaryData& msgpack) noexcept
+		: _input { msgpack }
+	{
+	}
+
+	[[nodiscard]] Value parse()
+	{
+		do
+		{
+			readItem();
+		} while (!_builder.complete());
+
+		if (!_input.done())
+		{
+			throw std::invalid_argument("Unexpected data after the MessagePack response");
+		}
+
+		return _builder.getResponse();
+	}
+
+private:
+	void readItem()
+	{
+		const auto format = _input.readByte();
+
+		if (_builder.expectingKey())
+		{
+			const auto length = readStringLength(format);
+
+			if (!length)
+			{
+				throw std::invalid_argument("MessagePack map keys must be strings");
+			}
+
+			_builder.addKey(_input.readString(*length));
+			return;
+		}
+
+		if (const auto length = readStringLength(format))
+		{
+			_builder.add(Value { _input.readString(*length) }.from_json());
+			return;
+		}
+
+		if (format <= 0x7F)
+		{
+			_builder.add(Value { static_cast<IntType>(format) });
+			return;
+		}
+		else if (format >= 0xE0)
+		{
+			_builder.add(Value { static_cast<IntType>(static_cast<std::int8_t>(format)) });
+			return;
+		}
+		else if (format <= 0x8F)
+		{
+			startContainer(Type::Map, format & 0x0F);
+			return;
+		}
+		else if (format <= 0x9F)
+		{
+			startContainer(Type::List, format & 0x0F);
+			return;
+		}
+
+		switch (format)
+		{
+			case 0xC0:
+				_builder.add(Value {});
+				break;
+
+			case 0xC2:
+				_builder.add(Value { false });
+				break;
+
+			case 0xC3:
+				_builder.add(Value { true });
+				break;
+
+			case 0xC4:
+				_builder.add(
+					Value { IdType { _input.readBytes(_input.readBigEndian<std::uint8_t>()) } });
+				break;
+
+			case 0xC5:
+				_builder.add(
+					Value { IdType { _input.readBytes(_input.readBigEndian<std::uint16_t>()) } });
+				break;
+
+			case 0xC6:
+				_builder.add(
+					Value { IdType { _input.readBytes(_input.readBigEndian<std::uint32_t>()) } });
+				break;
+
+			case 0xC7:
+				readExt(_input.readBigEndian<std::uint8_t>());
+				break;
+
+			case 0xC8:
+				readExt(_input.readBigEndian<std::uint16_t>());
+				break;
+
+			case 0xC9:
+				readExt(_input.readBigEndian<std::uint32_t>());
+				break;
+
+			case 0xCA:
+				_builder.add(Value { static_cast<FloatType>(
+					std::bit_cast<float>(_input.readBigEndian<std::uint32_t>())) });
+				break;
+
+			case 0xCB:
+				_builder.add(
+					Value { std::bit_cast<double>(_input.readBigEndian<std::uint64_t>()) });
+				break;
+
+			case 0xCC:
+				_builder.add(makeUnsignedInt(_input.readBigEndian<std::uint8_t>()));
+				break;
+
+			case 0xCD:
+				_builder.add(makeUnsignedInt(_input.readBigEndian<std::uint16_t>()));
+				break;
+
+			case 0xCE:
+				_builder.add(makeUnsignedInt(_input.readBigEndian<std::uint32_t>()));
+				break;
+
+			case 0xCF:
+				_builder.add(makeUnsignedInt(_input.readBigEndian<std::uint64_t>()));
+				break;
+
+			case 0xD0:
+				_builder.add(
+					makeInt(static_cast<std::int8_t>(_input.readBigEndian<std::uint8_t>())));
+				break;
+
+			case 0xD1:
+				_builder.add(
+					makeInt(static_cast<std::int16_t>(_input.readBigEndian<std::uint16_t>())));
+				break;
+
+			case 0xD2:
+				_builder.add(
+					makeInt(static_cast<std::int32_t>(_input.readBigEndian<std::uint32_t>())));
+				break;
+
+			case 0xD3:
+				_builder.add(
+					makeInt(static_cast<std::int64_t>(_input.readBigEndian<std::uint64_t>())));
+				break;
+
+			case 0xD4:
+			case 0xD5:
+			case 0xD6:
+			case 0xD7:
+			case 0xD8:
+				// fixext 1, 2, 4, 8 and 16
+				readExt(size_t { 1 } << (format - 0xD4));
+				break;
+
+			case 0xDC:
+				startContainer(Type::List, _input.readBigEndian<std::uint16_t>());
+				break;
+
+			case 0xDD:
+				startContainer(Type::List, _input.readBigEndian<std::uint32_t>());
+				break;
+
+			case 0xDE:
+				startContainer(Type::Map, _input.readBigEndian<std::uint16_t>());
+				break;
+
+			case 0xDF:
+				startContainer(Type::Map, _input.readBigEndian<std::uint32_t>());
+				break;
+
+			default:
+				throw std::invalid_argument("Invalid MessagePack format");
+		}
+	}
+
+	// Returns the length of a string in the str format family, or std::nullopt for anything else.
+	[[nodiscard]] std::optional<size_t> readStringLength(std::uint8_t format)
+	{
+		if ((format & 0xE0) == 0xA0)
+		{
+			return format & 0x1F;
+		}
+
+		switch (format)
+		{
+			case 0xD9:
+				return _input.readBigEndian<std::uint8_t>();
+
+			case 0xDA:
+				return _input.readBigEndian<std::uint16_t>();
+
+			case 0xDB:
+				return _input.readBigEndian<std::uint32_t>();
+
+			default:
+				return std::nullopt;
+		}
+	}
+
+	void startContainer(Type type, size_t count)
+	{
+		_builder.startContainer(type, count, _input.remaining());
+	}
+
+	void readExt(size_t length)
+	{
+		const auto extType = _input.readByte();
+		auto value = _input.readString(length);
+
+		switch (extType)
+		{
+			case c_msgpackEnumValueExt:
+				_builder.add(makeEnumValue(std::move(value)));
+				break;
+
+			case c_msgpackOpaqueIdExt:
+				_builder.add(Value { IdType { std::move(value) } });
+				break;
+
+			default:
+				throw std::invalid_argument("Unsupported MessagePack ext type");
+		}
+	}
+
+	BinaryReader _input;
+	ResponseBuilder _builder;
+};
+
+} // namespace
+
+BinaryData toCBOR(Value&& response)
+{
+	BinaryData buffer;
+	Writer writer { std::make_unique<CBORWriter>(buffer) };
+
+	writer.write(std::move(response));
+	return buffer;
+}
+
+Value parseCBOR(const BinaryData& cbor)
+{
+	return CBORReader { cbor }.parse();
+}
+
+BinaryData toMessagePack(Value&& response)
+{
+	BinaryData buffer;
+	Writer writer { std::make_unique<MessagePackWriter>(buffer) };
+
+	writer.write(std::move(response));
+	return buffer;
+}
+
+Value parseMessagePack(const BinaryData& msgpack)
+{
+	return MessagePackReader { msgpack }.parse();
+}
+
+} // namespace graphql::response
@@ -186,6 +186,7 @@ static_assert(graphql::internal::MinorVersion == )cpp"
 			   << graphql::internal::MinorVersion
 			   << R"cpp(, "regenerate with clientgen: minor version mismatch");
 
+#include <memory>
 #include <optional>
 #include <string>
 #include <vector>
@@ -424,6 +425,9 @@ using )cpp" << _schemaLoader.getSchemaNamespace()
 
 [[nodiscard]] Response parseResponse(response::Value&& response);
 
+// Parse the data directly into a Response with a ResponseVisitor, instead of parseResponse.
+[[nodiscard]] std::unique_ptr<ValueSink> makeResponseSink(Response& response);
+
 )cpp";
 
 		pendingSeparator.add();
@@ -937,6 +941,9 @@ response::Value Variable<)cpp"
 			}
 		}
 
+		outputResponseSinkImplementation(sourceFile, currentScope, responseType.fields);
+		pendingSeparator.add();
+
 		pendingSeparator.reset();
 
 		NamespaceScope operationNamespaceScope { sourceFile, getOperationNamespace(operation) };
@@ -981,25 +988,7 @@ Response parseResponse(response::Value&& response)
 		{
 )cpp";
 
-		std::unordered_set<std::string_view> fieldNames;
-
-		for (const auto& responseField : responseType.fields)
-		{
-			if (fieldNames.emplace(responseField.name).second)
-			{
-				sourceFile << R"cpp(			if (member.first == R"js()cpp" << responseField.name
-						   << R"cpp()js"sv)
-			{
-				result.)cpp"
-						   << responseField.cppName << R"cpp( = ModifiedResponse<)cpp"
-						   << getResponseFieldCppType(responseField, currentScope)
-						   << R"cpp(>::parse)cpp" << getTypeModifierList(responseField.modifiers)
-						   << R"cpp((std::move(member.second));
-				continue;
-			}
-)cpp";
-			}
-		}
+		outputResponseFieldDispatch(sourceFile, currentScope, responseType.fields);
 
 		sourceFile << R"cpp(		}
 	}
@@ -1007,6 +996,15 @@ Response parseResponse(response::Value&& response)
 	return result;
 }
 
+std::unique_ptr<ValueSink> makeResponseSink(Response& response)
+{
+	auto result = std::make_unique<ResponseSink<Response>>();
+
+	result->bind(response);
+
+	return result;
+}
+
 )cpp";
 
 		pendingSeparator.add();
@@ -1096,8 +1094,6 @@ bool Generator::outputModifiedResponseImplementation(std::ostream& sourceFile,
 			return false;
 	}
 
-	fieldNames.clear();
-
 	// This is a complex type that requires a custom ModifiedResponse implementation.
 	sourceFile << R"cpp(
 template <>
@@ -1115,44 +1111,183 @@ template <>
 		{
 )cpp";
 
-	switch (responseField.type->kind())
+	outputResponseFieldDispatch(sourceFile, cppType, responseField.children);
+
+	sourceFile << R"cpp(		}
+	}
+
+	return result;
+}
+)cpp";
+
+	outputResponseSinkImplementation(sourceFile, cppType, responseField.children);
+
+	return true;
+}
+
+std::map<size_t, std::vector<const ResponseField*>> Generator::getFieldsByLength(
+	const ResponseFieldList& fields) noexcept
+{
+	std::unordered_set<std::string_view> fieldNames;
+	std::map<size_t, std::vector<const ResponseField*>> fieldsByLength;
+
+	for (const auto& field : fields)
 	{
-		case introspection::TypeKind::OBJECT:
-		case introspection::TypeKind::INTERFACE:
-		case introspection::TypeKind::UNION:
+		if (fieldNames.emplace(field.name).second)
 		{
-			for (const auto& field : responseField.children)
-			{
-				if (fieldNames.emplace(field.name).second)
-				{
-					sourceFile << R"cpp(			if (member.first == R"js()cpp" << field.name
-							   << R"cpp()js"sv)
+			fieldsByLength[field.name.size()].push_back(&field);
+		}
+	}
+
+	return fieldsByLength;
+}
+
+void Generator::outputResponseFieldDispatch(std::ostream& sourceFile, const std::string& cppType,
+	const ResponseFieldList& fields) const noexcept
+{
+	const auto fieldsByLength = getFieldsByLength(fields);
+
+	if (fieldsByLength.empty())
+	{
+		return;
+	}
+
+	sourceFile << R"cpp(			switch (member.first.size())
 			{
-				result.)cpp" << field.cppName
-							   << R"cpp( = ModifiedResponse<)cpp"
-							   << getResponseFieldCppType(field, cppType) << R"cpp(>::parse)cpp"
-							   << getTypeModifierList(field.modifiers)
-							   << R"cpp((std::move(member.second));
-				continue;
-			}
 )cpp";
+
+	for (const auto& [length, bucket] : fieldsByLength)
+	{
+		sourceFile << R"cpp(				case )cpp" << length << R"cpp(:
+)cpp";
+
+		for (const auto field : bucket)
+		{
+			sourceFile << R"cpp(					if (member.first == R"js()cpp" << field->name
+					   << R"cpp()js"sv)
+					{
+						result.)cpp"
+					   << field->cppName << R"cpp( = ModifiedResponse<)cpp"
+					   << getResponseFieldCppType(*field, cppType) << R"cpp(>::parse)cpp"
+					   << getTypeModifierList(field->modifiers)
+					   << R"cpp((std::move(member.second));
+						continue;
+					}
+)cpp";
+		}
+
+		sourceFile << R"cpp(					break;
+)cpp";
+	}
+
+	sourceFile << R"cpp(			}
+)cpp";
+}
+
+void Generator::outputResponseSinkImplementation(std::ostream& sourceFile,
+	const std::string& cppType, const ResponseFieldList& fields) const noexcept
+{
+	// Bucket the member names by length, so each key only needs to be compared with the names
+	// which have the same length.
+	std::unordered_set<std::string_view> fieldNames;
+	std::vector<const ResponseField*> uniqueFields;
+	const auto fieldsByLength = getFieldsByLength(fields);
+
+	for (const auto& field : fields)
+	{
+		if (fieldNames.emplace(field.name).second)
+		{
+			uniqueFields.push_back(&field);
+		}
+	}
+
+	sourceFile << R"cpp(
+template <>
+class ResponseSink<)cpp"
+			   << cppType << R"cpp(>
+	: public ObjectSink<)cpp"
+			   << cppType << R"cpp(>
+{
+public:
+	ValueSink& add_member(std::string_view key) final
+	{
+)cpp";
+
+	if (!fieldsByLength.empty())
+	{
+		sourceFile << R"cpp(		switch (key.size())
+		{
+)cpp";
+
+		for (const auto& [length, bucket] : fieldsByLength)
+		{
+			sourceFile << R"cpp(			case )cpp" << length << R"cpp(:
+)cpp";
+
+			for (const auto field : bucket)
+			{
+				sourceFile << R"cpp(				if (key == R"js()cpp" << field->name
+						   << R"cpp()js"sv)
+				{
+					return _)cpp"
+						   << field->cppName << R"cpp(;
 				}
+)cpp";
 			}
-			break;
+
+			sourceFile << R"cpp(				break;
+)cpp";
 		}
 
-		default:
-			break;
+		sourceFile << R"cpp(		}
+
+)cpp";
 	}
 
-	sourceFile << R"cpp(		}
+	sourceFile << R"cpp(		return skip();
 	}
 
-	return result;
-}
+private:
+	void bindMembers()cpp"
+			   << cppType << R"cpp(&)cpp" << (uniqueFields.empty() ? "" : " result")
+			   << R"cpp() noexcept final
+	{
 )cpp";
 
-	return true;
+	for (const auto field : uniqueFields)
+	{
+		sourceFile << R"cpp(		_)cpp" << field->cppName << R"cpp(.bind(result.)cpp"
+				   << field->cppName << R"cpp();
+)cpp";
+	}
+
+	sourceFile << R"cpp(	}
+)cpp";
+
+	if (!uniqueFields.empty())
+	{
+		sourceFile << std::endl;
+	}
+
+	for (const auto field : uniqueFields)
+	{
+		const auto modifiers = getTypeModifierList(field->modifiers);
+
+		sourceFile << R"cpp(	ModifiedSink<)cpp" << getResponseFieldCppType(*field, cppType);
+
+		if (!modifiers.empty())
+		{
+			// Strip the angle brackets, these are the rest of the template arguments.
+			sourceFile << R"cpp(, )cpp"
+					   << std::string_view { modifiers }.substr(1, modifiers.size() - 2);
+		}
+
+		sourceFile << R"cpp(> _)cpp" << field->cppName << R"cpp(;
+)cpp";
+	}
+
+	sourceFile << R"cpp(};
+)cpp";
 }
 
 std::string Generator::getTypeModifierList(const TypeModifierStack& modifiers) noexcept
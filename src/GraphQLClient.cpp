@@ -164,6 +164,283 @@ ServiceResponse parseServiceResponse(response::Value response)
 	return result;
 }
 
+ValueSink::~ValueSink() = default;
+
+void ValueSink::add_null()
+{
+	throw std::logic_error { "unexpected null" };
+}
+
+void ValueSink::add_bool(bool /* value */)
+{
+	throw std::logic_error { "unexpected boolean" };
+}
+
+void ValueSink::add_int(int /* value */)
+{
+	throw std::logic_error { "unexpected integer" };
+}
+
+void ValueSink::add_float(double /* value */)
+{
+	throw std::logic_error { "unexpected float" };
+}
+
+void ValueSink::add_string(std::string&& /* value */)
+{
+	throw std::logic_error { "unexpected string" };
+}
+
+ValueSink& ValueSink::start_object()
+{
+	throw std::logic_error { "unexpected object" };
+}
+
+ValueSink& ValueSink::add_member(std::string_view /* key */)
+{
+	throw std::logic_error { "unexpected member" };
+}
+
+void ValueSink::end_object()
+{
+	throw std::logic_error { "unexpected end of object" };
+}
+
+ValueSink& ValueSink::start_array()
+{
+	throw std::logic_error { "unexpected list" };
+}
+
+ValueSink& ValueSink::add_element()
+{
+	throw std::logic_error { "unexpected element" };
+}
+
+void ValueSink::end_array()
+{
+	throw std::logic_error { "unexpected end of list" };
+}
+
+class SkipSink final : public ValueSink
+{
+public:
+	void add_null() final
+	{
+	}
+
+	void add_bool(bool /* value */) final
+	{
+	}
+
+	void add_int(int /* value */) final
+	{
+	}
+
+	void add_float(double /* value */) final
+	{
+	}
+
+	void add_string(std::string&& /* value */) final
+	{
+	}
+
+	ValueSink& start_object() final
+	{
+		return *this;
+	}
+
+	ValueSink& add_member(std::string_view /* key */) final
+	{
+		return *this;
+	}
+
+	void end_object() final
+	{
+	}
+
+	ValueSink& start_array() final
+	{
+		return *this;
+	}
+
+	ValueSink& add_element() final
+	{
+		return *this;
+	}
+
+	void end_array() final
+	{
+	}
+};
+
+ValueSink& ValueSink::skip() noexcept
+{
+	static SkipSink s_skip;
+
+	return s_skip;
+}
+
+// Split the members of a service response the same way as parseServiceResponse.
+class ServiceResponseSink final : public ValueSink
+{
+public:
+	ServiceResponseSink(ValueSink& data, ValueSink& errors) noexcept
+		: _data { data }
+		, _errors { errors }
+	{
+	}
+
+	void add_null() final
+	{
+	}
+
+	void add_bool(bool /* value */) final
+	{
+	}
+
+	void add_int(int /* value */) final
+	{
+	}
+
+	void add_float(double /* value */) final
+	{
+	}
+
+	void add_string(std::string&& /* value */) final
+	{
+	}
+
+	ValueSink& start_object() final
+	{
+		return *this;
+	}
+
+	ValueSink& add_member(std::string_view key) final
+	{
+		if (key == "data"sv)
+		{
+			return _data;
+		}
+
+		if (key == "errors"sv)
+		{
+			return _errors;
+		}
+
+		return skip();
+	}
+
+	void end_object() final
+	{
+	}
+
+	ValueSink& start_array() final
+	{
+		return skip();
+	}
+
+private:
+	ValueSink& _data;
+	ValueSink& _errors;
+};
+
+ResponseVisitor::ResponseVisitor(std::unique_ptr<ValueSink> data)
+	: _data { std::move(data) }
+	, _document { std::make_unique<ServiceResponseSink>(*_data, _errorsSink) }
+{
+	_errorsSink.bind(_errors);
+}
+
+ResponseVisitor::~ResponseVisitor() = default;
+
+ValueSink& ResponseVisitor::next()
+{
+	if (_containers.empty())
+	{
+		return *_document;
+	}
+
+	const auto& container = _containers.back();
+
+	return container.list ? container.sink->add_element() : *_member;
+}
+
+void ResponseVisitor::add_null()
+{
+	next().add_null();
+}
+
+void ResponseVisitor::add_bool(bool value)
+{
+	next().add_bool(value);
+}
+
+void ResponseVisitor::add_int(int value)
+{
+	next().add_int(value);
+}
+
+void ResponseVisitor::add_float(double value)
+{
+	next().add_float(value);
+}
+
+void ResponseVisitor::add_string(std::string&& value)
+{
+	next().add_string(std::move(value));
+}
+
+void ResponseVisitor::start_object()
+{
+	auto& members = next().start_object();
+
+	_containers.push_back({ &members, false });
+}
+
+void ResponseVisitor::add_member(std::string_view key)
+{
+	_member = &_containers.back().sink->add_member(key);
+}
+
+void ResponseVisitor::end_object()
+{
+	_containers.back().sink->end_object();
+	_containers.pop_back();
+}
+
+void ResponseVisitor::start_array()
+{
+	auto& elements = next().start_array();
+
+	_containers.push_back({ &elements, true });
+}
+
+void ResponseVisitor::end_array()
+{
+	_containers.back().sink->end_array();
+	_containers.pop_back();
+}
+
+std::vector<Error> ResponseVisitor::errors()
+{
+	std::vector<Error> result;
+
+	if (_errors.type() == response::Type::List)
+	{
+		auto errors = _errors.release<response::ListType>();
+
+		result.reserve(errors.size());
+		std::transform(errors.begin(),
+			errors.end(),
+			std::back_inserter(result),
+			[](response::Value& error) {
+				return parseServiceError(std::move(error));
+			});
+	}
+
+	return result;
+}
+
 template <>
 response::Value Variable<int>::serialize(int&& value)
 {
@@ -152,6 +152,11 @@ bool IdType::isBase64() const noexcept
 		|| internal::Base64::validateBase64(std::get<OpaqueString>(_data));
 }
 
+bool IdType::isByteData() const noexcept
+{
+	return std::holds_alternative<ByteData>(_data);
+}
+
 bool IdType::empty() const noexcept
 {
 	return std::visit(
@@ -516,6 +521,16 @@ bool Value::NullData::operator==(const NullData&) const
 	return true;
 }
 
+bool Value::EnumData::operator==(const EnumData& rhs) const
+{
+	return name() == rhs.name();
+}
+
+const StringType& Value::EnumData::name() const noexcept
+{
+	return borrowed ? *borrowed : value;
+}
+
 bool Value::ScalarData::operator==(const ScalarData& rhs) const
 {
 	if (scalar && rhs.scalar)
@@ -536,7 +551,7 @@ void Value::set<StringType>(StringType&& value)
 
 	if (std::holds_alternative<EnumData>(_data))
 	{
-		std::get<EnumData>(_data) = std::move(value);
+		std::get<EnumData>(_data) = { std::move(value) };
 	}
 	else if (std::holds_alternative<IdType>(_data))
 	{
@@ -688,7 +703,7 @@ const StringType& Value::get<StringType>() const
 
 	if (std::holds_alternative<EnumData>(typeData))
 	{
-		return std::get<EnumData>(typeData);
+		return std::get<EnumData>(typeData).name();
 	}
 	else if (std::holds_alternative<IdType>(typeData))
 	{
@@ -846,7 +861,11 @@ StringType Value::release<StringType>()
 
 	if (std::holds_alternative<EnumData>(_data))
 	{
-		result = std::move(std::get<EnumData>(_data));
+		auto& enumData = std::get<EnumData>(_data);
+
+		// A borrowed name can't be moved, so the caller gets a copy.
+		result = enumData.borrowed ? *enumData.borrowed : std::move(enumData.value);
+		enumData.borrowed = nullptr;
 	}
 	else if (std::holds_alternative<IdType>(_data))
 	{
@@ -1030,6 +1049,11 @@ Value::Value(CustomType&& value)
 {
 }
 
+Value::Value(EnumName value) noexcept
+	: _data(TypeData { EnumData { {}, &value.name } })
+{
+}
+
 Value::Value(Value&& other) noexcept
 	: _data(std::move(other._data))
 {
@@ -1109,7 +1133,7 @@ Value::Value(const Value& other)
 			break;
 
 		case Type::EnumValue:
-			_data = { EnumData { other.get<StringType>() } };
+			_data = { EnumData { std::get<EnumData>(other._data) } };
 			break;
 
 		case Type::ID:
@@ -1121,9 +1145,12 @@ Value::Value(const Value& other)
 			break;
 			
 		case Type::Custom:
-			 std::logic_error("CustomType is not copyable");
-			_data = { CustomType { nullptr } };
+		{
+			const auto& custom = other.get<CustomType>();
+
+			_data = { custom ? custom->clone() : CustomType {} };
 			break;
+		}
 	}
 }
 
@@ -1221,7 +1248,7 @@ bool Value::operator==(const Value& rhs) const noexcept
 					{
 						const auto& enumData = std::get<EnumData>(rhsData);
 
-						return stringData.string == enumData;
+						return stringData.string == enumData.name();
 					}
 				}
 				else if (std::holds_alternative<IdType>(rhsData))
@@ -1247,7 +1274,7 @@ bool Value::operator==(const Value& rhs) const noexcept
 
 					if (stringData.from_json)
 					{
-						return enumData == stringData.string;
+						return enumData.name() == stringData.string;
 					}
 				}
 
@@ -1276,6 +1303,16 @@ bool Value::operator==(const Value& rhs) const noexcept
 		}
 	}
 
+	if (lhsType == Type::Custom)
+	{
+		// Compare the custom values instead of the pointers which own them.
+		const auto& lhsCustom = std::get<CustomType>(lhsData);
+		const auto& rhsCustom = std::get<CustomType>(rhsData);
+
+		return (!lhsCustom || !rhsCustom) ? lhsCustom == rhsCustom
+										  : lhsCustom->equals(*rhsCustom);
+	}
+
 	return lhsData == rhsData;
 }
 
@@ -1331,6 +1368,14 @@ bool Value::maybe_id() const noexcept
 	return false;
 }
 
+const StringType* Value::borrowed_enum() const noexcept
+{
+	const auto& typeData = data();
+
+	return std::holds_alternative<EnumData>(typeData) ? std::get<EnumData>(typeData).borrowed
+													  : nullptr;
+}
+
 void Value::reserve(size_t count)
 {
 	if (std::holds_alternative<SharedData>(_data))
@@ -1504,13 +1549,20 @@ const Value& Value::operator[](size_t index) const
 
 void Writer::write(Value response) const
 {
+	if (std::holds_alternative<Value::SharedData>(response._data))
+	{
+		// Releasing the contents of a shared Value would need to copy them first.
+		writeShared(*std::get<Value::SharedData>(response._data));
+		return;
+	}
+
 	switch (response.type())
 	{
 		case Type::Map:
 		{
 			auto members = response.release<MapType>();
 
-			_concept->start_object();
+			_concept->start_object(members.size());
 
 			for (auto& entry : members)
 			{
@@ -1526,7 +1578,7 @@ void Writer::write(Value response) const
 		{
 			auto elements = response.release<ListType>();
 
-			_concept->start_array();
+			_concept->start_array(elements.size());
 
 			for (auto& entry : elements)
 			{
@@ -1538,8 +1590,6 @@ void Writer::write(Value response) const
 		}
 
 		case Type::String:
-		case Type::EnumValue:
-		case Type::ID:
 		{
 			auto value = response.release<StringType>();
 
@@ -1547,6 +1597,25 @@ void Writer::write(Value response) const
 			break;
 		}
 
+		case Type::EnumValue:
+		{
+			// Write the name in place, it might be borrowed from a static table of enum names.
+			_concept->write_enum(std::get<Value::EnumData>(response._data).name());
+			break;
+		}
+
+		case Type::ID:
+		{
+			auto value = response.release<IdType>();
+
+			if (!_concept->write_id(value))
+			{
+				_concept->write_string(value.release<IdType::OpaqueString>());
+			}
+
+			break;
+		}
+
 		case Type::Null:
 		{
 			_concept->write_null();
@@ -1577,6 +1646,12 @@ void Writer::write(Value response) const
 			break;
 		}
 
+		case Type::Custom:
+		{
+			writeCustom(response.get<CustomType>());
+			break;
+		}
+
 		default:
 		{
 			_concept->write_null();
@@ -1585,4 +1660,130 @@ void Writer::write(Value response) const
 	}
 }
 
+void Writer::writeShared(const Value& response) const
+{
+	switch (response.type())
+	{
+		case Type::Map:
+		{
+			const auto& members = response.get<MapType>();
+
+			_concept->start_object(members.size());
+
+			for (const auto& entry : members)
+			{
+				_concept->add_member(entry.first);
+				writeShared(entry.second);
+			}
+
+			_concept->end_object();
+			break;
+		}
+
+		case Type::List:
+		{
+			const auto& elements = response.get<ListType>();
+
+			_concept->start_array(elements.size());
+
+			for (const auto& entry : elements)
+			{
+				writeShared(entry);
+			}
+
+			_concept->end_arrary();
+			break;
+		}
+
+		case Type::String:
+		{
+			_concept->write_string(response.get<StringType>());
+			break;
+		}
+
+		case Type::EnumValue:
+		{
+			_concept->write_enum(response.get<StringType>());
+			break;
+		}
+
+		case Type::ID:
+		{
+			write_id(response.get<IdType>());
+			break;
+		}
+
+		case Type::Null:
+		{
+			_concept->write_null();
+			break;
+		}
+
+		case Type::Boolean:
+		{
+			_concept->write_bool(response.get<BooleanType>());
+			break;
+		}
+
+		case Type::Int:
+		{
+			_concept->write_int(response.get<IntType>());
+			break;
+		}
+
+		case Type::Float:
+		{
+			_concept->write_float(response.get<FloatType>());
+			break;
+		}
+
+		case Type::Scalar:
+		{
+			writeShared(response.get<ScalarType>());
+			break;
+		}
+
+		case Type::Custom:
+		{
+			writeCustom(response.get<CustomType>());
+			break;
+		}
+
+		default:
+		{
+			_concept->write_null();
+			break;
+		}
+	}
+}
+
+void Writer::writeCustom(const CustomType& custom) const
+{
+	if (custom)
+	{
+		custom->write(*this);
+	}
+	else
+	{
+		_concept->write_null();
+	}
+}
+
+void Writer::write_id(const IdType& value) const
+{
+	if (_concept->write_id(value))
+	{
+		return;
+	}
+
+	if (value.isByteData())
+	{
+		_concept->write_string(internal::Base64::toBase64(value.get<IdType::ByteData>()));
+	}
+	else
+	{
+		_concept->write_string(value.get<IdType::OpaqueString>());
+	}
+}
+
 } // namespace graphql::response
@@ -9,7 +9,11 @@
 
 #include <algorithm>
 #include <array>
+#include <charconv>
 #include <iostream>
+#include <shared_mutex>
+#include <system_error>
+#include <tuple>
 
 namespace graphql::service {
 
@@ -67,30 +71,12 @@ void addErrorPath(const error_path& path, response::Value& error)
 	error.emplace_back(std::string { strPath }, std::move(errorPath));
 }
 
-error_path buildErrorPath(const std::optional<field_path>& path)
+void prependErrorPath(std::list<schema_error>& errors, path_segment segment)
 {
-	error_path result;
-
-	if (path)
+	for (auto& error : errors)
 	{
-		std::list<std::reference_wrapper<const path_segment>> segments;
-
-		for (auto segment = std::make_optional(std::cref(*path)); segment;
-			 segment = segment->get().parent)
-		{
-			segments.push_front(std::cref(segment->get().segment));
-		}
-
-		result.reserve(segments.size());
-		std::transform(segments.cbegin(),
-			segments.cend(),
-			std::back_inserter(result),
-			[](const auto& segment) noexcept {
-				return segment.get();
-			});
+		error.path.insert(error.path.begin(), segment);
 	}
-
-	return result;
 }
 
 response::Value buildErrorValues(std::list<schema_error>&& structuredErrors)
@@ -367,7 +353,25 @@ void ValueVisitor::visitVariable(const peg::ast_node& variable)
 
 void ValueVisitor::visitIntValue(const peg::ast_node& intValue)
 {
-	_value = response::Value(std::atoi(intValue.string().c_str()));
+	const auto text = intValue.string_view();
+	int value = 0;
+
+	const auto result = std::from_chars(text.data(), text.data() + text.size(), value);
+
+	if (result.ec == std::errc::result_out_of_range)
+	{
+		// https://spec.graphql.org/October2021/#sec-Int
+		auto position = intValue.begin();
+		std::ostringstream error;
+
+		error << "Int value out of range: " << text;
+
+		throw schema_exception {
+			{ schema_error { error.str(), { position.line, position.column } } }
+		};
+	}
+
+	_value = response::Value(value);
 }
 
 void ValueVisitor::visitFloatValue(const peg::ast_node& floatValue)
@@ -453,12 +457,7 @@ void DirectiveVisitor::visit(const peg::ast_node& directives)
 
 	for (const auto& directive : directives.children)
 	{
-		std::string_view directiveName;
-
-		peg::on_first_child<peg::directive_name>(*directive,
-			[&directiveName](const peg::ast_node& child) {
-				directiveName = child.string_view();
-			});
+		const auto directiveName = peg::first_child_view<peg::directive_name>(*directive);
 
 		if (directiveName.empty())
 		{
@@ -467,18 +466,18 @@ void DirectiveVisitor::visit(const peg::ast_node& directives)
 
 		response::Value directiveArguments(response::Type::Map);
 
-		peg::on_first_child<peg::arguments>(*directive,
-			[this, &directiveArguments](const peg::ast_node& child) {
-				ValueVisitor visitor(_variables);
+		if (const auto arguments = peg::first_child<peg::arguments>(*directive))
+		{
+			ValueVisitor visitor(_variables);
 
-				for (auto& argument : child.children)
-				{
-					visitor.visit(*argument->children.back());
+			for (auto& argument : arguments->children)
+			{
+				visitor.visit(*argument->children.back());
 
-					directiveArguments.emplace_back(argument->children.front()->string(),
-						visitor.getValue());
-				}
-			});
+				directiveArguments.emplace_back(argument->children.front()->string(),
+					visitor.getValue());
+			}
+		}
 
 		result.emplace_back(directiveName, std::move(directiveArguments));
 	}
@@ -570,13 +569,13 @@ Fragment::Fragment(const peg::ast_node& fragmentDefinition, const response::Valu
 	: _type(fragmentDefinition.children[1]->children.front()->string_view())
 	, _selection(*(fragmentDefinition.children.back()))
 {
-	peg::on_first_child<peg::directives>(fragmentDefinition,
-		[this, &variables](const peg::ast_node& child) {
-			DirectiveVisitor directiveVisitor(variables);
+	if (const auto directives = peg::first_child<peg::directives>(fragmentDefinition))
+	{
+		DirectiveVisitor directiveVisitor(variables);
 
-			directiveVisitor.visit(child);
-			_directives = directiveVisitor.getDirectives();
-		});
+		directiveVisitor.visit(*directives);
+		_directives = directiveVisitor.getDirectives();
+	}
 }
 
 std::string_view Fragment::getType() const
@@ -616,6 +615,20 @@ schema_location ResolverParams::getLocation() const
 	return { position.line, position.column };
 }
 
+ResolverResult buildFieldError(schema_error&& error, const ResolverParams& params)
+{
+	ResolverResult document;
+
+	if (error.location.line == 0)
+	{
+		error.location = params.getLocation();
+	}
+
+	document.errors.push_back(std::move(error));
+
+	return document;
+}
+
 template <>
 int Argument<int>::convert(const response::Value& value)
 {
@@ -688,8 +701,7 @@ void blockSubFields(const ResolverParams& params)
 		error << "Field may not have sub-fields name: " << params.fieldName;
 
 		throw schema_exception { { schema_error { error.str(),
-			{ position.line, position.column },
-			buildErrorPath(params.errorPath) } } };
+			{ position.line, position.column } } } };
 	}
 }
 
@@ -779,8 +791,7 @@ void requireSubFields(const ResolverParams& params)
 		error << "Field must have sub-fields name: " << params.fieldName;
 
 		throw schema_exception { { schema_error { error.str(),
-			{ position.line, position.column },
-			buildErrorPath(params.errorPath) } } };
+			{ position.line, position.column } } } };
 	}
 }
 
@@ -790,6 +801,11 @@ AwaitableResolver Result<Object>::convert(
 {
 	requireSubFields(params);
 
+	if (auto error = result.get_error())
+	{
+		co_return buildFieldError(std::move(*error), params);
+	}
+
 	co_await params.launch;
 
 	auto awaitedResult = co_await std::move(result);
@@ -858,6 +874,134 @@ void Result<response::Value>::validateScalar(const response::Value&)
 	// Any response::Value is valid for a custom scalar type.
 }
 
+// FieldArgumentCache coerces the arguments for each field once per operation. The variables do not
+// change for the rest of the operation, so every resolver for the same field, e.g. for each object
+// in a list, can share the same immutable response::Value.
+class FieldArgumentCache
+{
+public:
+	[[nodiscard]] static response::Value visit(
+		const peg::ast_node& arguments, const response::Value& variables);
+
+	[[nodiscard]] response::Value find(
+		const peg::ast_node& arguments, const response::Value& variables);
+
+	// The converted arguments are keyed on the coerced arguments they came from, so they are only
+	// cached for arguments which find returned.
+	[[nodiscard]] std::shared_ptr<const void> findConverted(
+		const response::Value& arguments, std::string_view name, std::type_index type);
+	[[nodiscard]] std::shared_ptr<const void> cacheConverted(const response::Value& arguments,
+		std::string_view name, std::type_index type, std::shared_ptr<const void> value);
+
+private:
+	using ConvertedKey = std::tuple<const response::MapType*, std::string, std::type_index>;
+
+	[[nodiscard]] static const response::MapType* getCachedMap(const response::Value& arguments);
+
+	std::shared_mutex _mutex;
+	internal::sorted_map<const peg::ast_node*, std::shared_ptr<const response::Value>> _arguments;
+	internal::sorted_set<const response::MapType*> _cachedMaps;
+	std::map<ConvertedKey, std::shared_ptr<const void>> _converted;
+};
+
+response::Value FieldArgumentCache::visit(
+	const peg::ast_node& arguments, const response::Value& variables)
+{
+	response::Value result(response::Type::Map);
+	ValueVisitor visitor(variables);
+
+	result.reserve(arguments.children.size());
+
+	for (auto& argument : arguments.children)
+	{
+		visitor.visit(*argument->children.back());
+
+		result.emplace_back(argument->children.front()->string(), visitor.getValue());
+	}
+
+	return result;
+}
+
+response::Value FieldArgumentCache::find(
+	const peg::ast_node& arguments, const response::Value& variables)
+{
+	{
+		std::shared_lock lock { _mutex };
+		const auto itr = _arguments.find(&arguments);
+
+		if (itr != _arguments.end())
+		{
+			return response::Value { itr->second };
+		}
+	}
+
+	auto result = std::make_shared<const response::Value>(visit(arguments, variables));
+	std::unique_lock lock { _mutex };
+
+	// Another thread may have coerced the same arguments in the meantime, in which case we keep
+	// the first result.
+	const auto [itr, inserted] = _arguments.emplace(&arguments, std::move(result));
+
+	if (inserted)
+	{
+		_cachedMaps.emplace(getCachedMap(*itr->second));
+	}
+
+	return response::Value { itr->second };
+}
+
+const response::MapType* FieldArgumentCache::getCachedMap(const response::Value& arguments)
+{
+	// The shared response::Value returned by find resolves to the same map every time.
+	return arguments.type() == response::Type::Map ? &arguments.get<response::MapType>() : nullptr;
+}
+
+std::shared_ptr<const void> FieldArgumentCache::findConverted(
+	const response::Value& arguments, std::string_view name, std::type_index type)
+{
+	const auto map = getCachedMap(arguments);
+	std::shared_lock lock { _mutex };
+
+	if (_cachedMaps.find(map) == _cachedMaps.end())
+	{
+		return nullptr;
+	}
+
+	const auto itr = _converted.find(ConvertedKey { map, std::string { name }, type });
+
+	return itr == _converted.end() ? nullptr : itr->second;
+}
+
+std::shared_ptr<const void> FieldArgumentCache::cacheConverted(const response::Value& arguments,
+	std::string_view name, std::type_index type, std::shared_ptr<const void> value)
+{
+	const auto map = getCachedMap(arguments);
+	std::unique_lock lock { _mutex };
+
+	if (_cachedMaps.find(map) == _cachedMaps.end())
+	{
+		return nullptr;
+	}
+
+	// Another thread may have converted the same argument in the meantime, in which case we keep
+	// the first result.
+	return _converted.emplace(ConvertedKey { map, std::string { name }, type }, std::move(value))
+		.first->second;
+}
+
+std::shared_ptr<const void> ResolverParams::findConvertedArgument(
+	std::string_view name, std::type_index type) const
+{
+	return fieldArguments ? fieldArguments->findConverted(arguments, name, type) : nullptr;
+}
+
+std::shared_ptr<const void> ResolverParams::cacheConvertedArgument(
+	std::string_view name, std::type_index type, std::shared_ptr<const void> value) const
+{
+	return fieldArguments ? fieldArguments->cacheConverted(arguments, name, type, std::move(value))
+						  : nullptr;
+}
+
 // SelectionVisitor visits the AST and resolves a field or fragment, unless it's skipped by
 // a directive or type condition.
 class SelectionVisitor
@@ -879,16 +1023,16 @@ private:
 	const ResolverContext _resolverContext;
 	const std::shared_ptr<RequestState>& _state;
 	const Directives& _operationDirectives;
-	const std::optional<std::reference_wrapper<const field_path>> _path;
 	const await_async _launch;
 	const FragmentMap& _fragments;
 	const response::Value& _variables;
 	const TypeNames& _typeNames;
 	const ResolverMap& _resolvers;
+	const std::shared_ptr<FieldArgumentCache> _fieldArguments;
 
-	std::shared_ptr<FragmentDefinitionDirectiveStack> _fragmentDefinitionDirectives;
-	std::shared_ptr<FragmentSpreadDirectiveStack> _fragmentSpreadDirectives;
-	std::shared_ptr<FragmentSpreadDirectiveStack> _inlineFragmentDirectives;
+	FragmentDefinitionDirectiveStack _fragmentDefinitionDirectives;
+	FragmentSpreadDirectiveStack _fragmentSpreadDirectives;
+	FragmentSpreadDirectiveStack _inlineFragmentDirectives;
 	internal::string_view_set _names;
 	std::vector<std::pair<std::string_view, AwaitableResolver>> _values;
 };
@@ -899,26 +1043,22 @@ SelectionVisitor::SelectionVisitor(const SelectionSetParams& selectionSetParams,
 	: _resolverContext(selectionSetParams.resolverContext)
 	, _state(selectionSetParams.state)
 	, _operationDirectives(selectionSetParams.operationDirectives)
-	, _path(selectionSetParams.errorPath
-			  ? std::make_optional(std::cref(*selectionSetParams.errorPath))
-			  : std::nullopt)
 	, _launch(selectionSetParams.launch)
 	, _fragments(fragments)
 	, _variables(variables)
 	, _typeNames(typeNames)
 	, _resolvers(resolvers)
-	, _fragmentDefinitionDirectives { selectionSetParams.fragmentDefinitionDirectives }
-	, _fragmentSpreadDirectives { selectionSetParams.fragmentSpreadDirectives }
-	, _inlineFragmentDirectives { selectionSetParams.inlineFragmentDirectives }
+	, _fieldArguments(selectionSetParams.fieldArguments)
 {
 	static const Directives s_emptyFragmentDefinitionDirectives;
 
 	// Traversing a SelectionSet from an Object type field should start tracking new fragment
 	// directives. The outer fragment directives are still there in the FragmentSpreadDirectiveStack
-	// if the field accessors want to inspect them.
-	_fragmentDefinitionDirectives->push_front(std::cref(s_emptyFragmentDefinitionDirectives));
-	_fragmentSpreadDirectives->push_front({});
-	_inlineFragmentDirectives->push_front({});
+	// if the field accessors want to inspect them. Pushing these empty frames does not allocate.
+	_fragmentDefinitionDirectives = selectionSetParams.fragmentDefinitionDirectives.push_front(
+		std::cref(s_emptyFragmentDefinitionDirectives));
+	_fragmentSpreadDirectives = selectionSetParams.fragmentSpreadDirectives.push_front({});
+	_inlineFragmentDirectives = selectionSetParams.inlineFragmentDirectives.push_front({});
 
 	_names.reserve(count);
 	_values.reserve(count);
@@ -949,17 +1089,8 @@ void SelectionVisitor::visit(const peg::ast_node& selection)
 
 void SelectionVisitor::visitField(const peg::ast_node& field)
 {
-	std::string_view name;
-
-	peg::on_first_child<peg::field_name>(field, [&name](const peg::ast_node& child) {
-		name = child.string_view();
-	});
-
-	std::string_view alias;
-
-	peg::on_first_child<peg::alias_name>(field, [&alias](const peg::ast_node& child) {
-		alias = child.string_view();
-	});
+	const auto name = peg::first_child_view<peg::field_name>(field);
+	auto alias = peg::first_child_view<peg::alias_name>(field);
 
 	if (alias.empty())
 	{
@@ -981,13 +1112,12 @@ void SelectionVisitor::visitField(const peg::ast_node& field)
 		std::promise<ResolverResult> promise;
 		auto position = field.begin();
 		std::ostringstream error;
+		ResolverResult document;
 
 		error << "Unknown field name: " << name;
 
-		promise.set_exception(
-			std::make_exception_ptr(schema_exception { { schema_error { error.str(),
-				{ position.line, position.column },
-				buildErrorPath(_path ? std::make_optional(_path->get()) : std::nullopt) } } }));
+		document.errors.push_back({ error.str(), { position.line, position.column } });
+		promise.set_value(std::move(document));
 
 		_values.push_back({ alias, promise.get_future() });
 		return;
@@ -995,9 +1125,10 @@ void SelectionVisitor::visitField(const peg::ast_node& field)
 
 	DirectiveVisitor directiveVisitor(_variables);
 
-	peg::on_first_child<peg::directives>(field, [&directiveVisitor](const peg::ast_node& child) {
-		directiveVisitor.visit(child);
-	});
+	if (const auto directives = peg::first_child<peg::directives>(field))
+	{
+		directiveVisitor.visit(*directives);
+	}
 
 	if (directiveVisitor.shouldSkip())
 	{
@@ -1006,22 +1137,13 @@ void SelectionVisitor::visitField(const peg::ast_node& field)
 
 	response::Value arguments(response::Type::Map);
 
-	peg::on_first_child<peg::arguments>(field, [this, &arguments](const peg::ast_node& child) {
-		ValueVisitor visitor(_variables);
-
-		for (auto& argument : child.children)
-		{
-			visitor.visit(*argument->children.back());
-
-			arguments.emplace_back(argument->children.front()->string(), visitor.getValue());
-		}
-	});
-
-	const peg::ast_node* selection = nullptr;
+	if (const auto fieldArguments = peg::first_child<peg::arguments>(field))
+	{
+		arguments = _fieldArguments ? _fieldArguments->find(*fieldArguments, _variables)
+									: FieldArgumentCache::visit(*fieldArguments, _variables);
+	}
 
-	peg::on_first_child<peg::selection_set>(field, [&selection](const peg::ast_node& child) {
-		selection = &child;
-	});
+	const auto selection = peg::first_child<peg::selection_set>(field);
 
 	const SelectionSetParams selectionSetParams {
 		_resolverContext,
@@ -1030,8 +1152,8 @@ void SelectionVisitor::visitField(const peg::ast_node& field)
 		_fragmentDefinitionDirectives,
 		_fragmentSpreadDirectives,
 		_inlineFragmentDirectives,
-		std::make_optional(field_path { _path, path_segment { alias } }),
 		_launch,
+		_fieldArguments,
 	};
 
 	try
@@ -1051,22 +1173,17 @@ void SelectionVisitor::visitField(const peg::ast_node& field)
 	{
 		std::promise<ResolverResult> promise;
 		auto position = field.begin();
-		auto messages = scx.getStructuredErrors();
+		ResolverResult document { {}, scx.getStructuredErrors() };
 
-		for (auto& message : messages)
+		for (auto& message : document.errors)
 		{
 			if (message.location.line == 0)
 			{
 				message.location = { position.line, position.column };
 			}
-
-			if (message.path.empty())
-			{
-				message.path = buildErrorPath(selectionSetParams.errorPath);
-			}
 		}
 
-		promise.set_exception(std::make_exception_ptr(schema_exception { std::move(messages) }));
+		promise.set_value(std::move(document));
 
 		_values.push_back({ alias, promise.get_future() });
 	}
@@ -1076,12 +1193,12 @@ void SelectionVisitor::visitField(const peg::ast_node& field)
 		auto position = field.begin();
 		std::ostringstream message;
 
+		ResolverResult document;
+
 		message << "Field error name: " << alias << " unknown error: " << ex.what();
 
-		promise.set_exception(
-			std::make_exception_ptr(schema_exception { { schema_error { message.str(),
-				{ position.line, position.column },
-				buildErrorPath(selectionSetParams.errorPath) } } }));
+		document.errors.push_back({ message.str(), { position.line, position.column } });
+		promise.set_value(std::move(document));
 
 		_values.push_back({ alias, promise.get_future() });
 	}
@@ -1100,8 +1217,7 @@ void SelectionVisitor::visitFragmentSpread(const peg::ast_node& fragmentSpread)
 		error << "Unknown fragment name: " << name;
 
 		throw schema_exception { { schema_error { error.str(),
-			{ position.line, position.column },
-			buildErrorPath(_path ? std::make_optional(_path->get()) : std::nullopt) } } };
+			{ position.line, position.column } } } };
 	}
 
 	bool skip = (_typeNames.find(itr->second.getType()) == _typeNames.end());
@@ -1109,10 +1225,10 @@ void SelectionVisitor::visitFragmentSpread(const peg::ast_node& fragmentSpread)
 
 	if (!skip)
 	{
-		peg::on_first_child<peg::directives>(fragmentSpread,
-			[&directiveVisitor](const peg::ast_node& child) {
-				directiveVisitor.visit(child);
-			});
+		if (const auto directives = peg::first_child<peg::directives>(fragmentSpread))
+		{
+			directiveVisitor.visit(*directives);
+		}
 
 		skip = directiveVisitor.shouldSkip();
 	}
@@ -1122,8 +1238,10 @@ void SelectionVisitor::visitFragmentSpread(const peg::ast_node& fragmentSpread)
 		return;
 	}
 
-	_fragmentDefinitionDirectives->push_front(itr->second.getDirectives());
-	_fragmentSpreadDirectives->push_front(directiveVisitor.getDirectives());
+	_fragmentDefinitionDirectives =
+		_fragmentDefinitionDirectives.push_front(std::cref(itr->second.getDirectives()));
+	_fragmentSpreadDirectives =
+		_fragmentSpreadDirectives.push_front(directiveVisitor.getDirectives());
 
 	const size_t count = itr->second.getSelection().children.size();
 
@@ -1138,53 +1256,49 @@ void SelectionVisitor::visitFragmentSpread(const peg::ast_node& fragmentSpread)
 		visit(*selection);
 	}
 
-	_fragmentSpreadDirectives->pop_front();
-	_fragmentDefinitionDirectives->pop_front();
+	_fragmentSpreadDirectives = _fragmentSpreadDirectives.pop_front();
+	_fragmentDefinitionDirectives = _fragmentDefinitionDirectives.pop_front();
 }
 
 void SelectionVisitor::visitInlineFragment(const peg::ast_node& inlineFragment)
 {
 	DirectiveVisitor directiveVisitor(_variables);
 
-	peg::on_first_child<peg::directives>(inlineFragment,
-		[&directiveVisitor](const peg::ast_node& child) {
-			directiveVisitor.visit(child);
-		});
+	if (const auto directives = peg::first_child<peg::directives>(inlineFragment))
+	{
+		directiveVisitor.visit(*directives);
+	}
 
 	if (directiveVisitor.shouldSkip())
 	{
 		return;
 	}
 
-	const peg::ast_node* typeCondition = nullptr;
-
-	peg::on_first_child<peg::type_condition>(inlineFragment,
-		[&typeCondition](const peg::ast_node& child) {
-			typeCondition = &child;
-		});
+	const auto typeCondition = peg::first_child<peg::type_condition>(inlineFragment);
 
 	if (typeCondition == nullptr
 		|| _typeNames.find(typeCondition->children.front()->string_view()) != _typeNames.end())
 	{
-		peg::on_first_child<peg::selection_set>(inlineFragment,
-			[this, &directiveVisitor](const peg::ast_node& child) {
-				_inlineFragmentDirectives->push_front(directiveVisitor.getDirectives());
+		if (const auto selectionSet = peg::first_child<peg::selection_set>(inlineFragment))
+		{
+			_inlineFragmentDirectives =
+				_inlineFragmentDirectives.push_front(directiveVisitor.getDirectives());
 
-				const size_t count = child.children.size();
+			const size_t count = selectionSet->children.size();
 
-				if (count > 1)
-				{
-					_names.reserve(_names.capacity() + count - 1);
-					_values.reserve(_values.capacity() + count - 1);
-				}
+			if (count > 1)
+			{
+				_names.reserve(_names.capacity() + count - 1);
+				_values.reserve(_values.capacity() + count - 1);
+			}
 
-				for (const auto& selection : child.children)
-				{
-					visit(*selection);
-				}
+			for (const auto& selection : selectionSet->children)
+			{
+				visit(*selection);
+			}
 
-				_inlineFragmentDirectives->pop_front();
-			});
+			_inlineFragmentDirectives = _inlineFragmentDirectives.pop_front();
+		}
 	}
 }
 
@@ -1236,11 +1350,12 @@ AwaitableResolver Object::resolve(const SelectionSetParams& selectionSetParams,
 
 				message << "Ambiguous field error name: " << name;
 
-				document.errors.push_back({ message.str() });
+				document.errors.push_back({ message.str(), {}, { path_segment { name } } });
 			}
 
 			if (!value.errors.empty())
 			{
+				prependErrorPath(value.errors, path_segment { name });
 				document.errors.splice(document.errors.end(), value.errors);
 			}
 		}
@@ -1250,7 +1365,8 @@ AwaitableResolver Object::resolve(const SelectionSetParams& selectionSetParams,
 
 			if (!errors.empty())
 			{
-				std::copy(errors.begin(), errors.end(), std::back_inserter(document.errors));
+				prependErrorPath(errors, path_segment { name });
+				document.errors.splice(document.errors.end(), errors);
 			}
 
 			document.data.emplace_back(std::string { name }, {});
@@ -1261,7 +1377,7 @@ AwaitableResolver Object::resolve(const SelectionSetParams& selectionSetParams,
 
 			message << "Field error name: " << name << " unknown error: " << ex.what();
 
-			document.errors.push_back({ message.str() });
+			document.errors.push_back({ message.str(), {}, { path_segment { name } } });
 			document.data.emplace_back(std::string { name }, {});
 		}
 	}
@@ -1382,11 +1498,11 @@ void OperationDefinitionVisitor::visit(
 		[this, &operationVariables](const peg::ast_node& variable) {
 			std::string variableName;
 
-			peg::on_first_child<peg::variable_name>(variable,
-				[&variableName](const peg::ast_node& name) {
-					// Skip the $ prefix
-					variableName = name.string_view().substr(1);
-				});
+			if (const auto name = peg::first_child<peg::variable_name>(variable))
+			{
+				// Skip the $ prefix
+				variableName = name->string_view().substr(1);
+			}
 
 			auto itrVar = _params->variables.find(variableName);
 			response::Value valueVar;
@@ -1395,15 +1511,12 @@ void OperationDefinitionVisitor::visit(
 			{
 				valueVar = response::Value(itrVar->second);
 			}
-			else
+			else if (const auto defaultValue = peg::first_child<peg::default_value>(variable))
 			{
-				peg::on_first_child<peg::default_value>(variable,
-					[this, &valueVar](const peg::ast_node& defaultValue) {
-						ValueVisitor visitor(_params->variables);
+				ValueVisitor visitor(_params->variables);
 
-						visitor.visit(*defaultValue.children.front());
-						valueVar = visitor.getValue();
-					});
+				visitor.visit(*defaultValue->children.front());
+				valueVar = visitor.getValue();
 			}
 
 			operationVariables.emplace_back(std::move(variableName), std::move(valueVar));
@@ -1413,13 +1526,13 @@ void OperationDefinitionVisitor::visit(
 
 	Directives operationDirectives;
 
-	peg::on_first_child<peg::directives>(operationDefinition,
-		[this, &operationDirectives](const peg::ast_node& child) {
-			DirectiveVisitor directiveVisitor(_params->variables);
+	if (const auto directives = peg::first_child<peg::directives>(operationDefinition))
+	{
+		DirectiveVisitor directiveVisitor(_params->variables);
 
-			directiveVisitor.visit(child);
-			operationDirectives = directiveVisitor.getDirectives();
-		});
+		directiveVisitor.visit(*directives);
+		operationDirectives = directiveVisitor.getDirectives();
+	}
 
 	_params->directives = std::move(operationDirectives);
 
@@ -1427,11 +1540,11 @@ void OperationDefinitionVisitor::visit(
 		_resolverContext,
 		_params->state,
 		_params->directives,
-		std::make_shared<FragmentDefinitionDirectiveStack>(),
-		std::make_shared<FragmentSpreadDirectiveStack>(),
-		std::make_shared<FragmentSpreadDirectiveStack>(),
-		std::nullopt,
+		{},
+		{},
+		{},
 		_launch,
+		std::make_shared<FieldArgumentCache>(),
 	};
 
 	_result = std::make_optional(itr->second->resolve(selectionSetParams,
@@ -1525,13 +1638,13 @@ void SubscriptionDefinitionVisitor::visit(const peg::ast_node& operationDefiniti
 
 	Directives directives;
 
-	peg::on_first_child<peg::directives>(operationDefinition,
-		[this, &directives](const peg::ast_node& child) {
-			DirectiveVisitor directiveVisitor(_params.variables);
+	if (const auto operationDirectives = peg::first_child<peg::directives>(operationDefinition))
+	{
+		DirectiveVisitor directiveVisitor(_params.variables);
 
-			directiveVisitor.visit(child);
-			directives = directiveVisitor.getDirectives();
-		});
+		directiveVisitor.visit(*operationDirectives);
+		directives = directiveVisitor.getDirectives();
+	}
 
 	_result =
 		std::make_shared<SubscriptionData>(std::make_shared<OperationData>(std::move(_params.state),
@@ -1549,11 +1662,7 @@ void SubscriptionDefinitionVisitor::visit(const peg::ast_node& operationDefiniti
 
 void SubscriptionDefinitionVisitor::visitField(const peg::ast_node& field)
 {
-	std::string_view name;
-
-	peg::on_first_child<peg::field_name>(field, [&name](const peg::ast_node& child) {
-		name = child.string_view();
-	});
+	const auto name = peg::first_child_view<peg::field_name>(field);
 
 	// https://spec.graphql.org/October2021/#sec-Single-root-field
 	if (!_field.empty())
@@ -1570,9 +1679,10 @@ void SubscriptionDefinitionVisitor::visitField(const peg::ast_node& field)
 
 	DirectiveVisitor directiveVisitor(_params.variables);
 
-	peg::on_first_child<peg::directives>(field, [&directiveVisitor](const peg::ast_node& child) {
-		directiveVisitor.visit(child);
-	});
+	if (const auto directives = peg::first_child<peg::directives>(field))
+	{
+		directiveVisitor.visit(*directives);
+	}
 
 	if (directiveVisitor.shouldSkip())
 	{
@@ -1583,18 +1693,12 @@ void SubscriptionDefinitionVisitor::visitField(const peg::ast_node& field)
 
 	response::Value arguments(response::Type::Map);
 
-	peg::on_first_child<peg::arguments>(field, [this, &arguments](const peg::ast_node& child) {
-		ValueVisitor visitor(_params.variables);
-
-		for (auto& argument : child.children)
-		{
-			visitor.visit(*argument->children.back());
-
-			arguments.emplace_back(argument->children.front()->string(), visitor.getValue());
-		}
-	});
+	if (const auto fieldArguments = peg::first_child<peg::arguments>(field))
+	{
+		arguments = FieldArgumentCache::visit(*fieldArguments, _params.variables);
+	}
 
-	_field = std::move(name);
+	_field = name;
 	_arguments = std::move(arguments);
 }
 
@@ -1620,10 +1724,10 @@ void SubscriptionDefinitionVisitor::visitFragmentSpread(const peg::ast_node& fra
 
 	if (!skip)
 	{
-		peg::on_first_child<peg::directives>(fragmentSpread,
-			[&directiveVisitor](const peg::ast_node& child) {
-				directiveVisitor.visit(child);
-			});
+		if (const auto directives = peg::first_child<peg::directives>(fragmentSpread))
+		{
+			directiveVisitor.visit(*directives);
+		}
 
 		skip = directiveVisitor.shouldSkip();
 	}
@@ -1643,32 +1747,28 @@ void SubscriptionDefinitionVisitor::visitInlineFragment(const peg::ast_node& inl
 {
 	DirectiveVisitor directiveVisitor(_params.variables);
 
-	peg::on_first_child<peg::directives>(inlineFragment,
-		[&directiveVisitor](const peg::ast_node& child) {
-			directiveVisitor.visit(child);
-		});
+	if (const auto directives = peg::first_child<peg::directives>(inlineFragment))
+	{
+		directiveVisitor.visit(*directives);
+	}
 
 	if (directiveVisitor.shouldSkip())
 	{
 		return;
 	}
 
-	const peg::ast_node* typeCondition = nullptr;
-
-	peg::on_first_child<peg::type_condition>(inlineFragment,
-		[&typeCondition](const peg::ast_node& child) {
-			typeCondition = &child;
-		});
+	const auto typeCondition = peg::first_child<peg::type_condition>(inlineFragment);
 
 	if (typeCondition == nullptr
 		|| _subscriptionObject->matchesType(typeCondition->children.front()->string()))
 	{
-		peg::on_first_child<peg::selection_set>(inlineFragment, [this](const peg::ast_node& child) {
-			for (const auto& selection : child.children)
+		if (const auto selectionSet = peg::first_child<peg::selection_set>(inlineFragment))
+		{
+			for (const auto& selection : selectionSet->children)
 			{
 				visit(*selection);
 			}
-		});
+		}
 	}
 }
 
@@ -1685,6 +1785,56 @@ Request::~Request()
 	// declaration of the class.
 }
 
+void Request::setCostOptions(RequestCostOptions options)
+{
+	const std::lock_guard lock { _validationMutex };
+
+	_costBudget = options.budget;
+	_validation->setCostOptions(std::move(options));
+
+	// The cached operation costs depend on the options.
+	_validationCache.clear();
+	_validationCacheIndex.clear();
+	_validationCacheStats.size = 0;
+}
+
+void Request::setValidationConcurrency(size_t concurrency)
+{
+	const std::lock_guard lock { _validationMutex };
+
+	_validation->setConcurrency(concurrency);
+}
+
+void Request::setValidationCacheSize(size_t maxSize)
+{
+	const std::lock_guard lock { _validationMutex };
+
+	_validationCacheSize = maxSize;
+	trimValidationCache();
+}
+
+ValidationCacheStats Request::getValidationCacheStats() const
+{
+	const std::lock_guard lock { _validationMutex };
+
+	return _validationCacheStats;
+}
+
+void Request::setIntrospectionCacheSize(size_t maxSize)
+{
+	const std::lock_guard lock { _introspectionMutex };
+
+	_introspectionCacheSize = maxSize;
+	trimIntrospectionCache();
+}
+
+IntrospectionCacheStats Request::getIntrospectionCacheStats() const
+{
+	const std::lock_guard lock { _introspectionMutex };
+
+	return _introspectionCacheStats;
+}
+
 std::list<schema_error> Request::validate(peg::ast& query) const
 {
 	std::list<schema_error> errors;
@@ -1692,15 +1842,141 @@ std::list<schema_error> Request::validate(peg::ast& query) const
 	if (!query.validated)
 	{
 		const std::lock_guard lock { _validationMutex };
+		const bool useCache = _validationCacheSize > 0 && query.root;
+
+		if (useCache)
+		{
+			peg::normalizeDocument(query);
+		}
+
+		if (!useCache || !findCachedValidation(query, errors))
+		{
+			_validation->visit(*query.root);
+			query.operationCosts = _validation->getOperationCosts();
+			errors = _validation->getStructuredErrors();
+
+			if (useCache)
+			{
+				cacheValidation(query, errors);
+			}
+		}
 
-		_validation->visit(*query.root);
-		errors = _validation->getStructuredErrors();
 		query.validated = errors.empty();
 	}
 
 	return errors;
 }
 
+namespace {
+
+// The error locations depend on the formatting of the document, so the cached errors are only
+// reused if the source text of the definitions is also the same.
+std::string_view getSource(const peg::ast_node& root)
+{
+	if (root.children.empty())
+	{
+		return {};
+	}
+
+	const auto first = root.children.front()->string_view();
+	const auto last = root.children.back()->string_view();
+
+	return std::string_view { first.data(),
+		static_cast<size_t>(last.data() + last.size() - first.data()) };
+}
+
+// An operation which only selects introspection fields at the top level resolves to the same
+// response every time, as long as it does not depend on any variables.
+bool isIntrospectionOnly(const peg::ast_node& operationDefinition)
+{
+	const auto selectionSet = peg::first_child<peg::selection_set>(operationDefinition);
+
+	return selectionSet && !selectionSet->children.empty()
+		&& std::all_of(selectionSet->children.cbegin(),
+			selectionSet->children.cend(),
+			[](const std::unique_ptr<peg::ast_node>& selection) {
+				return selection->is_type<peg::field>()
+					&& peg::first_child_view<peg::field_name>(*selection).starts_with("__"sv);
+			});
+}
+
+} // namespace
+
+bool Request::findCachedValidation(peg::ast& query, std::list<schema_error>& errors) const
+{
+	const auto itrIndex = _validationCacheIndex.find(query.hash);
+
+	// The hash only narrows the lookup, a different document with the same hash is a miss.
+	if (itrIndex == _validationCacheIndex.end()
+		|| itrIndex->second->normalized != query.normalized
+		|| (!itrIndex->second->errors.empty()
+			&& itrIndex->second->source != getSource(*query.root)))
+	{
+		++_validationCacheStats.misses;
+		return false;
+	}
+
+	++_validationCacheStats.hits;
+	_validationCache.splice(_validationCache.begin(), _validationCache, itrIndex->second);
+
+	const auto& entry = _validationCache.front();
+
+	errors = entry.errors;
+	query.operationCosts.clear();
+
+	peg::for_each_child<peg::operation_definition>(*query.root,
+		[&query, &entry](const peg::ast_node& operationDefinition) {
+			const auto name = peg::first_child_view<peg::operation_name>(operationDefinition);
+			const auto itrCost = entry.operationCosts.find(name);
+
+			if (itrCost != entry.operationCosts.end())
+			{
+				query.operationCosts[name] = itrCost->second;
+			}
+		});
+
+	return true;
+}
+
+void Request::cacheValidation(const peg::ast& query, const std::list<schema_error>& errors) const
+{
+	ValidationCacheEntry entry { query.hash,
+		query.normalized,
+		errors.empty() ? std::string {} : std::string { getSource(*query.root) },
+		errors };
+
+	for (const auto& [name, cost] : query.operationCosts)
+	{
+		entry.operationCosts.emplace(name, cost);
+	}
+
+	const auto itrIndex = _validationCacheIndex.find(query.hash);
+
+	if (itrIndex != _validationCacheIndex.end())
+	{
+		// Replace the previous result for a document with different formatting.
+		*itrIndex->second = std::move(entry);
+		_validationCache.splice(_validationCache.begin(), _validationCache, itrIndex->second);
+		return;
+	}
+
+	_validationCache.push_front(std::move(entry));
+	_validationCacheIndex.emplace(query.hash, _validationCache.begin());
+	trimValidationCache();
+}
+
+void Request::trimValidationCache() const
+{
+	while (_validationCache.size() > _validationCacheSize)
+	{
+		_validationCacheIndex.erase(_validationCache.back().hash);
+		_validationCache.pop_back();
+		++_validationCacheStats.evictions;
+	}
+
+	_validationCacheStats.size = _validationCache.size();
+}
+
 std::pair<std::string_view, const peg::ast_node*> Request::findOperationDefinition(
 	peg::ast& query, std::string_view operationName) const
 {
@@ -1716,19 +1992,9 @@ std::pair<std::string_view, const peg::ast_node*> Request::findOperationDefiniti
 
 	peg::on_first_child_if<peg::operation_definition>(*query.root,
 		[&operationName, &result](const peg::ast_node& operationDefinition) noexcept -> bool {
-			std::string_view operationType = strQuery;
-
-			peg::on_first_child<peg::operation_type>(operationDefinition,
-				[&operationType](const peg::ast_node& child) {
-					operationType = child.string_view();
-				});
-
-			std::string_view name;
-
-			peg::on_first_child<peg::operation_name>(operationDefinition,
-				[&name](const peg::ast_node& child) {
-					name = child.string_view();
-				});
+			const auto type = peg::first_child<peg::operation_type>(operationDefinition);
+			const std::string_view operationType = type ? type->string_view() : strQuery;
+			const auto name = peg::first_child_view<peg::operation_name>(operationDefinition);
 
 			if (operationName.empty() || name == operationName)
 			{
@@ -1742,18 +2008,74 @@ std::pair<std::string_view, const peg::ast_node*> Request::findOperationDefiniti
 	return result;
 }
 
-response::AwaitableValue Request::resolve(RequestResolveParams params) const
+std::shared_ptr<const response::Value> Request::findCachedIntrospection(
+	size_t hash, const std::string& normalized, std::string_view operationName) const
 {
-	try
+	const std::lock_guard lock { _introspectionMutex };
+	const auto itrIndex =
+		_introspectionCacheIndex.find(IntrospectionCacheKey { hash, operationName });
+
+	// The hash only narrows the lookup, a different document with the same hash is a miss.
+	if (itrIndex == _introspectionCacheIndex.end() || itrIndex->second->normalized != normalized)
 	{
-		FragmentDefinitionVisitor fragmentVisitor(params.variables);
+		++_introspectionCacheStats.misses;
+		return nullptr;
+	}
 
-		peg::for_each_child<peg::fragment_definition>(*params.query.root,
-			[&fragmentVisitor](const peg::ast_node& child) {
-				fragmentVisitor.visit(child);
-			});
+	++_introspectionCacheStats.hits;
+	_introspectionCache.splice(_introspectionCache.begin(),
+		_introspectionCache,
+		itrIndex->second);
 
-		auto fragments = fragmentVisitor.getFragments();
+	return _introspectionCache.front().document;
+}
+
+void Request::cacheIntrospection(size_t hash, std::string&& normalized,
+	std::string_view operationName, std::shared_ptr<const response::Value> document) const
+{
+	const std::lock_guard lock { _introspectionMutex };
+
+	if (_introspectionCacheSize == 0)
+	{
+		return;
+	}
+
+	IntrospectionCacheEntry entry { { hash, std::string { operationName } },
+		std::move(normalized),
+		std::move(document) };
+	const auto itrIndex = _introspectionCacheIndex.find(entry.key);
+
+	if (itrIndex != _introspectionCacheIndex.end())
+	{
+		// Replace the previous response for a different document with the same hash.
+		*itrIndex->second = std::move(entry);
+		_introspectionCache.splice(_introspectionCache.begin(),
+			_introspectionCache,
+			itrIndex->second);
+		return;
+	}
+
+	_introspectionCache.push_front(std::move(entry));
+	_introspectionCacheIndex.emplace(_introspectionCache.front().key, _introspectionCache.begin());
+	trimIntrospectionCache();
+}
+
+void Request::trimIntrospectionCache() const
+{
+	while (_introspectionCache.size() > _introspectionCacheSize)
+	{
+		_introspectionCacheIndex.erase(_introspectionCache.back().key);
+		_introspectionCache.pop_back();
+		++_introspectionCacheStats.evictions;
+	}
+
+	_introspectionCacheStats.size = _introspectionCache.size();
+}
+
+response::AwaitableValue Request::resolve(RequestResolveParams params) const
+{
+	try
+	{
 		auto operationDefinition = findOperationDefinition(params.query, params.operationName);
 
 		if (!operationDefinition.second)
@@ -1785,7 +2107,59 @@ response::AwaitableValue Request::resolve(RequestResolveParams params) const
 				{ schema_error { message.str(), { position.line, position.column } } }
 			};
 		}
+		else if (_costBudget)
+		{
+			// Check the estimated cost from validation before allocating any resolver state.
+			const auto itrCost = params.query.operationCosts.find(
+				peg::first_child_view<peg::operation_name>(*operationDefinition.second));
+
+			if (itrCost != params.query.operationCosts.end() && itrCost->second > *_costBudget)
+			{
+				auto position = operationDefinition.second->begin();
+				std::ostringstream message;
+
+				message << "Operation cost: " << itrCost->second
+						<< " exceeds budget: " << *_costBudget;
+
+				if (!params.operationName.empty())
+				{
+					message << " name: " << params.operationName;
+				}
+
+				throw schema_exception {
+					{ schema_error { message.str(), { position.line, position.column } } }
+				};
+			}
+		}
+
+		const bool useIntrospectionCache = _introspectionCacheSize > 0
+			&& operationDefinition.first == strQuery
+			&& params.variables.type() == response::Type::Map && params.variables.size() == 0
+			&& isIntrospectionOnly(*operationDefinition.second);
+
+		std::string normalized;
+		size_t hash = 0;
+
+		if (useIntrospectionCache)
+		{
+			// The same ast may be resolved on several threads at once, so don't store these in it.
+			normalized = peg::normalizeDocument(*params.query.root);
+			hash = std::hash<std::string> {}(normalized);
+
+			if (auto cached = findCachedIntrospection(hash, normalized, params.operationName))
+			{
+				co_return response::Value { std::move(cached) };
+			}
+		}
+
+		FragmentDefinitionVisitor fragmentVisitor(params.variables);
+
+		peg::for_each_child<peg::fragment_definition>(*params.query.root,
+			[&fragmentVisitor](const peg::ast_node& child) {
+				fragmentVisitor.visit(child);
+			});
 
+		auto fragments = fragmentVisitor.getFragments();
 		const bool isMutation = (operationDefinition.first == strMutation);
 		const auto resolverContext =
 			isMutation ? ResolverContext::Mutation : ResolverContext::Query;
@@ -1812,6 +2186,13 @@ response::AwaitableValue Request::resolve(RequestResolveParams params) const
 			document.emplace_back(std::string { strErrors },
 				buildErrorValues(std::move(result.errors)));
 		}
+		else if (useIntrospectionCache)
+		{
+			auto shared = std::make_shared<const response::Value>(std::move(document));
+
+			cacheIntrospection(hash, std::move(normalized), params.operationName, shared);
+			co_return response::Value { std::move(shared) };
+		}
 
 		co_return std::move(document);
 	}
@@ -1851,11 +2232,11 @@ AwaitableSubscribe Request::subscribe(RequestSubscribeParams params)
 			ResolverContext::NotifySubscribe,
 			registration->data->state,
 			registration->data->directives,
-			std::make_shared<FragmentDefinitionDirectiveStack>(),
-			std::make_shared<FragmentSpreadDirectiveStack>(),
-			std::make_shared<FragmentSpreadDirectiveStack>(),
+			{},
+			{},
 			{},
 			launch,
+			std::make_shared<FieldArgumentCache>(),
 		};
 
 		lock.unlock();
@@ -1913,11 +2294,11 @@ AwaitableUnsubscribe Request::unsubscribe(RequestUnsubscribeParams params)
 			ResolverContext::NotifyUnsubscribe,
 			registration->data->state,
 			registration->data->directives,
-			std::make_shared<FragmentDefinitionDirectiveStack>(),
-			std::make_shared<FragmentSpreadDirectiveStack>(),
-			std::make_shared<FragmentSpreadDirectiveStack>(),
+			{},
+			{},
 			{},
 			params.launch,
+			std::make_shared<FieldArgumentCache>(),
 		};
 
 		lock.unlock();
@@ -1976,11 +2357,11 @@ AwaitableDeliver Request::deliver(RequestDeliverParams params) const
 			ResolverContext::Subscription,
 			registration->data->state,
 			registration->data->directives,
-			std::make_shared<FragmentDefinitionDirectiveStack>(),
-			std::make_shared<FragmentSpreadDirectiveStack>(),
-			std::make_shared<FragmentSpreadDirectiveStack>(),
-			std::nullopt,
+			{},
+			{},
+			{},
 			params.launch,
+			std::make_shared<FieldArgumentCache>(),
 		};
 
 		response::Value document { response::Type::Map };
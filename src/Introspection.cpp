@@ -12,10 +12,30 @@
 #include "graphqlservice/introspection/SchemaObject.h"
 #include "graphqlservice/introspection/TypeObject.h"
 
+#include <mutex>
+
 namespace graphql::introspection {
+namespace {
+
+// Share the wrapper from the schema's IntrospectionCache if it is still available, otherwise wrap
+// the schema entry just for this request.
+template <class TObject, class TWrapper, class TEntry>
+[[nodiscard]] std::shared_ptr<TObject> makeWrapper(
+	const std::weak_ptr<IntrospectionCache>& cache, const std::shared_ptr<const TEntry>& entry)
+{
+	if (const auto sharedCache = cache.lock())
+	{
+		return sharedCache->get(entry);
+	}
+
+	return std::make_shared<TObject>(std::make_shared<TWrapper>(entry));
+}
+
+} // namespace
 
 Schema::Schema(const std::shared_ptr<schema::Schema>& schema)
 	: _schema(schema)
+	, _cache(schema->introspectionCache())
 {
 }
 
@@ -31,8 +51,8 @@ std::vector<std::shared_ptr<object::Type>> Schema::getTypes() const
 	const auto& types = _schema->types();
 	std::vector<std::shared_ptr<object::Type>> result(types.size());
 
-	std::transform(types.begin(), types.end(), result.begin(), [](const auto& entry) {
-		return std::make_shared<object::Type>(std::make_shared<Type>(entry.second));
+	std::transform(types.begin(), types.end(), result.begin(), [this](const auto& entry) {
+		return _cache->get(entry.second);
 	});
 
 	return result;
@@ -42,24 +62,21 @@ std::shared_ptr<object::Type> Schema::getQueryType() const
 {
 	const auto& queryType = _schema->queryType();
 
-	return queryType ? std::make_shared<object::Type>(std::make_shared<Type>(queryType)) : nullptr;
+	return queryType ? _cache->get(queryType) : nullptr;
 }
 
 std::shared_ptr<object::Type> Schema::getMutationType() const
 {
 	const auto& mutationType = _schema->mutationType();
 
-	return mutationType ? std::make_shared<object::Type>(std::make_shared<Type>(mutationType))
-						: nullptr;
+	return mutationType ? _cache->get(mutationType) : nullptr;
 }
 
 std::shared_ptr<object::Type> Schema::getSubscriptionType() const
 {
 	const auto& subscriptionType = _schema->subscriptionType();
 
-	return subscriptionType
-		? std::make_shared<object::Type>(std::make_shared<Type>(subscriptionType))
-		: nullptr;
+	return subscriptionType ? _cache->get(subscriptionType) : nullptr;
 }
 
 std::vector<std::shared_ptr<object::Directive>> Schema::getDirectives() const
@@ -67,15 +84,17 @@ std::vector<std::shared_ptr<object::Directive>> Schema::getDirectives() const
 	const auto& directives = _schema->directives();
 	std::vector<std::shared_ptr<object::Directive>> result(directives.size());
 
-	std::transform(directives.begin(), directives.end(), result.begin(), [](const auto& entry) {
-		return std::make_shared<object::Directive>(std::make_shared<Directive>(entry));
+	std::transform(directives.begin(), directives.end(), result.begin(), [this](const auto& entry) {
+		return _cache->get(entry);
 	});
 
 	return result;
 }
 
-Type::Type(const std::shared_ptr<const schema::BaseType>& type)
+Type::Type(
+	const std::shared_ptr<const schema::BaseType>& type, std::weak_ptr<IntrospectionCache> cache)
 	: _type(type)
+	, _cache(std::move(cache))
 {
 }
 
@@ -120,7 +139,7 @@ std::optional<std::vector<std::shared_ptr<object::Field>>> Type::getFields(
 	{
 		if (deprecated || !field->deprecationReason())
 		{
-			result->push_back(std::make_shared<object::Field>(std::make_shared<Field>(field)));
+			result->push_back(makeWrapper<object::Field, Field>(_cache, field));
 		}
 	}
 
@@ -141,9 +160,12 @@ std::optional<std::vector<std::shared_ptr<object::Type>>> Type::getInterfaces()
 	const auto& interfaces = _type->interfaces();
 	auto result = std::make_optional<std::vector<std::shared_ptr<object::Type>>>(interfaces.size());
 
-	std::transform(interfaces.begin(), interfaces.end(), result->begin(), [](const auto& entry) {
-		return std::make_shared<object::Type>(std::make_shared<Type>(entry));
-	});
+	std::transform(interfaces.begin(),
+		interfaces.end(),
+		result->begin(),
+		[this](const auto& entry) {
+			return makeWrapper<object::Type, Type, schema::BaseType>(_cache, entry);
+		});
 
 	return result;
 }
@@ -167,11 +189,11 @@ std::optional<std::vector<std::shared_ptr<object::Type>>> Type::getPossibleTypes
 	std::transform(possibleTypes.begin(),
 		possibleTypes.end(),
 		result->begin(),
-		[](const auto& entry) {
+		[this](const auto& entry) {
 			auto typeEntry = entry.lock();
 
 			return typeEntry && typeEntry->kind() == introspection::TypeKind::OBJECT
-				? std::make_shared<object::Type>(std::make_shared<Type>(std::move(typeEntry)))
+				? makeWrapper<object::Type, Type>(_cache, typeEntry)
 				: std::shared_ptr<object::Type> {};
 		});
 
@@ -202,8 +224,7 @@ std::optional<std::vector<std::shared_ptr<object::EnumValue>>> Type::getEnumValu
 	{
 		if (deprecated || !value->deprecationReason())
 		{
-			result->push_back(
-				std::make_shared<object::EnumValue>(std::make_shared<EnumValue>(value)));
+			result->push_back(makeWrapper<object::EnumValue, EnumValue>(_cache, value));
 		}
 	}
 
@@ -225,9 +246,12 @@ std::optional<std::vector<std::shared_ptr<object::InputValue>>> Type::getInputFi
 	auto result =
 		std::make_optional<std::vector<std::shared_ptr<object::InputValue>>>(inputFields.size());
 
-	std::transform(inputFields.begin(), inputFields.end(), result->begin(), [](const auto& entry) {
-		return std::make_shared<object::InputValue>(std::make_shared<InputValue>(entry));
-	});
+	std::transform(inputFields.begin(),
+		inputFields.end(),
+		result->begin(),
+		[this](const auto& entry) {
+			return makeWrapper<object::InputValue, InputValue>(_cache, entry);
+		});
 
 	return result;
 }
@@ -246,7 +270,7 @@ std::shared_ptr<object::Type> Type::getOfType() const
 
 	const auto ofType = _type->ofType().lock();
 
-	return ofType ? std::make_shared<object::Type>(std::make_shared<Type>(ofType)) : nullptr;
+	return ofType ? makeWrapper<object::Type, Type>(_cache, ofType) : nullptr;
 }
 
 std::optional<std::string> Type::getSpecifiedByURL() const
@@ -257,8 +281,10 @@ std::optional<std::string> Type::getSpecifiedByURL() const
 									: std::make_optional<std::string>(specifiedByURL) };
 }
 
-Field::Field(const std::shared_ptr<const schema::Field>& field)
+Field::Field(
+	const std::shared_ptr<const schema::Field>& field, std::weak_ptr<IntrospectionCache> cache)
 	: _field(field)
+	, _cache(std::move(cache))
 {
 }
 
@@ -279,8 +305,8 @@ std::vector<std::shared_ptr<object::InputValue>> Field::getArgs() const
 	const auto& args = _field->args();
 	std::vector<std::shared_ptr<object::InputValue>> result(args.size());
 
-	std::transform(args.begin(), args.end(), result.begin(), [](const auto& entry) {
-		return std::make_shared<object::InputValue>(std::make_shared<InputValue>(entry));
+	std::transform(args.begin(), args.end(), result.begin(), [this](const auto& entry) {
+		return makeWrapper<object::InputValue, InputValue>(_cache, entry);
 	});
 
 	return result;
@@ -290,7 +316,7 @@ std::shared_ptr<object::Type> Field::getType() const
 {
 	const auto type = _field->type().lock();
 
-	return type ? std::make_shared<object::Type>(std::make_shared<Type>(type)) : nullptr;
+	return type ? makeWrapper<object::Type, Type>(_cache, type) : nullptr;
 }
 
 bool Field::getIsDeprecated() const
@@ -306,8 +332,11 @@ std::optional<std::string> Field::getDeprecationReason() const
 							   : std::nullopt };
 }
 
-InputValue::InputValue(const std::shared_ptr<const schema::InputValue>& inputValue)
+InputValue::InputValue(
+	const std::shared_ptr<const schema::InputValue>& inputValue,
+	std::weak_ptr<IntrospectionCache> cache)
 	: _inputValue(inputValue)
+	, _cache(std::move(cache))
 {
 }
 
@@ -327,7 +356,7 @@ std::shared_ptr<object::Type> InputValue::getType() const
 {
 	const auto type = _inputValue->type().lock();
 
-	return type ? std::make_shared<object::Type>(std::make_shared<Type>(type)) : nullptr;
+	return type ? makeWrapper<object::Type, Type>(_cache, type) : nullptr;
 }
 
 std::optional<std::string> InputValue::getDefaultValue() const
@@ -337,8 +366,11 @@ std::optional<std::string> InputValue::getDefaultValue() const
 	return { defaultValue.empty() ? std::nullopt : std::make_optional<std::string>(defaultValue) };
 }
 
-EnumValue::EnumValue(const std::shared_ptr<const schema::EnumValue>& enumValue)
+EnumValue::EnumValue(
+	const std::shared_ptr<const schema::EnumValue>& enumValue,
+	std::weak_ptr<IntrospectionCache> cache)
 	: _enumValue(enumValue)
+	, _cache(std::move(cache))
 {
 }
 
@@ -367,8 +399,11 @@ std::optional<std::string> EnumValue::getDeprecationReason() const
 							   : std::nullopt };
 }
 
-Directive::Directive(const std::shared_ptr<const schema::Directive>& directive)
+Directive::Directive(
+	const std::shared_ptr<const schema::Directive>& directive,
+	std::weak_ptr<IntrospectionCache> cache)
 	: _directive(directive)
+	, _cache(std::move(cache))
 {
 }
 
@@ -394,8 +429,8 @@ std::vector<std::shared_ptr<object::InputValue>> Directive::getArgs() const
 	const auto& args = _directive->args();
 	std::vector<std::shared_ptr<object::InputValue>> result(args.size());
 
-	std::transform(args.begin(), args.end(), result.begin(), [](const auto& entry) {
-		return std::make_shared<object::InputValue>(std::make_shared<InputValue>(entry));
+	std::transform(args.begin(), args.end(), result.begin(), [this](const auto& entry) {
+		return makeWrapper<object::InputValue, InputValue>(_cache, entry);
 	});
 
 	return result;
@@ -406,4 +441,59 @@ bool Directive::getIsRepeatable() const
 	return _directive->isRepeatable();
 }
 
+IntrospectionCache::IntrospectionCache() = default;
+
+template <class TObject, class TWrapper, class TEntry>
+std::shared_ptr<TObject> IntrospectionCache::find(
+	std::unordered_map<const TEntry*, std::shared_ptr<TObject>>& wrappers,
+	const std::shared_ptr<const TEntry>& entry)
+{
+	{
+		std::shared_lock lock { _mutex };
+		const auto itr = wrappers.find(entry.get());
+
+		if (itr != wrappers.end())
+		{
+			return itr->second;
+		}
+	}
+
+	// Build the wrapper outside of the lock, it does not visit any other schema entries until
+	// one of its accessors is called. If another thread got here first, keep the original.
+	auto wrapper = std::make_shared<TObject>(std::make_shared<TWrapper>(entry, weak_from_this()));
+	std::unique_lock lock { _mutex };
+
+	return wrappers.emplace(entry.get(), std::move(wrapper)).first->second;
+}
+
+std::shared_ptr<object::Type> IntrospectionCache::get(
+	const std::shared_ptr<const schema::BaseType>& type)
+{
+	return find<object::Type, Type>(_types, type);
+}
+
+std::shared_ptr<object::Field> IntrospectionCache::get(
+	const std::shared_ptr<const schema::Field>& field)
+{
+	return find<object::Field, Field>(_fields, field);
+}
+
+std::shared_ptr<object::InputValue> IntrospectionCache::get(
+	const std::shared_ptr<const schema::InputValue>& inputValue)
+{
+	return find<object::InputValue, InputValue>(_inputValues, inputValue);
+}
+
+std::shared_ptr<object::EnumValue> IntrospectionCache::get(
+	const std::shared_ptr<const schema::EnumValue>& enumValue)
+{
+	return find<object::EnumValue, EnumValue>(_enumValues, enumValue);
+}
+
+std::shared_ptr<object::Directive> IntrospectionCache::get(
+	const std::shared_ptr<const schema::Directive>& directive)
+{
+	return find<object::Directive, Directive>(_directives, directive);
+}
+
 } // namespace graphql::introspection
@@ -3,24 +3,149 @@
 
 #include "graphqlservice/JSONResponse.h"
 
+#include "graphqlservice/internal/Base64.h"
+
 #define RAPIDJSON_NAMESPACE graphql::rapidjson
 #include <rapidjson/rapidjson.h>
 
+#include <rapidjson/error/en.h>
 #include <rapidjson/reader.h>
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
 
+#include <algorithm>
+#include <cerrno>
 #include <limits>
 #include <stdexcept>
+#include <system_error>
+#include <type_traits>
 #include <vector>
 
+#ifdef _WIN32
+#include <io.h>
+#else // !_WIN32
+#include <unistd.h>
+#endif // !_WIN32
+
 namespace graphql::response {
 
+// RapidJSON output stream which fills a fixed size buffer and passes it to the sink each time it
+// is full, instead of growing a single buffer for the whole response.
+class ChunkedStream
+{
+public:
+	using Ch = char;
+
+	explicit ChunkedStream(const JSONSink& sink)
+		: _sink { sink }
+		, _buffer(c_jsonChunkSize)
+	{
+	}
+
+	void Put(Ch ch)
+	{
+		if (_size == _buffer.size())
+		{
+			Flush();
+		}
+
+		_buffer[_size++] = ch;
+	}
+
+	void Write(const Ch* data, size_t count)
+	{
+		while (count > 0)
+		{
+			if (_size == _buffer.size())
+			{
+				Flush();
+			}
+
+			const auto length = std::min(count, _buffer.size() - _size);
+
+			std::copy(data, data + length, _buffer.data() + _size);
+			_size += length;
+			data += length;
+			count -= length;
+		}
+	}
+
+	// Reserve room for count characters in the buffer, which must not be more than
+	// c_jsonChunkSize.
+	Ch* Push(size_t count)
+	{
+		if (_size + count > _buffer.size())
+		{
+			Flush();
+		}
+
+		const auto output = _buffer.data() + _size;
+
+		_size += count;
+
+		return output;
+	}
+
+	void Flush()
+	{
+		if (_size > 0)
+		{
+			_sink(_buffer.data(), _size);
+			_size = 0;
+		}
+	}
+
+private:
+	const JSONSink& _sink;
+	std::vector<Ch> _buffer;
+	size_t _size = 0;
+};
+
+// Extend the RapidJSON writer so it can encode ByteData IDs in Base64 directly into the output
+// buffer. Base64 never needs escaping, so all it needs to add around them are the quotes.
+template <typename OutputStream>
+class Base64Writer : public rapidjson::Writer<OutputStream>
+{
+public:
+	explicit Base64Writer(OutputStream& stream)
+		: rapidjson::Writer<OutputStream> { stream }
+	{
+	}
+
+	void Base64(const IdType::ByteData& data)
+	{
+		const auto length = internal::Base64::encodedLength(data.size());
+
+		this->Prefix(rapidjson::kStringType);
+
+		if constexpr (std::is_same_v<OutputStream, ChunkedStream>)
+		{
+			if (length + 2 > c_jsonChunkSize)
+			{
+				// It won't fit in the buffer, so encode it separately and copy it in pieces.
+				const auto encoded = internal::Base64::toBase64(data);
+
+				this->os_->Put('"');
+				this->os_->Write(encoded.data(), encoded.size());
+				this->os_->Put('"');
+				return;
+			}
+		}
+
+		const auto output = this->os_->Push(length + 2);
+
+		output[0] = '"';
+		internal::Base64::toBase64(data, output + 1);
+		output[length + 1] = '"';
+	}
+};
+
+template <typename OutputStream>
 class StringWriter
 {
 public:
-	StringWriter(rapidjson::StringBuffer& buffer)
-		: _writer { buffer }
+	StringWriter(OutputStream& stream)
+		: _writer { stream }
 	{
 	}
 
@@ -59,6 +184,18 @@ public:
 		_writer.String(value.c_str());
 	}
 
+	void write_id(const IdType& value)
+	{
+		if (value.isByteData())
+		{
+			_writer.Base64(value.get<IdType::ByteData>());
+		}
+		else
+		{
+			_writer.String(value.get<IdType::OpaqueString>().c_str());
+		}
+	}
+
 	void write_bool(bool value)
 	{
 		_writer.Bool(value);
@@ -75,18 +212,54 @@ public:
 	}
 
 private:
-	rapidjson::Writer<rapidjson::StringBuffer> _writer;
+	Base64Writer<OutputStream> _writer;
 };
 
 std::string toJSON(Value&& response)
 {
 	rapidjson::StringBuffer buffer;
-	Writer writer { std::make_unique<StringWriter>(buffer) };
+	Writer writer { std::make_unique<StringWriter<rapidjson::StringBuffer>>(buffer) };
 
 	writer.write(std::move(response));
 	return buffer.GetString();
 }
 
+void toJSON(Value&& response, const JSONSink& sink)
+{
+	ChunkedStream stream { sink };
+	Writer writer { std::make_unique<StringWriter<ChunkedStream>>(stream) };
+
+	writer.write(std::move(response));
+	stream.Flush();
+}
+
+void toJSON(Value&& response, int fd)
+{
+	toJSON(std::move(response), [fd](const char* data, size_t size) {
+		while (size > 0)
+		{
+#ifdef _WIN32
+			const auto written = _write(fd, data, static_cast<unsigned int>(size));
+#else // !_WIN32
+			const auto written = ::write(fd, data, size);
+#endif // !_WIN32
+
+			if (written < 0)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+
+				throw std::system_error(errno, std::generic_category(), "toJSON write failed");
+			}
+
+			data += written;
+			size -= static_cast<size_t>(written);
+		}
+	});
+}
+
 struct ResponseHandler : rapidjson::BaseReaderHandler<rapidjson::UTF8<>, ResponseHandler>
 {
 	ResponseHandler()
@@ -229,4 +402,117 @@ Value parseJSON(const std::string& json)
 	return handler.getResponse();
 }
 
+struct VisitorHandler : rapidjson::BaseReaderHandler<rapidjson::UTF8<>, VisitorHandler>
+{
+	explicit VisitorHandler(ValueVisitor& visitor)
+		: _visitor { visitor }
+	{
+	}
+
+	bool Null()
+	{
+		_visitor.add_null();
+		return true;
+	}
+
+	bool Bool(bool b)
+	{
+		_visitor.add_bool(b);
+		return true;
+	}
+
+	bool Int(int i)
+	{
+		// https://spec.graphql.org/October2021/#sec-Int
+		static_assert(sizeof(i) == 4, "GraphQL only supports 32-bit signed integers");
+		_visitor.add_int(i);
+		return true;
+	}
+
+	bool Uint(unsigned int i)
+	{
+		if (i > static_cast<unsigned int>(std::numeric_limits<int>::max()))
+		{
+			// https://spec.graphql.org/October2021/#sec-Int
+			throw std::overflow_error("GraphQL only supports 32-bit signed integers");
+		}
+		return Int(static_cast<int>(i));
+	}
+
+	bool Int64(int64_t /*i*/)
+	{
+		// https://spec.graphql.org/October2021/#sec-Int
+		throw std::overflow_error("GraphQL only supports 32-bit signed integers");
+	}
+
+	bool Uint64(uint64_t /*i*/)
+	{
+		// https://spec.graphql.org/October2021/#sec-Int
+		throw std::overflow_error("GraphQL only supports 32-bit signed integers");
+	}
+
+	bool Double(double d)
+	{
+		_visitor.add_float(d);
+		return true;
+	}
+
+	bool String(const Ch* str, rapidjson::SizeType length, bool /*copy*/)
+	{
+		_visitor.add_string(std::string(str, length));
+		return true;
+	}
+
+	bool StartObject()
+	{
+		_visitor.start_object();
+		return true;
+	}
+
+	bool Key(const Ch* str, rapidjson::SizeType length, bool /*copy*/)
+	{
+		_visitor.add_member(std::string_view { str, length });
+		return true;
+	}
+
+	bool EndObject(rapidjson::SizeType /*count*/)
+	{
+		_visitor.end_object();
+		return true;
+	}
+
+	bool StartArray()
+	{
+		_visitor.start_array();
+		return true;
+	}
+
+	bool EndArray(rapidjson::SizeType /*count*/)
+	{
+		_visitor.end_array();
+		return true;
+	}
+
+private:
+	ValueVisitor& _visitor;
+};
+
+void parseJSON(const std::string& json, ValueVisitor& visitor)
+{
+	VisitorHandler handler { visitor };
+	rapidjson::Reader reader;
+	rapidjson::StringStream ss(json.c_str());
+
+	reader.Parse(ss, handler);
+
+	if (reader.HasParseError())
+	{
+		// The visitor has already seen the tokens before the error, so don't let the caller use
+		// what it built as if it were a complete response.
+		throw std::invalid_argument(std::string { "Invalid JSON: " }
+			+ rapidjson::GetParseError_En(reader.GetParseErrorCode())
+			+ " offset: " + std::to_string(reader.GetErrorOffset()));
+	}
+}
+
 } // namespace graphql::response
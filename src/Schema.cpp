@@ -3,9 +3,11 @@
 
 #include "graphqlservice/internal/Schema.h"
 
+#include "graphqlservice/internal/Introspection.h"
+
 #include "graphqlservice/introspection/IntrospectionSchema.h"
 
-#include <tuple>
+#include "Validation.h"
 
 using namespace std::literals;
 
@@ -67,23 +69,20 @@ const std::shared_ptr<const BaseType>& Schema::LookupType(std::string_view name)
 std::shared_ptr<const BaseType> Schema::WrapType(
 	introspection::TypeKind kind, std::shared_ptr<const BaseType> ofType)
 {
-	auto& wrappers = (kind == introspection::TypeKind::LIST) ? _listWrappers : _nonNullWrappers;
-	auto& mutex =
-		(kind == introspection::TypeKind::LIST) ? _listWrappersMutex : _nonNullWrappersMutex;
-	std::shared_lock shared_lock { mutex };
-	std::unique_lock unique_lock { mutex, std::defer_lock };
-	auto itr = wrappers.find(ofType);
-
-	if (itr == wrappers.end())
+	if (!ofType)
 	{
-		// Trade the shared_lock for a unique_lock.
-		shared_lock.unlock();
-		unique_lock.lock();
+		// There's no type to own the wrapper, which only happens for undefined types.
+		const bool isList = (kind == introspection::TypeKind::LIST);
+		auto& wrapper = isList ? _undefinedList : _undefinedNonNull;
+
+		std::call_once(isList ? _undefinedListOnce : _undefinedNonNullOnce, [kind, &wrapper]() {
+			wrapper = WrapperType::Make(kind, {});
+		});
 
-		std::tie(itr, std::ignore) = wrappers.emplace(ofType, WrapperType::Make(kind, ofType));
+		return wrapper;
 	}
 
-	return itr->second;
+	return ofType->wrap(kind);
 }
 
 void Schema::AddDirective(std::shared_ptr<Directive> directive)
@@ -122,12 +121,57 @@ const std::vector<std::shared_ptr<const Directive>>& Schema::directives() const
 	return _directives;
 }
 
+std::shared_ptr<introspection::IntrospectionCache> Schema::introspectionCache() const
+{
+	std::call_once(_introspectionCacheOnce, [this]() {
+		_introspectionCache = std::make_shared<introspection::IntrospectionCache>();
+	});
+
+	return _introspectionCache;
+}
+
+std::shared_ptr<const service::ValidateSchema> Schema::validateSchema()
+{
+	std::call_once(_validateSchemaOnce, [this]() {
+		_validateSchema = std::make_shared<const service::ValidateSchema>(*this);
+	});
+
+	return _validateSchema;
+}
+
 BaseType::BaseType(introspection::TypeKind kind, std::string_view description)
 	: _kind(kind)
 	, _description(description)
 {
 }
 
+std::shared_ptr<const BaseType> BaseType::wrap(introspection::TypeKind kind) const
+{
+	const bool isList = (kind == introspection::TypeKind::LIST);
+	auto& wrapper = isList ? _listWrapper : _nonNullWrapper;
+
+	if (const auto published = wrapper.load(std::memory_order_acquire))
+	{
+		return published->shared_from_this();
+	}
+
+	std::shared_ptr<const BaseType> candidate = WrapperType::Make(kind, shared_from_this());
+	const BaseType* expected = nullptr;
+
+	if (!wrapper.compare_exchange_strong(expected,
+			candidate.get(),
+			std::memory_order_acq_rel,
+			std::memory_order_acquire))
+	{
+		// Another thread published its wrapper first, and it still owns that one.
+		return expected->shared_from_this();
+	}
+
+	(isList ? _listWrapperOwner : _nonNullWrapperOwner) = candidate;
+
+	return candidate;
+}
+
 introspection::TypeKind BaseType::kind() const noexcept
 {
 	return _kind;
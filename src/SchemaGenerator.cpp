@@ -20,6 +20,7 @@
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <map>
 #include <regex>
 #include <sstream>
 #include <stdexcept>
@@ -1280,6 +1281,9 @@ using namespace std::literals;
 static const auto s_values)cpp"
 					   << enumType.cppType << R"cpp( = )cpp" << _loader.getSchemaNamespace()
 					   << R"cpp(::get)cpp" << enumType.cppType << R"cpp(Values();
+static const auto s_enumNames)cpp"
+					   << enumType.cppType << R"cpp( = makeEnumNames(s_names)cpp"
+					   << enumType.cppType << R"cpp();
 
 template <>
 )cpp" << _loader.getSchemaNamespace()
@@ -1287,6 +1291,14 @@ template <>
 					   << _loader.getSchemaNamespace() << R"cpp(::)cpp" << enumType.cppType
 					   << R"cpp(>::convert(const response::Value& value)
 {
+	if (const auto index = findEnumName(s_enumNames)cpp"
+					   << enumType.cppType << R"cpp(, value))
+	{
+		return static_cast<)cpp"
+					   << _loader.getSchemaNamespace() << R"cpp(::)cpp" << enumType.cppType
+					   << R"cpp(>(*index);
+	}
+
 	if (!value.maybe_enum())
 	{
 		throw service::schema_exception { { R"ex(not a valid )cpp"
@@ -1320,12 +1332,8 @@ service::AwaitableResolver Result<)cpp"
 		[]()cpp" << _loader.getSchemaNamespace()
 					   << R"cpp(::)cpp" << enumType.cppType << R"cpp( value, const ResolverParams&)
 		{
-			response::Value result(response::Type::EnumValue);
-
-			result.set<std::string>(std::string { s_names)cpp"
-					   << enumType.cppType << R"cpp([static_cast<size_t>(value)] });
-
-			return result;
+			return response::Value { response::EnumName { s_enumNames)cpp"
+					   << enumType.cppType << R"cpp([static_cast<size_t>(value)] } };
 		});
 }
 
@@ -1334,6 +1342,12 @@ void Result<)cpp" << _loader.getSchemaNamespace()
 					   << R"cpp(::)cpp" << enumType.cppType
 					   << R"cpp(>::validateScalar(const response::Value& value)
 {
+	if (findEnumName(s_enumNames)cpp"
+					   << enumType.cppType << R"cpp(, value))
+	{
+		return;
+	}
+
 	if (!value.maybe_enum())
 	{
 		throw service::schema_exception { { R"ex(not a valid )cpp"
@@ -1376,7 +1390,7 @@ void Result<)cpp" << _loader.getSchemaNamespace()
 					if (firstField)
 					{
 						firstField = false;
-						sourceFile << R"cpp(	const auto defaultValue = []()
+						sourceFile << R"cpp(	static const auto defaultValue = []()
 	{
 		response::Value values(response::Type::Map);
 		response::Value entry;
@@ -1400,9 +1414,62 @@ void Result<)cpp" << _loader.getSchemaNamespace()
 )cpp";
 			}
 
+			// Find all of the members in a single pass, bucketing the names by length so each
+			// key only needs to be compared with the field names which have the same length.
+			std::map<size_t, std::vector<const InputField*>> fieldsByLength;
+
+			for (const auto& inputField : inputType.fields)
+			{
+				std::string fieldName(inputField.cppName);
+
+				fieldName[0] =
+					static_cast<char>(std::toupper(static_cast<unsigned char>(fieldName[0])));
+				sourceFile << R"cpp(	const response::Value* member)cpp" << fieldName
+						   << R"cpp( = nullptr;
+)cpp";
+				fieldsByLength[inputField.name.size()].push_back(&inputField);
+			}
+
+			sourceFile << R"cpp(
+	for (const auto& [name, member] : value.get<response::MapType>())
+	{
+		switch (name.size())
+		{
+)cpp";
+
+			for (const auto& [length, bucket] : fieldsByLength)
+			{
+				sourceFile << R"cpp(			case )cpp" << length << R"cpp(:
+)cpp";
+
+				for (const auto inputField : bucket)
+				{
+					std::string fieldName(inputField->cppName);
+
+					fieldName[0] =
+						static_cast<char>(std::toupper(static_cast<unsigned char>(fieldName[0])));
+					sourceFile << R"cpp(				if (name == ")cpp" << inputField->name
+							   << R"cpp("sv)
+				{
+					member)cpp" << fieldName
+							   << R"cpp( = &member;
+					continue;
+				}
+)cpp";
+				}
+
+				sourceFile << R"cpp(				break;
+)cpp";
+			}
+
+			sourceFile << R"cpp(		}
+	}
+
+)cpp";
+
 			for (const auto& inputField : inputType.fields)
 			{
-				sourceFile << getArgumentDeclaration(inputField, "value", "value", "defaultValue");
+				sourceFile << getInputFieldDeclaration(inputField, "defaultValue");
 			}
 
 			if (!inputType.fields.empty())
@@ -2361,7 +2428,7 @@ service::AwaitableResolver )cpp"
 			{
 				sourceFile << getArgumentDeclaration(argument,
 					"arg",
-					"params.arguments",
+					"params",
 					"defaultArguments");
 			}
 		}
@@ -2447,10 +2514,7 @@ service::AwaitableResolver )cpp"
 	const auto& baseType = _schema->LookupType(argName);
 	std::shared_ptr<)cpp"
 			<< SchemaLoader::getIntrospectionNamespace()
-			<< R"cpp(::object::Type> result { baseType ? std::make_shared<)cpp"
-			<< SchemaLoader::getIntrospectionNamespace()
-			<< R"cpp(::object::Type>(std::make_shared<)cpp"
-			<< SchemaLoader::getIntrospectionNamespace() << R"cpp(::Type>(baseType)) : nullptr };
+			<< R"cpp(::object::Type> result { baseType ? _schema->introspectionCache()->get(baseType) : nullptr };
 
 	return service::ModifiedResult<)cpp"
 			<< SchemaLoader::getIntrospectionNamespace()
@@ -2769,6 +2833,41 @@ std::string Generator::getArgumentDeclaration(const InputField& argument, const
 	return argumentDeclaration.str();
 }
 
+std::string Generator::getInputFieldDeclaration(
+	const InputField& inputField, const char* defaultToken) const noexcept
+{
+	std::ostringstream fieldDeclaration;
+	std::string fieldName(inputField.cppName);
+
+	fieldName[0] = static_cast<char>(std::toupper(static_cast<unsigned char>(fieldName[0])));
+	if (inputField.defaultValue.type() == response::Type::Null)
+	{
+		fieldDeclaration << R"cpp(	auto value)cpp" << fieldName << R"cpp( = )cpp"
+						 << getArgumentAccessType(inputField) << R"cpp(::requireMember)cpp"
+						 << getTypeModifiers(inputField.modifiers) << R"cpp((")cpp"
+						 << inputField.name << R"cpp(", member)cpp" << fieldName << R"cpp();
+)cpp";
+	}
+	else
+	{
+		fieldDeclaration << R"cpp(	auto pair)cpp" << fieldName << R"cpp( = )cpp"
+						 << getArgumentAccessType(inputField) << R"cpp(::findMember)cpp"
+						 << getTypeModifiers(inputField.modifiers) << R"cpp((")cpp"
+						 << inputField.name << R"cpp(", member)cpp" << fieldName << R"cpp();
+	auto value)cpp" << fieldName
+						 << R"cpp( = (pair)cpp" << fieldName << R"cpp(.second
+		? std::move(pair)cpp"
+						 << fieldName << R"cpp(.first)
+		: )cpp" << getArgumentAccessType(inputField)
+						 << R"cpp(::require)cpp" << getTypeModifiers(inputField.modifiers)
+						 << R"cpp((")cpp" << inputField.name << R"cpp(", )cpp" << defaultToken
+						 << R"cpp());
+)cpp";
+	}
+
+	return fieldDeclaration.str();
+}
+
 std::string Generator::getArgumentAccessType(const InputField& argument) const noexcept
 {
 	std::ostringstream argumentType;
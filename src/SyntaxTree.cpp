@@ -866,6 +866,9 @@ template <>
 const char* ast_control<executable_document_content>::error_message =
 	"Expected executable https://spec.graphql.org/October2021/#Document";
 template <>
+const char* ast_control<executable_stream_definition_content>::error_message =
+	"Expected https://spec.graphql.org/October2021/#ExecutableDefinition";
+template <>
 const char* ast_control<schema_document_content>::error_message =
 	"Expected schema type https://spec.graphql.org/October2021/#Document";
 
@@ -998,6 +1001,55 @@ private:
 	const size_t _depthLimit;
 };
 
+void normalizeDocument(ast& query)
+{
+	if (!query.root || !query.normalized.empty())
+	{
+		return;
+	}
+
+	auto result = normalizeDocument(*query.root);
+
+	query.hash = std::hash<std::string> {}(result);
+	query.normalized = std::move(result);
+}
+
+std::string normalizeDocument(const ast_node& root)
+{
+	// Each node adds its rule ID and number of children, and each leaf node adds the length of
+	// its content followed by the content, so different documents can't serialize the same way.
+	std::string result;
+	const auto append = [&result](size_t value) {
+		result.append(reinterpret_cast<const char*>(&value), sizeof(value));
+	};
+	std::vector<const ast_node*> pending { &root };
+
+	while (!pending.empty())
+	{
+		const auto node = pending.back();
+
+		pending.pop_back();
+		append(node->rule_id());
+		append(node->children.size());
+
+		if (node->children.empty())
+		{
+			const auto content = node->has_content() ? node->string_view() : std::string_view {};
+
+			append(content.size());
+			result.append(content);
+			continue;
+		}
+
+		for (auto itr = node->children.crbegin(); itr != node->children.crend(); ++itr)
+		{
+			pending.push_back(itr->get());
+		}
+	}
+
+	return result;
+}
+
 using ast_file = depth_limit_input<file_input<>>;
 using ast_memory = depth_limit_input<memory_input<>>;
 
@@ -1146,6 +1198,46 @@ ast parseFile(std::string_view filename, size_t depthLimit)
 	return result;
 }
 
+template <class ParseInput>
+void parseDefinitions(const std::shared_ptr<ast_input>& input, ParseInput& in,
+	const ast_definition_callback& callback)
+{
+	// Skip the leading whitespace/ignored tokens, then parse one definition at a time so each of
+	// them can be handed off to the callback before we parse the next one.
+	tao::graphqlpeg::parse<executable_stream_prefix>(in);
+
+	do
+	{
+		ast result { input,
+			graphql_parse_tree::
+				parse<executable_stream_definition, ast_action, executable_selector>(in) };
+
+		callback(std::move(result));
+	} while (!in.empty());
+}
+
+void parseStringDefinitions(
+	std::string_view input, const ast_definition_callback& callback, size_t depthLimit)
+{
+	auto streamInput = std::make_shared<ast_input>(
+		ast_input { ast_string { { input.cbegin(), input.cend() } } });
+	auto& data = std::get<ast_string>(streamInput->data);
+
+	data.memory =
+		std::make_unique<ast_memory>(depthLimit, data.input.data(), data.input.size(), "GraphQL"s);
+	parseDefinitions(streamInput, *data.memory, callback);
+}
+
+void parseFileDefinitions(
+	std::string_view filename, const ast_definition_callback& callback, size_t depthLimit)
+{
+	auto streamInput =
+		std::make_shared<ast_input>(ast_input { std::make_unique<ast_file>(depthLimit, filename) });
+	auto& in = *std::get<std::unique_ptr<ast_file>>(streamInput->data);
+
+	parseDefinitions(streamInput, in, callback);
+}
+
 } // namespace peg
 
 peg::ast operator"" _graphql(const char* text, size_t size)
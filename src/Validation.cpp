@@ -9,14 +9,36 @@
 #include "graphqlservice/introspection/IntrospectionSchema.h"
 
 #include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
 #include <iostream>
 #include <iterator>
+#include <limits>
 #include <stdexcept>
 
 using namespace std::literals;
 
 namespace graphql::service {
 
+namespace {
+
+// The estimated cost can grow exponentially with nested lists, so clamp it instead of overflowing.
+constexpr size_t saturatingAdd(size_t lhs, size_t rhs) noexcept
+{
+	return lhs > std::numeric_limits<size_t>::max() - rhs ? std::numeric_limits<size_t>::max()
+														  : lhs + rhs;
+}
+
+constexpr size_t saturatingMultiply(size_t lhs, size_t rhs) noexcept
+{
+	return rhs != 0 && lhs > std::numeric_limits<size_t>::max() / rhs
+		? std::numeric_limits<size_t>::max()
+		: lhs * rhs;
+}
+
+} // namespace
+
 SharedType getSharedType(const ValidateType& type) noexcept
 {
 	return type ? type->get().shared_from_this() : SharedType {};
@@ -34,6 +56,113 @@ bool operator==(const ValidateType& lhs, const ValidateType& rhs) noexcept
 	return (lhs ? (rhs && &lhs->get() == &rhs->get()) : !rhs);
 }
 
+ValidateThreadPool::ValidateThreadPool(size_t threadCount)
+{
+	_workers.reserve(threadCount);
+
+	for (size_t i = 0; i < threadCount; ++i)
+	{
+		_workers.emplace_back([this]() {
+			runTasks();
+		});
+	}
+}
+
+ValidateThreadPool::~ValidateThreadPool()
+{
+	std::unique_lock lock { _mutex };
+
+	_shutdown = true;
+	lock.unlock();
+	_startCv.notify_all();
+
+	for (auto& worker : _workers)
+	{
+		worker.join();
+	}
+}
+
+size_t ValidateThreadPool::size() const noexcept
+{
+	return _workers.size();
+}
+
+void ValidateThreadPool::start(size_t taskCount, const std::function<void(size_t)>& task)
+{
+	std::unique_lock lock { _mutex };
+
+	_task = &task;
+	_taskCount = std::min(taskCount, _workers.size());
+	_nextTask = 0;
+	_runningTasks = _taskCount;
+	_exception = nullptr;
+	lock.unlock();
+	_startCv.notify_all();
+}
+
+void ValidateThreadPool::wait()
+{
+	std::unique_lock lock { _mutex };
+
+	_doneCv.wait(lock, [this]() {
+		return _runningTasks == 0;
+	});
+
+	_task = nullptr;
+	_taskCount = 0;
+	_nextTask = 0;
+
+	if (auto exception = std::exchange(_exception, nullptr))
+	{
+		std::rethrow_exception(exception);
+	}
+}
+
+void ValidateThreadPool::runTasks()
+{
+	std::unique_lock lock { _mutex };
+
+	while (!_shutdown)
+	{
+		_startCv.wait(lock, [this]() {
+			return _shutdown || _nextTask < _taskCount;
+		});
+
+		if (_shutdown)
+		{
+			break;
+		}
+
+		const auto index = _nextTask++;
+		const auto& task = *_task;
+
+		lock.unlock();
+
+		std::exception_ptr exception;
+
+		try
+		{
+			task(index);
+		}
+		catch (...)
+		{
+			exception = std::current_exception();
+		}
+
+		lock.lock();
+
+		if (exception && !_exception)
+		{
+			_exception = std::move(exception);
+		}
+
+		if (--_runningTasks == 0)
+		{
+			_doneCv.notify_all();
+		}
+	}
+}
+
 bool ValidateArgumentVariable::operator==(const ValidateArgumentVariable& other) const
 {
 	return name == other.name;
@@ -280,7 +409,7 @@ bool ValidateField::operator==(const ValidateField& other) const
 }
 
 ValidateVariableTypeVisitor::ValidateVariableTypeVisitor(
-	const std::shared_ptr<schema::Schema>& schema, const ValidateTypes& types)
+	const std::shared_ptr<schema::Schema>& schema, const ValidateHashedTypes& types)
 	: _schema(schema)
 	, _types(types)
 {
@@ -358,46 +487,52 @@ ValidateType ValidateVariableTypeVisitor::getType()
 	return result;
 }
 
-ValidateExecutableVisitor::ValidateExecutableVisitor(std::shared_ptr<schema::Schema> schema)
-	: _schema(schema)
+ValidateSchema::ValidateSchema(schema::Schema& schema)
 {
-	const auto& queryType = _schema->queryType();
-	const auto& mutationType = _schema->mutationType();
-	const auto& subscriptionType = _schema->subscriptionType();
+	const auto& queryType = schema.queryType();
+	const auto& mutationType = schema.mutationType();
+	const auto& subscriptionType = schema.subscriptionType();
 
-	_operationTypes.reserve(3);
+	operationTypes.reserve(3);
 
 	if (mutationType)
 	{
-		_operationTypes[strMutation] = getValidateType(mutationType);
+		operationTypes[strMutation] = getValidateType(mutationType);
 	}
 
 	if (queryType)
 	{
-		_operationTypes[strQuery] = getValidateType(queryType);
+		operationTypes[strQuery] = getValidateType(queryType);
 	}
 
 	if (subscriptionType)
 	{
-		_operationTypes[strSubscription] = getValidateType(subscriptionType);
+		operationTypes[strSubscription] = getValidateType(subscriptionType);
 	}
 
-	const auto& types = _schema->types();
+	// Collect everything in sorted maps first, and then build the hashed index for each of them.
+	const auto& schemaTypes = schema.types();
+	ValidateTypes sortedTypes;
+	internal::string_view_map<internal::string_view_hash_set> sortedMatchingTypes;
+	internal::string_view_map<internal::string_view_hash_set> sortedEnumValues;
+	internal::string_view_set sortedScalarTypes;
+	internal::string_view_map<FieldTypes> sortedTypeFields;
+	internal::string_view_map<InputFieldTypes> sortedInputTypeFields;
 
-	_types.reserve(types.size());
+	sortedTypes.reserve(schemaTypes.size());
 
-	for (const auto& entry : types)
+	for (const auto& entry : schemaTypes)
 	{
 		const auto name = entry.first;
 		const auto kind = entry.second->kind();
 
 		if (!isScalarType(kind))
 		{
-			auto matchingTypes = std::move(_matchingTypes[name]);
+			internal::string_view_set possibleMatches;
 
 			if (kind == introspection::TypeKind::OBJECT)
 			{
-				matchingTypes.emplace(name);
+				possibleMatches.emplace(name);
 			}
 			else
 			{
@@ -405,12 +540,12 @@ ValidateExecutableVisitor::ValidateExecutableVisitor(std::shared_ptr<schema::Sch
 
 				if (kind == introspection::TypeKind::INTERFACE)
 				{
-					matchingTypes.reserve(possibleTypes.size() + 1);
-					matchingTypes.emplace(name);
+					possibleMatches.reserve(possibleTypes.size() + 1);
+					possibleMatches.emplace(name);
 				}
 				else
 				{
-					matchingTypes.reserve(possibleTypes.size());
+					possibleMatches.reserve(possibleTypes.size());
 				}
 
 				for (const auto& possibleType : possibleTypes)
@@ -419,24 +554,28 @@ ValidateExecutableVisitor::ValidateExecutableVisitor(std::shared_ptr<schema::Sch
 
 					if (spType)
 					{
-						matchingTypes.emplace(spType->name());
+						possibleMatches.emplace(spType->name());
 					}
 				}
 			}
 
-			if (!matchingTypes.empty())
+			if (!possibleMatches.empty())
 			{
-				_matchingTypes[name] = std::move(matchingTypes);
+				sortedMatchingTypes[name] =
+					internal::string_view_hash_set { std::move(possibleMatches) };
 			}
+
+			sortedTypeFields[name] =
+				getTypeFields(schema, *entry.second, entry.second == queryType);
 		}
 		else if (kind == introspection::TypeKind::ENUM)
 		{
-			const auto& enumValues = entry.second->enumValues();
+			const auto& schemaEnumValues = entry.second->enumValues();
 			internal::string_view_set values;
 
-			values.reserve(enumValues.size());
+			values.reserve(schemaEnumValues.size());
 
-			for (const auto& value : enumValues)
+			for (const auto& value : schemaEnumValues)
 			{
 				if (value)
 				{
@@ -444,24 +583,36 @@ ValidateExecutableVisitor::ValidateExecutableVisitor(std::shared_ptr<schema::Sch
 				}
 			}
 
-			if (!enumValues.empty())
+			if (!schemaEnumValues.empty())
 			{
-				_enumValues[name] = std::move(values);
+				sortedEnumValues[name] = internal::string_view_hash_set { std::move(values) };
 			}
 		}
 		else if (kind == introspection::TypeKind::SCALAR)
 		{
-			_scalarTypes.emplace(name);
+			sortedScalarTypes.emplace(name);
+		}
+		else if (kind == introspection::TypeKind::INPUT_OBJECT)
+		{
+			sortedInputTypeFields[name] = getArguments(entry.second->inputFields());
 		}
 
-		_types[name] = getValidateType(entry.second);
+		sortedTypes[name] = getValidateType(entry.second);
 	}
 
-	const auto& directives = _schema->directives();
+	types = ValidateHashedTypes { std::move(sortedTypes) };
+	matchingTypes = MatchingTypes { std::move(sortedMatchingTypes) };
+	enumValues = EnumValues { std::move(sortedEnumValues) };
+	scalarTypes = ScalarTypes { std::move(sortedScalarTypes) };
+	typeFields = TypeFields { std::move(sortedTypeFields) };
+	inputTypeFields = InputTypeFields { std::move(sortedInputTypeFields) };
+
+	const auto& schemaDirectives = schema.directives();
+	internal::string_view_map<ValidateDirective> sortedDirectives;
 
-	_directives.reserve(directives.size());
+	sortedDirectives.reserve(schemaDirectives.size());
 
-	for (const auto& directive : directives)
+	for (const auto& directive : schemaDirectives)
 	{
 		const auto name = directive->name();
 		const auto& locations = directive->locations();
@@ -476,12 +627,126 @@ ValidateExecutableVisitor::ValidateExecutableVisitor(std::shared_ptr<schema::Sch
 		}
 
 		validateDirective.arguments = getArguments(args);
-		_directives[name] = std::move(validateDirective);
+		sortedDirectives[name] = std::move(validateDirective);
+	}
+
+	directives = Directives { std::move(sortedDirectives) };
+}
+
+constexpr bool ValidateSchema::isScalarType(introspection::TypeKind kind) noexcept
+{
+	switch (kind)
+	{
+		case introspection::TypeKind::OBJECT:
+		case introspection::TypeKind::INTERFACE:
+		case introspection::TypeKind::UNION:
+			return false;
+
+		default:
+			return true;
+	}
+}
+
+ValidateTypeFieldArguments ValidateSchema::getArguments(
+	const std::vector<std::shared_ptr<const schema::InputValue>>& args)
+{
+	ValidateTypeFieldArguments result;
+
+	for (const auto& arg : args)
+	{
+		if (!arg)
+		{
+			continue;
+		}
+
+		ValidateArgument argument;
+
+		argument.defaultValue = !arg->defaultValue().empty();
+		argument.nonNullDefaultValue =
+			argument.defaultValue && arg->defaultValue() != R"gql(null)gql"sv;
+		argument.type = getValidateType(arg->type().lock());
+
+		result[arg->name()] = std::move(argument);
+	}
+
+	return result;
+}
+
+ValidateSchema::FieldTypes ValidateSchema::getTypeFields(
+	schema::Schema& schema, const schema::BaseType& type, bool isQueryType)
+{
+	const auto& fields = type.fields();
+	internal::string_view_map<ValidateTypeField> validateFields;
+
+	for (auto& entry : fields)
+	{
+		if (!entry)
+		{
+			continue;
+		}
+
+		const auto fieldName = entry->name();
+		ValidateTypeField subField;
+
+		subField.returnType = getValidateType(entry->type().lock());
+
+		if (fieldName.empty() || !subField.returnType)
+		{
+			continue;
+		}
+
+		subField.arguments = getArguments(entry->args());
+
+		validateFields[fieldName] = std::move(subField);
 	}
+
+	if (schema.supportsIntrospection() && isQueryType)
+	{
+		ValidateTypeField schemaField;
+
+		schemaField.returnType = getValidateType(schema.WrapType(introspection::TypeKind::NON_NULL,
+			schema.LookupType(R"gql(__Schema)gql"sv)));
+		validateFields[R"gql(__schema)gql"sv] = std::move(schemaField);
+
+		ValidateTypeField typeField;
+		ValidateArgument nameArgument;
+
+		typeField.returnType = getValidateType(schema.LookupType(R"gql(__Type)gql"sv));
+
+		nameArgument.type = getValidateType(schema.WrapType(introspection::TypeKind::NON_NULL,
+			schema.LookupType(R"gql(String)gql"sv)));
+		typeField.arguments[R"gql(name)gql"sv] = std::move(nameArgument);
+
+		validateFields[R"gql(__type)gql"sv] = std::move(typeField);
+	}
+
+	ValidateTypeField typenameField;
+
+	typenameField.returnType = getValidateType(schema.WrapType(introspection::TypeKind::NON_NULL,
+		schema.LookupType(R"gql(String)gql"sv)));
+	validateFields[R"gql(__typename)gql"sv] = std::move(typenameField);
+
+	return FieldTypes { std::move(validateFields) };
+}
+
+ValidateExecutableVisitor::ValidateExecutableVisitor(std::shared_ptr<schema::Schema> schema)
+	: _schema(std::move(schema))
+	, _validateSchema(_schema->validateSchema())
+	, _operationTypes(_validateSchema->operationTypes)
+	, _types(_validateSchema->types)
+	, _matchingTypes(_validateSchema->matchingTypes)
+	, _directives(_validateSchema->directives)
+	, _enumValues(_validateSchema->enumValues)
+	, _scalarTypes(_validateSchema->scalarTypes)
+	, _typeFields(_validateSchema->typeFields)
+	, _inputTypeFields(_validateSchema->inputTypeFields)
+{
 }
 
 void ValidateExecutableVisitor::visit(const peg::ast_node& root)
 {
+	_operationCosts.clear();
+
 	// Visit all of the fragment definitions and check for duplicates.
 	peg::for_each_child<peg::fragment_definition>(root,
 		[this](const peg::ast_node& fragmentDefinition) {
@@ -504,13 +769,8 @@ void ValidateExecutableVisitor::visit(const peg::ast_node& root)
 	// Visit all of the operation definitions and check for duplicates.
 	peg::for_each_child<peg::operation_definition>(root,
 		[this](const peg::ast_node& operationDefinition) {
-			std::string_view operationName;
-
-			peg::on_first_child<peg::operation_name>(operationDefinition,
-				[&operationName](const peg::ast_node& child) {
-					operationName = child.string_view();
-				});
-
+			const auto operationName =
+				peg::first_child_view<peg::operation_name>(operationDefinition);
 			const auto inserted = _operationDefinitions.emplace(operationName, operationDefinition);
 
 			if (!inserted.second)
@@ -545,22 +805,15 @@ void ValidateExecutableVisitor::visit(const peg::ast_node& root)
 	}
 
 	// Visit the executable definitions recursively.
-	for (const auto& child : root.children)
+	if (_concurrency > 1 && root.children.size() > 1)
 	{
-		if (child->is_type<peg::fragment_definition>())
-		{
-			visitFragmentDefinition(*child);
-		}
-		else if (child->is_type<peg::operation_definition>())
+		visitDefinitionsInParallel(root);
+	}
+	else
+	{
+		for (const auto& child : root.children)
 		{
-			visitOperationDefinition(*child);
-		}
-		else
-		{
-			// https://spec.graphql.org/October2021/#sec-Executable-Definitions
-			auto position = child->begin();
-
-			_errors.push_back({ "Unexpected type definition", { position.line, position.column } });
+			visitDefinition(*child);
 		}
 	}
 
@@ -597,15 +850,177 @@ std::list<schema_error> ValidateExecutableVisitor::getStructuredErrors()
 	_operationDefinitions.clear();
 	_referencedFragments.clear();
 	_fragmentCycles.clear();
+	_operationCosts.clear();
 
 	return errors;
 }
 
+void ValidateExecutableVisitor::setCostOptions(RequestCostOptions options)
+{
+	_costOptions = std::move(options);
+}
+
+void ValidateExecutableVisitor::setConcurrency(size_t concurrency)
+{
+	_concurrency = std::max(size_t { 1 }, concurrency);
+
+	// The calling thread also takes part in the validation, so it needs one less worker thread.
+	if (_concurrency == 1)
+	{
+		_threadPool.reset();
+	}
+	else if (!_threadPool || _threadPool->size() != _concurrency - 1)
+	{
+		_threadPool.reset();
+		_threadPool = std::make_shared<ValidateThreadPool>(_concurrency - 1);
+	}
+}
+
+std::map<std::string_view, size_t, std::less<>> ValidateExecutableVisitor::getOperationCosts()
+{
+	auto operationCosts = std::move(_operationCosts);
+
+	_operationCosts.clear();
+
+	return operationCosts;
+}
+
+void ValidateExecutableVisitor::visitDefinition(const peg::ast_node& definition)
+{
+	if (definition.is_type<peg::fragment_definition>())
+	{
+		visitFragmentDefinition(definition);
+	}
+	else if (definition.is_type<peg::operation_definition>())
+	{
+		visitOperationDefinition(definition);
+	}
+	else
+	{
+		// https://spec.graphql.org/October2021/#sec-Executable-Definitions
+		auto position = definition.begin();
+
+		_errors.push_back({ "Unexpected type definition", { position.line, position.column } });
+	}
+}
+
+void ValidateExecutableVisitor::visitDefinitionsInParallel(const peg::ast_node& root)
+{
+	struct DefinitionResult
+	{
+		std::list<schema_error> errors;
+		FragmentCycles fragmentCycles;
+		std::map<std::string_view, size_t, std::less<>> operationCosts;
+	};
+
+	const auto definitionCount = root.children.size();
+	std::vector<DefinitionResult> results(definitionCount);
+	std::atomic_size_t nextDefinition = 0;
+
+	// Each worker gets its own copy of the visitor, including the fragment definitions we already
+	// collected, so they do not share any mutable state. The workers pull the next definition
+	// from a shared index and record the results in a separate slot for each definition.
+	ValidateExecutableVisitor prototype { *this };
+
+	prototype._errors.clear();
+	prototype._referencedFragments.clear();
+	prototype._fragmentCycles.clear();
+	prototype._operationCosts.clear();
+
+	std::vector<ValidateExecutableVisitor> workers(
+		std::min(_concurrency, definitionCount) - 1,
+		prototype);
+	const auto visitDefinitions = [&root, &results, &nextDefinition, definitionCount](
+									  ValidateExecutableVisitor& worker) {
+		for (auto index = nextDefinition++; index < definitionCount; index = nextDefinition++)
+		{
+			auto& result = results[index];
+
+			worker.visitDefinition(*root.children[index]);
+			result.errors = std::move(worker._errors);
+			result.fragmentCycles = std::move(worker._fragmentCycles);
+			result.operationCosts = std::move(worker._operationCosts);
+			worker._errors.clear();
+			worker._fragmentCycles.clear();
+			worker._operationCosts.clear();
+		}
+	};
+	const std::function<void(size_t)> visitWorkerDefinitions =
+		[&workers, &visitDefinitions](size_t index) {
+			visitDefinitions(workers[index]);
+		};
+
+	_threadPool->start(workers.size(), visitWorkerDefinitions);
+
+	// The calling thread also takes part in the validation, but the workers still reference the
+	// results on this stack frame, so wait for them even if it throws.
+	std::exception_ptr callerException;
+
+	try
+	{
+		visitDefinitions(prototype);
+	}
+	catch (...)
+	{
+		callerException = std::current_exception();
+	}
+
+	_threadPool->wait();
+
+	if (callerException)
+	{
+		std::rethrow_exception(callerException);
+	}
+
+	workers.push_back(std::move(prototype));
+
+	for (const auto& worker : workers)
+	{
+		for (const auto& name : worker._referencedFragments)
+		{
+			_referencedFragments.emplace(name);
+		}
+	}
+
+	// Merge the results in document order, so the errors match what we would have reported if we
+	// visited the definitions serially. That means we only report each fragment cycle the first
+	// time we encounter it.
+	for (auto& result : results)
+	{
+		internal::sorted_map<size_t, std::string_view> cycleErrors;
+
+		for (const auto& [name, index] : result.fragmentCycles)
+		{
+			cycleErrors.emplace(index, name);
+		}
+
+		for (size_t index = 0; !result.errors.empty(); ++index)
+		{
+			const auto itrCycle = cycleErrors.find(index);
+
+			if (itrCycle != cycleErrors.end()
+				&& !_fragmentCycles.emplace(itrCycle->second, _errors.size()).second)
+			{
+				result.errors.pop_front();
+				continue;
+			}
+
+			_errors.splice(_errors.end(), result.errors, result.errors.begin());
+		}
+
+		for (const auto& [name, cost] : result.operationCosts)
+		{
+			_operationCosts[name] = cost;
+		}
+	}
+}
+
 void ValidateExecutableVisitor::visitFragmentDefinition(const peg::ast_node& fragmentDefinition)
 {
-	peg::on_first_child<peg::directives>(fragmentDefinition, [this](const peg::ast_node& child) {
-		visitDirectives(introspection::DirectiveLocation::FRAGMENT_DEFINITION, child);
-	});
+	if (const auto directives = peg::first_child<peg::directives>(fragmentDefinition))
+	{
+		visitDirectives(introspection::DirectiveLocation::FRAGMENT_DEFINITION, *directives);
+	}
 
 	const auto name = fragmentDefinition.children.front()->string_view();
 	const auto& selection = *fragmentDefinition.children.back();
@@ -614,7 +1029,7 @@ void ValidateExecutableVisitor::visitFragmentDefinition(const peg::ast_node& fra
 
 	auto itrType = _types.find(innerType);
 
-	if (itrType == _types.end() || isScalarType(itrType->second->get().kind()))
+	if (itrType == _types.end() || ValidateSchema::isScalarType(itrType->second->get().kind()))
 	{
 		// https://spec.graphql.org/October2021/#sec-Fragment-Spread-Type-Existence
 		// https://spec.graphql.org/October2021/#sec-Fragments-On-Composite-Types
@@ -641,19 +1056,9 @@ void ValidateExecutableVisitor::visitFragmentDefinition(const peg::ast_node& fra
 
 void ValidateExecutableVisitor::visitOperationDefinition(const peg::ast_node& operationDefinition)
 {
-	auto operationType = strQuery;
-
-	peg::on_first_child<peg::operation_type>(operationDefinition,
-		[&operationType](const peg::ast_node& child) {
-			operationType = child.string_view();
-		});
-
-	std::string_view operationName;
-
-	peg::on_first_child<peg::operation_name>(operationDefinition,
-		[&operationName](const peg::ast_node& child) {
-			operationName = child.string_view();
-		});
+	const auto type = peg::first_child<peg::operation_type>(operationDefinition);
+	const auto operationType = type ? type->string_view() : strQuery;
+	const auto operationName = peg::first_child_view<peg::operation_name>(operationDefinition);
 
 	_operationVariables = std::make_optional<VariableTypes>();
 
@@ -752,21 +1157,21 @@ void ValidateExecutableVisitor::visitOperationDefinition(const peg::ast_node& op
 			_operationVariables->emplace(variableName, std::move(variableArgument));
 		});
 
-	peg::on_first_child<peg::directives>(operationDefinition,
-		[this, &operationType](const peg::ast_node& child) {
-			auto location = introspection::DirectiveLocation::QUERY;
+	if (const auto directives = peg::first_child<peg::directives>(operationDefinition))
+	{
+		auto location = introspection::DirectiveLocation::QUERY;
 
-			if (operationType == strMutation)
-			{
-				location = introspection::DirectiveLocation::MUTATION;
-			}
-			else if (operationType == strSubscription)
-			{
-				location = introspection::DirectiveLocation::SUBSCRIPTION;
-			}
+		if (operationType == strMutation)
+		{
+			location = introspection::DirectiveLocation::MUTATION;
+		}
+		else if (operationType == strSubscription)
+		{
+			location = introspection::DirectiveLocation::SUBSCRIPTION;
+		}
 
-			visitDirectives(location, child);
-		});
+		visitDirectives(location, *directives);
+	}
 
 	auto itrType = _operationTypes.find(operationType);
 
@@ -784,11 +1189,14 @@ void ValidateExecutableVisitor::visitOperationDefinition(const peg::ast_node& op
 	_scopedType = itrType->second;
 	_introspectionFieldCount = 0;
 	_fieldCount = 0;
+	_selectionCost = 0;
 
 	const auto& selection = *operationDefinition.children.back();
 
 	visitSelection(selection);
 
+	_operationCosts[operationName] = _selectionCost;
+
 	if (operationType == strSubscription)
 	{
 		if (_fieldCount > 1)
@@ -866,45 +1274,6 @@ void ValidateExecutableVisitor::visitSelection(const peg::ast_node& selection)
 	}
 }
 
-ValidateTypeFieldArguments ValidateExecutableVisitor::getArguments(
-	const std::vector<std::shared_ptr<const schema::InputValue>>& args)
-{
-	ValidateTypeFieldArguments result;
-
-	for (const auto& arg : args)
-	{
-		if (!arg)
-		{
-			continue;
-		}
-
-		ValidateArgument argument;
-
-		argument.defaultValue = !arg->defaultValue().empty();
-		argument.nonNullDefaultValue =
-			argument.defaultValue && arg->defaultValue() != R"gql(null)gql"sv;
-		argument.type = getValidateType(arg->type().lock());
-
-		result[arg->name()] = std::move(argument);
-	}
-
-	return result;
-}
-
-constexpr bool ValidateExecutableVisitor::isScalarType(introspection::TypeKind kind)
-{
-	switch (kind)
-	{
-		case introspection::TypeKind::OBJECT:
-		case introspection::TypeKind::INTERFACE:
-		case introspection::TypeKind::UNION:
-			return false;
-
-		default:
-			return true;
-	}
-}
-
 bool ValidateExecutableVisitor::matchesScopedType(std::string_view name) const
 {
 	if (name == _scopedType->get().name())
@@ -1410,91 +1779,15 @@ bool ValidateExecutableVisitor::validateVariableType(bool isNonNull,
 }
 
 ValidateExecutableVisitor::TypeFields::const_iterator ValidateExecutableVisitor::
-	getScopedTypeFields()
+	getScopedTypeFields() const
 {
-	auto typeKind = _scopedType->get().kind();
-	auto itrType = _typeFields.find(_scopedType->get().name());
-
-	if (itrType == _typeFields.end() && !isScalarType(typeKind))
-	{
-		const auto& fields = _scopedType->get().fields();
-		internal::string_view_map<ValidateTypeField> validateFields;
-
-		for (auto& entry : fields)
-		{
-			if (!entry)
-			{
-				continue;
-			}
-
-			const auto fieldName = entry->name();
-			ValidateTypeField subField;
-
-			subField.returnType = getValidateType(entry->type().lock());
-
-			if (fieldName.empty() || !subField.returnType)
-			{
-				continue;
-			}
-
-			subField.arguments = getArguments(entry->args());
-
-			validateFields[fieldName] = std::move(subField);
-		}
-
-		if (_schema->supportsIntrospection() && _scopedType == _operationTypes[strQuery])
-		{
-			ValidateTypeField schemaField;
-
-			schemaField.returnType =
-				getValidateType(_schema->WrapType(introspection::TypeKind::NON_NULL,
-					_schema->LookupType(R"gql(__Schema)gql"sv)));
-			validateFields[R"gql(__schema)gql"sv] = std::move(schemaField);
-
-			ValidateTypeField typeField;
-			ValidateArgument nameArgument;
-
-			typeField.returnType = getValidateType(_schema->LookupType(R"gql(__Type)gql"sv));
-
-			nameArgument.type = getValidateType(_schema->WrapType(introspection::TypeKind::NON_NULL,
-				_schema->LookupType(R"gql(String)gql"sv)));
-			typeField.arguments[R"gql(name)gql"sv] = std::move(nameArgument);
-
-			validateFields[R"gql(__type)gql"sv] = std::move(typeField);
-		}
-
-		ValidateTypeField typenameField;
-
-		typenameField.returnType =
-			getValidateType(_schema->WrapType(introspection::TypeKind::NON_NULL,
-				_schema->LookupType(R"gql(String)gql"sv)));
-		validateFields[R"gql(__typename)gql"sv] = std::move(typenameField);
-
-		itrType = _typeFields.emplace(_scopedType->get().name(), std::move(validateFields)).first;
-	}
-
-	return itrType;
+	return _typeFields.find(_scopedType->get().name());
 }
 
 ValidateExecutableVisitor::InputTypeFields::const_iterator ValidateExecutableVisitor::
-	getInputTypeFields(std::string_view name)
+	getInputTypeFields(std::string_view name) const
 {
-	auto itrFields = _inputTypeFields.find(name);
-
-	if (itrFields == _inputTypeFields.end())
-	{
-		auto itrType = _types.find(name);
-
-		if (itrType != _types.end()
-			&& itrType->second->get().kind() == introspection::TypeKind::INPUT_OBJECT)
-		{
-			itrFields =
-				_inputTypeFields.emplace(name, getArguments(itrType->second->get().inputFields()))
-					.first;
-		}
-	}
-
-	return itrFields;
+	return _inputTypeFields.find(name);
 }
 
 template <class _FieldTypes>
@@ -1520,13 +1813,13 @@ ValidateType ValidateExecutableVisitor::getFieldType(
 }
 
 const ValidateType& ValidateExecutableVisitor::getValidateFieldType(
-	const FieldTypes::mapped_type& value)
+	const ValidateTypeField& value)
 {
 	return value.returnType;
 }
 
 const ValidateType& ValidateExecutableVisitor::getValidateFieldType(
-	const InputFieldTypes::mapped_type& value)
+	const ValidateArgument& value)
 {
 	return value.type;
 }
@@ -1547,15 +1840,12 @@ ValidateType ValidateExecutableVisitor::getWrappedFieldType(
 
 void ValidateExecutableVisitor::visitField(const peg::ast_node& field)
 {
-	peg::on_first_child<peg::directives>(field, [this](const peg::ast_node& child) {
-		visitDirectives(introspection::DirectiveLocation::FIELD, child);
-	});
-
-	std::string_view name;
+	if (const auto directives = peg::first_child<peg::directives>(field))
+	{
+		visitDirectives(introspection::DirectiveLocation::FIELD, *directives);
+	}
 
-	peg::on_first_child<peg::field_name>(field, [&name](const peg::ast_node& child) {
-		name = child.string_view();
-	});
+	const auto name = peg::first_child_view<peg::field_name>(field);
 
 	auto itrType = getScopedTypeFields();
 
@@ -1623,11 +1913,7 @@ void ValidateExecutableVisitor::visitField(const peg::ast_node& field)
 		return;
 	}
 
-	std::string_view alias;
-
-	peg::on_first_child<peg::alias_name>(field, [&alias](const peg::ast_node& child) {
-		alias = child.string_view();
-	});
+	auto alias = peg::first_child_view<peg::alias_name>(field);
 
 	if (alias.empty())
 	{
@@ -1667,6 +1953,8 @@ void ValidateExecutableVisitor::visitField(const peg::ast_node& field)
 			}
 		});
 
+	const auto fieldWeight = getFieldWeight(name);
+	const auto fieldMultiplier = getFieldMultiplier(wrappedType, validateArguments);
 	ValidateType objectType =
 		(_scopedType->get().kind() == introspection::TypeKind::OBJECT ? _scopedType
 																	  : ValidateType {});
@@ -1764,13 +2052,10 @@ void ValidateExecutableVisitor::visitField(const peg::ast_node& field)
 
 	_selectionFields.emplace(alias, std::move(validateField));
 
-	const peg::ast_node* selection = nullptr;
-
-	peg::on_first_child<peg::selection_set>(field, [&selection](const peg::ast_node& child) {
-		selection = &child;
-	});
+	const auto selection = peg::first_child<peg::selection_set>(field);
 
 	size_t subFieldCount = 0;
+	size_t subFieldCost = 0;
 
 	if (selection != nullptr)
 	{
@@ -1778,9 +2063,11 @@ void ValidateExecutableVisitor::visitField(const peg::ast_node& field)
 		auto outerFields = std::move(_selectionFields);
 		auto outerFieldCount = _fieldCount;
 		auto outerIntrospectionFieldCount = _introspectionFieldCount;
+		auto outerSelectionCost = _selectionCost;
 
 		_fieldCount = 0;
 		_introspectionFieldCount = 0;
+		_selectionCost = 0;
 		_selectionFields.clear();
 		_scopedType = std::move(innerType);
 
@@ -1790,11 +2077,13 @@ void ValidateExecutableVisitor::visitField(const peg::ast_node& field)
 		_scopedType = std::move(outerType);
 		_selectionFields = std::move(outerFields);
 		subFieldCount = _fieldCount;
+		subFieldCost = _selectionCost;
 		_introspectionFieldCount = outerIntrospectionFieldCount;
 		_fieldCount = outerFieldCount;
+		_selectionCost = outerSelectionCost;
 	}
 
-	if (subFieldCount == 0 && !isScalarType(innerType->get().kind()))
+	if (subFieldCount == 0 && !ValidateSchema::isScalarType(innerType->get().kind()))
 	{
 		// https://spec.graphql.org/October2021/#sec-Leaf-Field-Selections
 		auto position = field.begin();
@@ -1807,6 +2096,8 @@ void ValidateExecutableVisitor::visitField(const peg::ast_node& field)
 	}
 
 	++_fieldCount;
+	_selectionCost = saturatingAdd(_selectionCost,
+		saturatingAdd(fieldWeight, saturatingMultiply(fieldMultiplier, subFieldCost)));
 
 	constexpr auto c_introspectionFieldPrefix = R"gql(__)gql"sv;
 
@@ -1817,11 +2108,70 @@ void ValidateExecutableVisitor::visitField(const peg::ast_node& field)
 	}
 }
 
+size_t ValidateExecutableVisitor::getFieldWeight(std::string_view name) const
+{
+	if (_costOptions.fieldWeights.empty())
+	{
+		return 1;
+	}
+
+	std::string key { _scopedType->get().name() };
+
+	key.reserve(key.size() + 1 + name.size());
+	key.push_back('.');
+	key.append(name);
+
+	const auto itr = _costOptions.fieldWeights.find(key);
+
+	return itr == _costOptions.fieldWeights.end() ? 1 : itr->second;
+}
+
+size_t ValidateExecutableVisitor::getFieldMultiplier(
+	const ValidateType& wrappedType, const ValidateFieldArguments& arguments) const
+{
+	// Connection fields take a first or last argument to limit the number of results.
+	for (const auto argumentName : { R"gql(first)gql"sv, R"gql(last)gql"sv })
+	{
+		const auto itrArgument = arguments.find(argumentName);
+
+		if (itrArgument == arguments.end() || !itrArgument->second.value)
+		{
+			continue;
+		}
+
+		const auto& data = itrArgument->second.value->data;
+
+		if (std::holds_alternative<int>(data))
+		{
+			return static_cast<size_t>(std::max(0, std::get<int>(data)));
+		}
+
+		// The page size is not known until the operation is executed, so assume the worst case.
+		if (std::holds_alternative<ValidateArgumentVariable>(data))
+		{
+			return _costOptions.maxPageSize.value_or(_costOptions.defaultListSize);
+		}
+	}
+
+	// Otherwise, check for a list type in the wrappers around the field type.
+	for (auto fieldType = wrappedType; fieldType && fieldType->get().name().empty();
+		 fieldType = getValidateType(fieldType->get().ofType().lock()))
+	{
+		if (fieldType->get().kind() == introspection::TypeKind::LIST)
+		{
+			return _costOptions.defaultListSize;
+		}
+	}
+
+	return 1;
+}
+
 void ValidateExecutableVisitor::visitFragmentSpread(const peg::ast_node& fragmentSpread)
 {
-	peg::on_first_child<peg::directives>(fragmentSpread, [this](const peg::ast_node& child) {
-		visitDirectives(introspection::DirectiveLocation::FRAGMENT_SPREAD, child);
-	});
+	if (const auto directives = peg::first_child<peg::directives>(fragmentSpread))
+	{
+		visitDirectives(introspection::DirectiveLocation::FRAGMENT_SPREAD, *directives);
+	}
 
 	const auto name = fragmentSpread.children.front()->string_view();
 	auto itr = _fragmentDefinitions.find(name);
@@ -1840,7 +2190,7 @@ void ValidateExecutableVisitor::visitFragmentSpread(const peg::ast_node& fragmen
 
 	if (_fragmentStack.find(name) != _fragmentStack.end())
 	{
-		if (_fragmentCycles.emplace(name).second)
+		if (_fragmentCycles.emplace(name, _errors.size()).second)
 		{
 			// https://spec.graphql.org/October2021/#sec-Fragment-spreads-must-not-form-cycles
 			auto position = fragmentSpread.begin();
@@ -1886,20 +2236,21 @@ void ValidateExecutableVisitor::visitFragmentSpread(const peg::ast_node& fragmen
 
 void ValidateExecutableVisitor::visitInlineFragment(const peg::ast_node& inlineFragment)
 {
-	peg::on_first_child<peg::directives>(inlineFragment, [this](const peg::ast_node& child) {
-		visitDirectives(introspection::DirectiveLocation::INLINE_FRAGMENT, child);
-	});
+	if (const auto directives = peg::first_child<peg::directives>(inlineFragment))
+	{
+		visitDirectives(introspection::DirectiveLocation::INLINE_FRAGMENT, *directives);
+	}
 
 	std::string_view innerType;
 	schema_location typeConditionLocation;
 
-	peg::on_first_child<peg::type_condition>(inlineFragment,
-		[&innerType, &typeConditionLocation](const peg::ast_node& child) {
-			auto position = child.begin();
+	if (const auto typeCondition = peg::first_child<peg::type_condition>(inlineFragment))
+	{
+		auto position = typeCondition->begin();
 
-			innerType = child.children.front()->string_view();
-			typeConditionLocation = { position.line, position.column };
-		});
+		innerType = typeCondition->children.front()->string_view();
+		typeConditionLocation = { position.line, position.column };
+	}
 
 	ValidateType fragmentType;
 
@@ -1924,13 +2275,14 @@ void ValidateExecutableVisitor::visitInlineFragment(const peg::ast_node& inlineF
 
 		fragmentType = itrInner->second;
 
-		if (isScalarType(fragmentType->get().kind()) || !matchesScopedType(innerType))
+		if (ValidateSchema::isScalarType(fragmentType->get().kind())
+			|| !matchesScopedType(innerType))
 		{
 			// https://spec.graphql.org/October2021/#sec-Fragments-On-Composite-Types
 			// https://spec.graphql.org/October2021/#sec-Fragment-spread-is-possible
 			std::ostringstream message;
 
-			message << (isScalarType(fragmentType->get().kind())
+			message << (ValidateSchema::isScalarType(fragmentType->get().kind())
 					? "Scalar target type on inline fragment name: "
 					: "Incompatible target type on inline fragment name: ")
 					<< innerType;
@@ -1940,16 +2292,16 @@ void ValidateExecutableVisitor::visitInlineFragment(const peg::ast_node& inlineF
 		}
 	}
 
-	peg::on_first_child<peg::selection_set>(inlineFragment,
-		[this, &fragmentType](const peg::ast_node& selection) {
-			auto outerType = std::move(_scopedType);
+	if (const auto selection = peg::first_child<peg::selection_set>(inlineFragment))
+	{
+		auto outerType = std::move(_scopedType);
 
-			_scopedType = std::move(fragmentType);
+		_scopedType = std::move(fragmentType);
 
-			visitSelection(selection);
+		visitSelection(*selection);
 
-			_scopedType = std::move(outerType);
-		});
+		_scopedType = std::move(outerType);
+	}
 }
 
 void ValidateExecutableVisitor::visitDirectives(
@@ -1959,12 +2311,7 @@ void ValidateExecutableVisitor::visitDirectives(
 
 	for (const auto& directive : directives.children)
 	{
-		std::string_view directiveName;
-
-		peg::on_first_child<peg::directive_name>(*directive,
-			[&directiveName](const peg::ast_node& child) {
-				directiveName = child.string_view();
-			});
+		const auto directiveName = peg::first_child_view<peg::directive_name>(*directive);
 
 		const auto itrDirective = _directives.find(directiveName);
 
@@ -21,10 +21,16 @@ namespace service {
 
 static const auto s_namesTypeKind = introspection::getTypeKindNames();
 static const auto s_valuesTypeKind = introspection::getTypeKindValues();
+static const auto s_enumNamesTypeKind = makeEnumNames(s_namesTypeKind);
 
 template <>
 introspection::TypeKind Argument<introspection::TypeKind>::convert(const response::Value& value)
 {
+	if (const auto index = findEnumName(s_enumNamesTypeKind, value))
+	{
+		return static_cast<introspection::TypeKind>(*index);
+	}
+
 	if (!value.maybe_enum())
 	{
 		throw service::schema_exception { { R"ex(not a valid __TypeKind value)ex" } };
@@ -48,17 +54,18 @@ service::AwaitableResolver Result<introspection::TypeKind>::convert(service::Awa
 	return ModifiedResult<introspection::TypeKind>::resolve(std::move(result), std::move(params),
 		[](introspection::TypeKind value, const ResolverParams&)
 		{
-			response::Value result(response::Type::EnumValue);
-
-			result.set<std::string>(std::string { s_namesTypeKind[static_cast<size_t>(value)] });
-
-			return result;
+			return response::Value { response::EnumName { s_enumNamesTypeKind[static_cast<size_t>(value)] } };
 		});
 }
 
 template <>
 void Result<introspection::TypeKind>::validateScalar(const response::Value& value)
 {
+	if (findEnumName(s_enumNamesTypeKind, value))
+	{
+		return;
+	}
+
 	if (!value.maybe_enum())
 	{
 		throw service::schema_exception { { R"ex(not a valid __TypeKind value)ex" } };
@@ -77,10 +84,16 @@ void Result<introspection::TypeKind>::validateScalar(const response::Value& valu
 
 static const auto s_namesDirectiveLocation = introspection::getDirectiveLocationNames();
 static const auto s_valuesDirectiveLocation = introspection::getDirectiveLocationValues();
+static const auto s_enumNamesDirectiveLocation = makeEnumNames(s_namesDirectiveLocation);
 
 template <>
 introspection::DirectiveLocation Argument<introspection::DirectiveLocation>::convert(const response::Value& value)
 {
+	if (const auto index = findEnumName(s_enumNamesDirectiveLocation, value))
+	{
+		return static_cast<introspection::DirectiveLocation>(*index);
+	}
+
 	if (!value.maybe_enum())
 	{
 		throw service::schema_exception { { R"ex(not a valid __DirectiveLocation value)ex" } };
@@ -104,17 +117,18 @@ service::AwaitableResolver Result<introspection::DirectiveLocation>::convert(ser
 	return ModifiedResult<introspection::DirectiveLocation>::resolve(std::move(result), std::move(params),
 		[](introspection::DirectiveLocation value, const ResolverParams&)
 		{
-			response::Value result(response::Type::EnumValue);
-
-			result.set<std::string>(std::string { s_namesDirectiveLocation[static_cast<size_t>(value)] });
-
-			return result;
+			return response::Value { response::EnumName { s_enumNamesDirectiveLocation[static_cast<size_t>(value)] } };
 		});
 }
 
 template <>
 void Result<introspection::DirectiveLocation>::validateScalar(const response::Value& value)
 {
+	if (findEnumName(s_enumNamesDirectiveLocation, value))
+	{
+		return;
+	}
+
 	if (!value.maybe_enum())
 	{
 		throw service::schema_exception { { R"ex(not a valid __DirectiveLocation value)ex" } };
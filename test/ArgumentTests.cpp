@@ -223,6 +223,36 @@ TEST(ArgumentsCase, TaskStateEnumConstexpr)
 	EXPECT_TRUE(today::TaskState::Started == *actual) << "should parse the enum";
 }
 
+TEST(ArgumentsCase, TaskStateEnumBorrowedName)
+{
+	static const auto names = service::makeEnumNames(today::getTaskStateNames());
+	static const std::string started { "Started" };
+	const response::Value borrowed {
+		response::EnumName { names[static_cast<size_t>(today::TaskState::Started)] }
+	};
+	const response::Value other { response::EnumName { started } };
+	const auto index = service::findEnumName(names, borrowed);
+
+	ASSERT_TRUE(index) << "should find the borrowed name";
+	EXPECT_EQ(static_cast<size_t>(today::TaskState::Started), *index) << "should match the index";
+	EXPECT_FALSE(service::findEnumName(names, other)) << "should only find names from the table";
+
+	response::Value response(response::Type::Map);
+	response.emplace_back("status", response::Value { other });
+	today::TaskState actual = static_cast<today::TaskState>(-1);
+
+	try
+	{
+		actual = service::ModifiedArgument<today::TaskState>::require("status", response);
+	}
+	catch (service::schema_exception& ex)
+	{
+		FAIL() << response::toJSON(ex.getErrors());
+	}
+
+	EXPECT_EQ(today::TaskState::Started, actual) << "should fall back to looking up the name";
+}
+
 TEST(ArgumentsCase, ScalarArgumentMap)
 {
 	response::Value response(response::Type::Map);
@@ -477,3 +507,48 @@ TEST(ArgumentsCase, ArgumentTraitsUniquePtr)
 	ASSERT_TRUE(fakeStruct) << "NullableType<FakeInput> is std::unique_ptr<FakeInput>";
 	ASSERT_TRUE(fakeEnum) << "NullableType<FakeEnum> is std::optional<FakeEnum>";
 }
+
+TEST(ArgumentsCase, RequireMemberListArgumentStrings)
+{
+	auto parsed = response::parseJSON(R"js({"value":[
+		"string1",
+		null,
+		"string3"
+	]})js");
+	std::vector<std::optional<std::string>> actual;
+
+	try
+	{
+		actual = service::StringArgument::requireMember<service::TypeModifier::List,
+			service::TypeModifier::Nullable>("value", &parsed["value"]);
+	}
+	catch (service::schema_exception& ex)
+	{
+		FAIL() << response::toJSON(ex.getErrors());
+	}
+
+	ASSERT_EQ(size_t { 3 }, actual.size()) << "should get 3 entries";
+	EXPECT_EQ("string1", actual[0]) << "entry should match";
+	EXPECT_FALSE(actual[1].has_value()) << "entry should be null";
+	EXPECT_EQ("string3", actual[2]) << "entry should match";
+}
+
+TEST(ArgumentsCase, RequireMemberMissing)
+{
+	auto nullable =
+		service::StringArgument::requireMember<service::TypeModifier::Nullable>("value", nullptr);
+	auto found = service::StringArgument::findMember("value", nullptr);
+
+	EXPECT_FALSE(nullable.has_value()) << "missing nullable member should be null";
+	EXPECT_FALSE(found.second) << "missing required member should not be found";
+
+	try
+	{
+		auto actual = service::StringArgument::requireMember("value", nullptr);
+		FAIL() << "missing required member should throw: " << actual;
+	}
+	catch (std::runtime_error& ex)
+	{
+		EXPECT_EQ("Missing Map member", std::string { ex.what() }) << "exception should match";
+	}
+}
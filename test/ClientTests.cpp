@@ -8,6 +8,8 @@
 #include "SubscribeClient.h"
 #include "TodayMock.h"
 
+#include "graphqlservice/JSONResponse.h"
+
 #include <chrono>
 
 using namespace graphql;
@@ -31,6 +33,76 @@ protected:
 	std::unique_ptr<today::TodayMockService> _mockService;
 };
 
+// Replay a response::Value as the SAX-style events a parser like response::parseJSON would send.
+class VisitorWriter
+{
+public:
+	explicit VisitorWriter(response::ValueVisitor& visitor)
+		: _visitor { visitor }
+	{
+	}
+
+	void start_object()
+	{
+		_visitor.start_object();
+	}
+
+	void add_member(const std::string& key)
+	{
+		_visitor.add_member(key);
+	}
+
+	void end_object()
+	{
+		_visitor.end_object();
+	}
+
+	void start_array()
+	{
+		_visitor.start_array();
+	}
+
+	void end_arrary()
+	{
+		_visitor.end_array();
+	}
+
+	void write_null()
+	{
+		_visitor.add_null();
+	}
+
+	void write_string(const std::string& value)
+	{
+		_visitor.add_string(std::string { value });
+	}
+
+	void write_bool(bool value)
+	{
+		_visitor.add_bool(value);
+	}
+
+	void write_int(int value)
+	{
+		_visitor.add_int(value);
+	}
+
+	void write_float(double value)
+	{
+		_visitor.add_float(value);
+	}
+
+private:
+	response::ValueVisitor& _visitor;
+};
+
+void visitResponse(response::Value&& result, response::ValueVisitor& visitor)
+{
+	response::Writer writer { std::make_unique<VisitorWriter>(visitor) };
+
+	writer.write(std::move(result));
+}
+
 TEST_F(ClientCase, QueryEverything)
 {
 	using namespace client::query::Query;
@@ -127,6 +199,199 @@ TEST_F(ClientCase, QueryEverything)
 	}
 }
 
+TEST_F(ClientCase, QueryEverythingResponseVisitor)
+{
+	using namespace client::query::Query;
+
+	auto query = GetRequestObject();
+
+	response::Value variables(response::Type::Map);
+	auto state = std::make_shared<today::RequestState>(2);
+	auto result = _mockService->service
+					  ->resolve({ query, {}, std::move(variables), std::launch::async, state })
+					  .get();
+
+	try
+	{
+		ASSERT_TRUE(result.type() == response::Type::Map);
+		Response response;
+		client::ResponseVisitor visitor { makeResponseSink(response) };
+
+		visitResponse(std::move(result), visitor);
+
+		EXPECT_EQ(size_t { 0 }, visitor.errors().size()) << "no errors expected";
+
+		ASSERT_TRUE(response.appointments.edges.has_value()) << "appointments should be set";
+		ASSERT_EQ(size_t { 1 }, response.appointments.edges->size())
+			<< "appointments should have 1 entry";
+		ASSERT_TRUE((*response.appointments.edges)[0].has_value()) << "edge should be set";
+		const auto& appointmentNode = (*response.appointments.edges)[0]->node;
+		ASSERT_TRUE(appointmentNode.has_value()) << "node should be set";
+		EXPECT_EQ(today::getFakeAppointmentId(), appointmentNode->id)
+			<< "id should match in base64 encoding";
+		ASSERT_TRUE(appointmentNode->subject.has_value()) << "subject should be set";
+		EXPECT_EQ("Lunch?", *(appointmentNode->subject)) << "subject should match";
+		ASSERT_TRUE(appointmentNode->when.has_value()) << "when should be set";
+		EXPECT_EQ("tomorrow", appointmentNode->when->get<std::string>()) << "when should match";
+		EXPECT_FALSE(appointmentNode->isNow) << "isNow should match";
+		EXPECT_EQ("Appointment", appointmentNode->_typename) << "__typename should match";
+
+		ASSERT_TRUE(response.unreadCounts.edges.has_value()) << "unreadCounts should be set";
+		ASSERT_EQ(size_t { 1 }, response.unreadCounts.edges->size())
+			<< "unreadCounts should have 1 entry";
+		ASSERT_TRUE((*response.unreadCounts.edges)[0].has_value()) << "edge should be set";
+		const auto& unreadCountNode = (*response.unreadCounts.edges)[0]->node;
+		ASSERT_TRUE(unreadCountNode.has_value()) << "node should be set";
+		EXPECT_EQ(today::getFakeFolderId(), unreadCountNode->id)
+			<< "id should match in base64 encoding";
+		EXPECT_EQ(3, unreadCountNode->unreadCount) << "unreadCount should match";
+
+		EXPECT_EQ(client::query::Query::TaskState::Unassigned, response.testTaskState)
+			<< "testTaskState should match";
+
+		ASSERT_EQ(size_t { 1 }, response.anyType.size()) << "anyType should have 1 entry";
+		ASSERT_TRUE(response.anyType[0].has_value()) << "appointment should be set";
+		const auto& anyType = *response.anyType[0];
+		EXPECT_EQ("Appointment", anyType._typename) << "__typename should match";
+		EXPECT_EQ(today::getFakeAppointmentId(), anyType.id)
+			<< "id should match in base64 encoding";
+		EXPECT_FALSE(anyType.title.has_value()) << "appointment should not have a title";
+		ASSERT_TRUE(anyType.subject.has_value()) << "subject should be set";
+		EXPECT_EQ("Lunch?", *(anyType.subject)) << "subject should match";
+	}
+	catch (const std::logic_error& ex)
+	{
+		FAIL() << ex.what();
+	}
+}
+
+TEST_F(ClientCase, QueryEverythingParseJSON)
+{
+	using namespace client::query::Query;
+
+	auto query = GetRequestObject();
+
+	response::Value variables(response::Type::Map);
+	auto state = std::make_shared<today::RequestState>(3);
+	auto result = _mockService->service
+					  ->resolve({ query, {}, std::move(variables), std::launch::async, state })
+					  .get();
+
+	try
+	{
+		ASSERT_TRUE(result.type() == response::Type::Map);
+		const auto json = response::toJSON(std::move(result));
+		Response response;
+		client::ResponseVisitor visitor { makeResponseSink(response) };
+
+		response::parseJSON(json, visitor);
+
+		EXPECT_EQ(size_t { 0 }, visitor.errors().size()) << "no errors expected";
+
+		ASSERT_TRUE(response.appointments.edges.has_value()) << "appointments should be set";
+		ASSERT_EQ(size_t { 1 }, response.appointments.edges->size())
+			<< "appointments should have 1 entry";
+		ASSERT_TRUE((*response.appointments.edges)[0].has_value()) << "edge should be set";
+		const auto& appointmentNode = (*response.appointments.edges)[0]->node;
+		ASSERT_TRUE(appointmentNode.has_value()) << "node should be set";
+		EXPECT_EQ(today::getFakeAppointmentId(), appointmentNode->id)
+			<< "id should match in base64 encoding";
+		ASSERT_TRUE(appointmentNode->subject.has_value()) << "subject should be set";
+		EXPECT_EQ("Lunch?", *(appointmentNode->subject)) << "subject should match";
+		ASSERT_TRUE(appointmentNode->when.has_value()) << "when should be set";
+		EXPECT_EQ("tomorrow", appointmentNode->when->get<std::string>()) << "when should match";
+		EXPECT_FALSE(appointmentNode->isNow) << "isNow should match";
+		EXPECT_EQ("Appointment", appointmentNode->_typename) << "__typename should match";
+
+		ASSERT_TRUE(response.unreadCounts.edges.has_value()) << "unreadCounts should be set";
+		ASSERT_EQ(size_t { 1 }, response.unreadCounts.edges->size())
+			<< "unreadCounts should have 1 entry";
+		ASSERT_TRUE((*response.unreadCounts.edges)[0].has_value()) << "edge should be set";
+		const auto& unreadCountNode = (*response.unreadCounts.edges)[0]->node;
+		ASSERT_TRUE(unreadCountNode.has_value()) << "node should be set";
+		EXPECT_EQ(today::getFakeFolderId(), unreadCountNode->id)
+			<< "id should match in base64 encoding";
+		EXPECT_EQ(3, unreadCountNode->unreadCount) << "unreadCount should match";
+
+		EXPECT_EQ(client::query::Query::TaskState::Unassigned, response.testTaskState)
+			<< "testTaskState should match";
+
+		ASSERT_EQ(size_t { 1 }, response.anyType.size()) << "anyType should have 1 entry";
+		ASSERT_TRUE(response.anyType[0].has_value()) << "appointment should be set";
+		EXPECT_EQ("Appointment", response.anyType[0]->_typename) << "__typename should match";
+	}
+	catch (const std::logic_error& ex)
+	{
+		FAIL() << ex.what();
+	}
+}
+
+TEST(ResponseVisitorCase, ParseInvalidJSON)
+{
+	using namespace client::query::Query;
+
+	Response response;
+	client::ResponseVisitor visitor { makeResponseSink(response) };
+
+	EXPECT_THROW(response::parseJSON(R"js({"data":{"appointments":)js", visitor),
+		std::invalid_argument)
+		<< "truncated JSON should throw";
+}
+
+TEST(ResponseVisitorCase, ParseErrors)
+{
+	using namespace client::query::Query;
+
+	response::Value location { response::Type::Map };
+	location.emplace_back("line", response::Value { 2 });
+	location.emplace_back("column", response::Value { 3 });
+
+	response::Value locations { response::Type::List };
+	locations.emplace_back(std::move(location));
+
+	response::Value path { response::Type::List };
+	path.emplace_back(response::Value { "appointments" });
+	path.emplace_back(response::Value { 0 });
+
+	response::Value error { response::Type::Map };
+	error.emplace_back("message", response::Value { "fake error" });
+	error.emplace_back("locations", std::move(locations));
+	error.emplace_back("path", std::move(path));
+
+	response::Value errors { response::Type::List };
+	errors.emplace_back(std::move(error));
+
+	response::Value result { response::Type::Map };
+	result.emplace_back("data", response::Value {});
+	result.emplace_back("errors", std::move(errors));
+	result.emplace_back("extensions", response::Value { response::Type::Map });
+
+	try
+	{
+		Response response;
+		client::ResponseVisitor visitor { makeResponseSink(response) };
+
+		visitResponse(std::move(result), visitor);
+
+		const auto parsedErrors = visitor.errors();
+
+		EXPECT_FALSE(response.appointments.edges.has_value()) << "appointments should not be set";
+		ASSERT_EQ(size_t { 1 }, parsedErrors.size()) << "one error expected";
+		EXPECT_EQ("fake error", parsedErrors[0].message) << "message should match";
+		ASSERT_EQ(size_t { 1 }, parsedErrors[0].locations.size()) << "one location expected";
+		EXPECT_EQ(2, parsedErrors[0].locations[0].line) << "line should match";
+		EXPECT_EQ(3, parsedErrors[0].locations[0].column) << "column should match";
+		ASSERT_EQ(size_t { 2 }, parsedErrors[0].path.size()) << "two path segments expected";
+		EXPECT_EQ("appointments", std::get<std::string>(parsedErrors[0].path[0]))
+			<< "field should match";
+		EXPECT_EQ(0, std::get<int>(parsedErrors[0].path[1])) << "index should match";
+	}
+	catch (const std::logic_error& ex)
+	{
+		FAIL() << ex.what();
+	}
+}
+
 TEST_F(ClientCase, MutateCompleteTask)
 {
 	using namespace client::mutation::CompleteTaskMutation;
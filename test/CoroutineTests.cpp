@@ -7,6 +7,8 @@
 
 #include "graphqlservice/JSONResponse.h"
 
+#include <thread>
+
 using namespace graphql;
 
 using namespace std::literals;
@@ -408,3 +410,93 @@ TEST_F(CoroutineCase, QueryEverythingThreaded)
 		FAIL() << response::toJSON(ex.getErrors());
 	}
 }
+
+TEST(CoroutineFramePoolCase, ReuseFrames)
+{
+	const auto makeFrame = [](int value) -> internal::Awaitable<int> {
+		co_return value;
+	};
+
+	internal::CoroutineFramePool::resetStats();
+
+	EXPECT_EQ(1, makeFrame(1).get()) << "first coroutine should return its value";
+	EXPECT_EQ(2, makeFrame(2).get()) << "second coroutine should return its value";
+
+	const auto stats = internal::CoroutineFramePool::getStats();
+
+	EXPECT_EQ(size_t { 2 }, stats.allocations) << "each coroutine should allocate a frame";
+	EXPECT_LE(size_t { 1 }, stats.reused) << "the second frame should be reused";
+	EXPECT_EQ(size_t { 0 }, stats.oversized) << "the frames should fit in a bucket";
+	EXPECT_LT(size_t { 0 }, stats.largestFrame) << "the frame size should be recorded";
+}
+
+TEST(CoroutineFramePoolCase, CompareGlobalAllocator)
+{
+	constexpr size_t frameCount = 100;
+	const auto makeFrame = [](int value) -> internal::Awaitable<int> {
+		co_return value;
+	};
+	const auto heapAllocations = [&makeFrame]() {
+		internal::CoroutineFramePool::resetStats();
+
+		for (size_t i = 0; i < frameCount; ++i)
+		{
+			static_cast<void>(makeFrame(static_cast<int>(i)).get());
+		}
+
+		const auto stats = internal::CoroutineFramePool::getStats();
+
+		return stats.allocations - stats.reused;
+	};
+	const auto maxFreeBytes = internal::CoroutineFramePool::getMaxFreeBytes();
+
+	internal::CoroutineFramePool::setMaxFreeBytes(0);
+
+	const auto withoutPool = heapAllocations();
+
+	internal::CoroutineFramePool::setMaxFreeBytes(maxFreeBytes);
+
+	const auto withPool = heapAllocations();
+
+	EXPECT_EQ(frameCount, withoutPool) << "every frame should use the global allocator";
+	EXPECT_GE(size_t { 1 }, withPool) << "only the first frame should use the global allocator";
+}
+
+TEST(CoroutineFramePoolCase, AllocateAfterDestroyed)
+{
+	struct LateCoroutine
+	{
+		~LateCoroutine()
+		{
+			const auto makeFrame = []() -> internal::Awaitable<int> {
+				co_return 4;
+			};
+
+			// This thread_local is destroyed after the pool, which was constructed after it.
+			value = makeFrame().get();
+		}
+
+		int& value;
+	};
+
+	int value = 0;
+
+	std::thread { [&value]() {
+		thread_local LateCoroutine late { value };
+
+		static_cast<void>(internal::CoroutineFramePool::getStats());
+	} }.join();
+
+	EXPECT_EQ(4, value) << "coroutine should run after the pool is destroyed";
+}
+
+TEST(CoroutineFramePoolCase, ReadyAwaitable)
+{
+	internal::CoroutineFramePool::resetStats();
+
+	internal::Awaitable<int> ready { 3 };
+
+	EXPECT_EQ(3, ready.get()) << "ready awaitable should return its value";
+	EXPECT_EQ(size_t { 0 }, internal::CoroutineFramePool::getStats().allocations)
+		<< "ready awaitable should not allocate a coroutine frame";
+}
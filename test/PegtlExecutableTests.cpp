@@ -9,6 +9,9 @@
 
 #include <tao/pegtl/contrib/analyze.hpp>
 
+#include <string>
+#include <vector>
+
 using namespace graphql;
 using namespace graphql::peg;
 
@@ -229,4 +232,108 @@ TEST(PegtlExecutableCase, ParserDepthLimitExceeded)
 
 	EXPECT_TRUE(caughtException) << "should catch a parse exception";
 	EXPECT_FALSE(parsedQuery) << "should not successfully parse the query";
-}
\ No newline at end of file
+}
+
+TEST(PegtlExecutableCase, FirstChildAccessors)
+{
+	auto query = peg::parseString(R"gql(query {
+		alias: foo(arg: 1) @skip(if: false) {
+			bar
+		}
+	})gql"sv);
+
+	ASSERT_TRUE(query.root != nullptr) << "should parse the query";
+
+	const auto operationDefinition = peg::first_child<peg::operation_definition>(*query.root);
+
+	ASSERT_TRUE(operationDefinition != nullptr) << "should find the operation definition";
+	EXPECT_TRUE(peg::first_child<peg::fragment_definition>(*query.root) == nullptr)
+		<< "should not find a fragment definition";
+	EXPECT_TRUE(peg::first_child_view<peg::operation_name>(*operationDefinition).empty())
+		<< "should not have an operation name";
+
+	const auto selectionSet = peg::first_child<peg::selection_set>(*operationDefinition);
+
+	ASSERT_TRUE(selectionSet != nullptr) << "should find the selection set";
+	ASSERT_EQ(size_t { 1 }, selectionSet->children.size()) << "should have a single field";
+
+	const auto& field = *selectionSet->children.front();
+
+	ASSERT_TRUE(field.is_type<peg::field>()) << "should be a field";
+	EXPECT_FALSE(field.is_type<peg::fragment_spread>()) << "should not match another rule";
+	EXPECT_EQ(peg::ast_node::rule_id<peg::field>(), field.rule_id())
+		<< "should tag the node with the rule ID";
+	EXPECT_TRUE(peg::first_child_view<peg::alias_name>(field) == "alias"sv);
+	EXPECT_TRUE(peg::first_child_view<peg::field_name>(field) == "foo"sv);
+	EXPECT_TRUE(peg::first_child<peg::arguments>(field) != nullptr);
+	EXPECT_TRUE(peg::first_child<peg::directives>(field) != nullptr);
+	EXPECT_TRUE(peg::first_child<peg::selection_set>(field) != nullptr);
+
+	size_t directiveCount = 0;
+
+	peg::for_each_child<peg::directives>(field, [&directiveCount](const peg::ast_node&) {
+		++directiveCount;
+	});
+
+	EXPECT_EQ(size_t { 1 }, directiveCount) << "should visit the directives";
+}
+
+TEST(PegtlExecutableCase, ParseStringDefinitions)
+{
+	std::vector<std::string> definitions;
+
+	peg::parseStringDefinitions(R"gql(
+		# leading comment
+		query First { foo { ...Bar } }
+
+		fragment Bar on Foo { bar }
+
+		mutation Second { baz }
+		)gql"sv,
+		[&definitions](peg::ast&& definition) {
+			ASSERT_TRUE(definition.root != nullptr) << "should yield a root node";
+			ASSERT_EQ(size_t { 1 }, definition.root->children.size())
+				<< "should yield a single definition";
+
+			const auto& child = *definition.root->children.front();
+
+			if (child.is_type<peg::operation_definition>())
+			{
+				definitions.emplace_back(peg::first_child_view<peg::operation_name>(child));
+			}
+			else
+			{
+				ASSERT_TRUE(child.is_type<peg::fragment_definition>())
+					<< "should be an operation or fragment definition";
+				definitions.emplace_back(child.children.front()->string_view());
+			}
+		});
+
+	ASSERT_EQ(size_t { 3 }, definitions.size()) << "should yield each definition";
+	EXPECT_EQ("First", definitions[0]);
+	EXPECT_EQ("Bar", definitions[1]);
+	EXPECT_EQ("Second", definitions[2]);
+}
+
+TEST(PegtlExecutableCase, ParseStringDefinitionsError)
+{
+	size_t count = 0;
+	bool caughtException = false;
+
+	try
+	{
+		peg::parseStringDefinitions(R"gql(query First { foo }
+			query Second { bar )gql"sv,
+			[&count](peg::ast&&) {
+				++count;
+			});
+	}
+	catch (const peg::parse_error& ex)
+	{
+		ASSERT_NE(nullptr, ex.what());
+		caughtException = true;
+	}
+
+	EXPECT_TRUE(caughtException) << "should catch a parse exception";
+	EXPECT_EQ(size_t { 1 }, count) << "should yield the definitions before the error";
+}
@@ -3,7 +3,21 @@
 
 #include <gtest/gtest.h>
 
+#include "graphqlservice/BinaryResponse.h"
 #include "graphqlservice/GraphQLResponse.h"
+#include "graphqlservice/JSONResponse.h"
+
+#include "graphqlservice/internal/Base64.h"
+
+#include <array>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <thread>
+#endif // !_WIN32
 
 using namespace graphql;
 
@@ -33,3 +47,579 @@ TEST(ResponseCase, IdTypeCompareEqual)
 	EXPECT_TRUE(fakeId == response::IdType { "ZmFrZUlk" })
 		<< "actual string should compare as equal";
 }
+
+class RecordingWriter
+{
+public:
+	explicit RecordingWriter(std::string& output)
+		: _output { output }
+	{
+	}
+
+	void start_object() const
+	{
+		_output.append("{");
+	}
+
+	void add_member(const std::string& key) const
+	{
+		_output.append(key).append(":");
+	}
+
+	void end_object() const
+	{
+		_output.append("}");
+	}
+
+	void start_array() const
+	{
+		_output.append("[");
+	}
+
+	void end_arrary() const
+	{
+		_output.append("]");
+	}
+
+	void write_null() const
+	{
+		_output.append("null,");
+	}
+
+	void write_string(const std::string& value) const
+	{
+		_output.append("\"").append(value).append("\",");
+	}
+
+	void write_bool(bool value) const
+	{
+		_output.append(value ? "true," : "false,");
+	}
+
+	void write_int(int value) const
+	{
+		_output.append(std::to_string(value)).append(",");
+	}
+
+	void write_float(double value) const
+	{
+		_output.append(std::to_string(value)).append(",");
+	}
+
+private:
+	std::string& _output;
+};
+
+// Count the deep copies of a Type::Custom value, which Value makes by calling clone.
+struct CopyCounter final : response::CustomTypeBase
+{
+	explicit CopyCounter(size_t& copies)
+		: copies { copies }
+	{
+	}
+
+	void write(const response::Writer& writer) const final
+	{
+		writer.write_int(static_cast<int>(copies));
+	}
+
+	std::unique_ptr<response::CustomTypeBase> clone() const final
+	{
+		++copies;
+		return std::make_unique<CopyCounter>(copies);
+	}
+
+	bool equals(const response::CustomTypeBase& rhs) const noexcept final
+	{
+		return dynamic_cast<const CopyCounter*>(&rhs) != nullptr;
+	}
+
+	size_t hash() const noexcept final
+	{
+		return 0;
+	}
+
+	size_t& copies;
+};
+
+TEST(ResponseCase, WriteSharedValue)
+{
+	size_t copies = 0;
+	response::Value map { response::Type::Map };
+	response::Value list { response::Type::List };
+
+	list.emplace_back(response::Value { 1 });
+	list.emplace_back(response::Value { true });
+	list.emplace_back(response::Value {});
+	map.emplace_back("bytes", response::Value { response::IdType { 0x66, 0x61, 0x6B, 0x65 } });
+	map.emplace_back("opaque", response::Value { response::IdType { "opaque" } });
+	map.emplace_back("string", response::Value { "value" });
+	map.emplace_back("list", std::move(list));
+	map.emplace_back("copies", response::Value { std::make_unique<CopyCounter>(copies) });
+
+	const auto shared = std::make_shared<const response::Value>(std::move(map));
+	const response::Value expected { *shared };
+	std::string sharedOutput;
+	std::string copiedOutput;
+
+	ASSERT_EQ(size_t { 1 }, copies) << "copying the value should clone the custom member";
+
+	response::Writer { std::make_unique<RecordingWriter>(sharedOutput) }.write(
+		response::Value { shared });
+
+	EXPECT_EQ(size_t { 1 }, copies) << "writing the shared value should not copy it";
+	EXPECT_EQ(1, shared.use_count()) << "writing should not keep a reference to the shared value";
+
+	response::Writer { std::make_unique<RecordingWriter>(copiedOutput) }.write(
+		response::Value { *shared });
+
+	EXPECT_EQ(size_t { 2 }, copies) << "writing a copy should clone the custom member";
+	EXPECT_EQ(R"({bytes:"ZmFrZQ==",opaque:"opaque",string:"value",list:[1,true,null,]copies:1,})",
+		sharedOutput);
+	EXPECT_EQ(
+		R"({bytes:"ZmFrZQ==",opaque:"opaque",string:"value",list:[1,true,null,]copies:2,})",
+		copiedOutput);
+	EXPECT_TRUE(expected == *shared) << "serializing should not modify the shared value";
+}
+
+TEST(ResponseCase, BorrowedEnumName)
+{
+	static const std::array<std::string, 2> names { "FIRST", "SECOND" };
+	response::Value borrowed { response::EnumName { names[1] } };
+	response::Value owned { response::Type::EnumValue };
+
+	owned.set<response::StringType>("SECOND");
+
+	ASSERT_TRUE(borrowed.type() == response::Type::EnumValue);
+	EXPECT_EQ(&names[1], borrowed.borrowed_enum()) << "should borrow the name";
+	EXPECT_EQ(&names[1], &borrowed.get<response::StringType>()) << "should not copy the name";
+	EXPECT_EQ(nullptr, owned.borrowed_enum()) << "should own the name";
+	EXPECT_TRUE(borrowed == owned) << "borrowed and owned names should compare as equal";
+
+	const response::Value copied { borrowed };
+
+	EXPECT_EQ(&names[1], copied.borrowed_enum()) << "copies should borrow the same name";
+
+	std::string output;
+
+	response::Writer { std::make_unique<RecordingWriter>(output) }.write(std::move(borrowed));
+
+	EXPECT_EQ(R"("SECOND",)", output);
+
+	auto released = response::Value { copied }.release<response::StringType>();
+
+	EXPECT_EQ("SECOND", released) << "releasing a borrowed name should copy it";
+	EXPECT_EQ("SECOND", names[1]) << "releasing a borrowed name should not modify the table";
+}
+
+response::Value makeBinaryResponse()
+{
+	response::Value map { response::Type::Map };
+	response::Value list { response::Type::List };
+	response::Value enumValue { response::Type::EnumValue };
+
+	enumValue.set<response::StringType>("ENUM_VALUE");
+	list.emplace_back(response::Value { 23 });
+	list.emplace_back(response::Value { -70000 });
+	list.emplace_back(response::Value { 0.1 });
+	list.emplace_back(response::Value { false });
+	list.emplace_back(response::Value {});
+	list.emplace_back(response::Value { 0.5 });
+	list.emplace_back(response::Value { 1e300 });
+	map.emplace_back("bytes", response::Value { response::IdType { 0x66, 0x61, 0x6B, 0x65 } });
+	map.emplace_back("opaque", response::Value { response::IdType { "opaque" } });
+	map.emplace_back("enum", std::move(enumValue));
+	map.emplace_back("string", response::Value { std::string(300, 'x') });
+	map.emplace_back("list", std::move(list));
+
+	return map;
+}
+
+void expectBinaryResponse(const response::Value& actual)
+{
+	ASSERT_TRUE(actual.type() == response::Type::Map);
+	ASSERT_EQ(size_t { 5 }, actual.size());
+	ASSERT_TRUE(actual["bytes"].type() == response::Type::ID);
+	EXPECT_TRUE(actual["bytes"].get<response::IdType>() == response::IdType { "ZmFrZQ==" });
+	ASSERT_TRUE(actual["opaque"].type() == response::Type::ID);
+	EXPECT_EQ("opaque", actual["opaque"].get<response::IdType>().get<std::string>());
+	ASSERT_TRUE(actual["enum"].type() == response::Type::EnumValue);
+	EXPECT_EQ("ENUM_VALUE", actual["enum"].get<response::StringType>());
+	ASSERT_TRUE(actual["string"].type() == response::Type::String);
+	EXPECT_EQ(std::string(300, 'x'), actual["string"].get<response::StringType>());
+
+	const auto& list = actual["list"];
+
+	ASSERT_TRUE(list.type() == response::Type::List);
+	ASSERT_EQ(size_t { 7 }, list.size());
+	EXPECT_EQ(23, list[0].get<response::IntType>());
+	EXPECT_EQ(-70000, list[1].get<response::IntType>());
+	EXPECT_EQ(0.1, list[2].get<response::FloatType>());
+	EXPECT_FALSE(list[3].get<response::BooleanType>());
+	EXPECT_TRUE(list[4].type() == response::Type::Null);
+	EXPECT_EQ(0.5, list[5].get<response::FloatType>()) << "fits in single precision";
+	EXPECT_EQ(1e300, list[6].get<response::FloatType>()) << "out of range for single precision";
+}
+
+TEST(ResponseCase, CBORRoundTrip)
+{
+	const auto cbor = response::toCBOR(makeBinaryResponse());
+
+	expectBinaryResponse(response::parseCBOR(cbor));
+}
+
+TEST(ResponseCase, MessagePackRoundTrip)
+{
+	const auto msgpack = response::toMessagePack(makeBinaryResponse());
+
+	expectBinaryResponse(response::parseMessagePack(msgpack));
+}
+
+TEST(ResponseCase, ParseIndefiniteLengthCBOR)
+{
+	const response::BinaryData cbor {
+		0x9F, // indefinite length array
+		0x01, // 1
+		0x7F, // indefinite length text string
+		0x61, // "a" chunk
+		0x61,
+		0x61, // "b" chunk
+		0x62,
+		0xFF, // end of the text string
+		0xBF, // indefinite length map
+		0x61, // "k"
+		0x6B,
+		0xF9, // half precision 1.0
+		0x3C,
+		0x00,
+		0xFF, // end of the map
+		0xFF, // end of the array
+	};
+	const auto actual = response::parseCBOR(cbor);
+
+	ASSERT_TRUE(actual.type() == response::Type::List);
+	ASSERT_EQ(size_t { 3 }, actual.size());
+	EXPECT_EQ(1, actual[0].get<response::IntType>());
+	EXPECT_EQ("ab", actual[1].get<response::StringType>());
+	EXPECT_EQ(1.0, actual[2]["k"].get<response::FloatType>());
+
+	const auto taggedKey = response::parseCBOR({
+		0xA1, // map with 1 entry
+		0xD9, // EnumValue tag
+		0xE7,
+		0x00,
+		0x61, // "k"
+		0x6B,
+		0x61, // "v"
+		0x76,
+	});
+
+	ASSERT_TRUE(taggedKey.type() == response::Type::Map);
+	EXPECT_TRUE(taggedKey["k"].type() == response::Type::String)
+		<< "the tag on a key should not apply to its value";
+}
+
+TEST(ResponseCase, ParseInvalidBinary)
+{
+	EXPECT_THROW(static_cast<void>(response::parseCBOR({ 0x82, 0x01 })), std::invalid_argument)
+		<< "truncated array";
+	EXPECT_THROW(static_cast<void>(response::parseCBOR({ 0x1A, 0x80, 0x00, 0x00, 0x00 })),
+		std::overflow_error)
+		<< "GraphQL only supports 32-bit signed integers";
+	EXPECT_THROW(static_cast<void>(response::parseMessagePack({ 0x81, 0x01, 0x01 })),
+		std::invalid_argument)
+		<< "map keys must be strings";
+	EXPECT_THROW(static_cast<void>(response::parseMessagePack({ 0xC0, 0xC0 })),
+		std::invalid_argument)
+		<< "trailing data";
+
+	EXPECT_THROW(static_cast<void>(response::parseCBOR(response::BinaryData(30 * 1024, 0x9F))),
+		std::invalid_argument)
+		<< "too many nested indefinite length arrays";
+
+	const response::BinaryData maxLengthArray {
+		0x9B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFF
+	};
+
+	EXPECT_THROW(static_cast<void>(response::parseCBOR(maxLengthArray)), std::invalid_argument)
+		<< "a definite length array can't end with a break";
+	EXPECT_THROW(static_cast<void>(response::parseCBOR({ 0x9F, 0xD9, 0xE7, 0x00, 0xFF })),
+		std::invalid_argument)
+		<< "a tag can't come before a break";
+
+	response::BinaryData largeArrays;
+
+	for (size_t i = 0; i < 10 * 1024; ++i)
+	{
+		largeArrays.insert(largeArrays.end(), { 0xDC, 0xFF, 0xFF });
+	}
+
+	EXPECT_THROW(static_cast<void>(response::parseMessagePack(largeArrays)), std::invalid_argument)
+		<< "too many nested arrays claiming 65535 entries";
+
+	response::BinaryData nestedArrays(1024 * 1024, 0x91);
+
+	nestedArrays.push_back(0xC0);
+	EXPECT_THROW(static_cast<void>(response::parseMessagePack(nestedArrays)),
+		std::invalid_argument)
+		<< "too many nested arrays";
+}
+
+TEST(ResponseCase, Base64RoundTrip)
+{
+	// Cover lengths which use none, some, or all of the SIMD blocks, and every partial segment.
+	for (size_t length = 0; length < 100; ++length)
+	{
+		std::vector<std::uint8_t> bytes(length);
+
+		for (size_t i = 0; i < length; ++i)
+		{
+			bytes[i] = static_cast<std::uint8_t>(i * 37 + length);
+		}
+
+		const auto encoded = internal::Base64::toBase64(bytes);
+
+		ASSERT_EQ(internal::Base64::encodedLength(length), encoded.size());
+
+		std::string buffer(encoded.size() + 2, '"');
+
+		internal::Base64::toBase64(bytes, buffer.data() + 1);
+		EXPECT_EQ('"' + encoded + '"', buffer) << "length: " << length;
+		EXPECT_TRUE(internal::Base64::validateBase64(encoded)) << "length: " << length;
+		EXPECT_EQ(bytes, internal::Base64::fromBase64(encoded)) << "length: " << length;
+		EXPECT_TRUE(internal::Base64::Comparison::EqualTo
+			== internal::Base64::compareBase64(bytes, encoded))
+			<< "length: " << length;
+
+		if (length == 0)
+		{
+			continue;
+		}
+
+		auto greater = bytes;
+
+		++greater[length / 2];
+		EXPECT_TRUE(internal::Base64::Comparison::GreaterThan
+			== internal::Base64::compareBase64(greater, encoded))
+			<< "length: " << length;
+
+		auto invalid = encoded;
+
+		invalid[(length / 3) * 4 / 2] = '*';
+		EXPECT_FALSE(internal::Base64::validateBase64(invalid)) << "length: " << length;
+		EXPECT_THROW(static_cast<void>(internal::Base64::fromBase64(invalid)), std::logic_error)
+			<< "length: " << length;
+		EXPECT_TRUE(internal::Base64::Comparison::InvalidBase64
+			== internal::Base64::compareBase64(bytes, invalid))
+			<< "length: " << length;
+	}
+}
+
+struct CustomPoint final : response::CustomTypeBase
+{
+	CustomPoint(int x, int y)
+		: x { x }
+		, y { y }
+	{
+	}
+
+	void write(const response::Writer& writer) const final
+	{
+		writer.start_array(2);
+		writer.write_int(x);
+		writer.write_int(y);
+		writer.end_array();
+	}
+
+	std::unique_ptr<response::CustomTypeBase> clone() const final
+	{
+		return std::make_unique<CustomPoint>(x, y);
+	}
+
+	bool equals(const response::CustomTypeBase& rhs) const noexcept final
+	{
+		const auto point = dynamic_cast<const CustomPoint*>(&rhs);
+
+		return point && point->x == x && point->y == y;
+	}
+
+	size_t hash() const noexcept final
+	{
+		return std::hash<int> {}(x) ^ (std::hash<int> {}(y) << 1);
+	}
+
+	const int x;
+	const int y;
+};
+
+TEST(ResponseCase, CustomTypeHooks)
+{
+	response::Value map { response::Type::Map };
+
+	map.emplace_back("point", response::Value { std::make_unique<CustomPoint>(1, 2) });
+
+	const response::Value copied { map };
+	std::string output;
+
+	response::Writer { std::make_unique<RecordingWriter>(output) }.write(std::move(map));
+
+	EXPECT_EQ("{point:[1,2,]}", output);
+	ASSERT_TRUE(copied["point"].type() == response::Type::Custom);
+	EXPECT_TRUE(copied["point"] == response::Value { std::make_unique<CustomPoint>(1, 2) })
+		<< "should compare the custom values";
+	EXPECT_FALSE(copied["point"] == response::Value { std::make_unique<CustomPoint>(2, 1) })
+		<< "should compare the custom values";
+	EXPECT_EQ(CustomPoint(1, 2).hash(), copied["point"].get<response::CustomType>()->hash());
+}
+
+TEST(ResponseCase, WriteByteDataIdJSON)
+{
+	const response::IdType bytes { 0x66, 0x61, 0x6B, 0x65 };
+	response::Value map { response::Type::Map };
+	response::Value list { response::Type::List };
+
+	list.emplace_back(response::Value { response::IdType { bytes } });
+	list.emplace_back(response::Value { 1 });
+	list.emplace_back(response::Value { response::IdType { bytes } });
+	list.emplace_back(response::Value { response::IdType { bytes } });
+	map.emplace_back("first", response::Value { response::IdType { bytes } });
+	map.emplace_back("list", std::move(list));
+	map.emplace_back("last", response::Value { response::IdType { bytes } });
+
+	const auto expected =
+		R"js({"first":"ZmFrZQ==","list":["ZmFrZQ==",1,"ZmFrZQ==","ZmFrZQ=="],"last":"ZmFrZQ=="})js";
+	std::string streamed;
+
+	EXPECT_EQ(expected, response::toJSON(response::Value { map }))
+		<< "IDs should be separated from the keys and other entries";
+
+	response::toJSON(std::move(map), [&streamed](const char* data, size_t size) {
+		streamed.append(data, size);
+	});
+
+	EXPECT_EQ(expected, streamed) << "streamed IDs should be separated the same way";
+}
+
+TEST(ResponseCase, StreamJSONChunks)
+{
+	response::Value map { response::Type::Map };
+	response::Value list { response::Type::List };
+
+	list.emplace_back(response::Value { std::string(response::c_jsonChunkSize * 2, 'x') });
+	list.emplace_back(response::Value { response::IdType(response::c_jsonChunkSize, 0x66) });
+	list.emplace_back(response::Value { 1 });
+	map.emplace_back("list", std::move(list));
+
+	const auto expected = response::toJSON(response::Value { map });
+	std::string actual;
+	size_t chunks = 0;
+
+	response::toJSON(std::move(map), [&actual, &chunks](const char* data, size_t size) {
+		EXPECT_GT(size, size_t { 0 }) << "should not write empty chunks";
+		EXPECT_LE(size, response::c_jsonChunkSize) << "should fit in the buffer";
+		actual.append(data, size);
+		++chunks;
+	});
+
+	EXPECT_EQ(expected, actual) << "streaming should write the same JSON";
+	EXPECT_LT(size_t { 2 }, chunks) << "should write more than one chunk";
+}
+
+#ifndef _WIN32
+// Returns the number of bytes read from the pipe and how much the peak RSS grew while writing.
+std::array<size_t, 2> measureStreamJSONToPipe()
+{
+	constexpr size_t elementSize = 1024 * 1024;
+	constexpr size_t elementCount = 100;
+
+	// Share the same element, so the response is much smaller than the JSON it serializes to.
+	const auto element = std::make_shared<const response::Value>(std::string(elementSize, 'x'));
+	response::Value list { response::Type::List };
+
+	list.reserve(elementCount);
+	for (size_t i = 0; i < elementCount; ++i)
+	{
+		list.emplace_back(response::Value { element });
+	}
+
+	int fds[2] {};
+
+	if (pipe(fds) != 0)
+	{
+		return {};
+	}
+
+	size_t received = 0;
+	std::thread reader { [fd = fds[0], &received]() {
+		std::array<char, 4096> buffer;
+		ssize_t count = 0;
+
+		while ((count = read(fd, buffer.data(), buffer.size())) > 0)
+		{
+			received += static_cast<size_t>(count);
+		}
+
+		close(fd);
+	} };
+
+	rusage before {};
+	rusage after {};
+
+	getrusage(RUSAGE_SELF, &before);
+	response::toJSON(std::move(list), fds[1]);
+	getrusage(RUSAGE_SELF, &after);
+	close(fds[1]);
+	reader.join();
+
+	// ru_maxrss is in kilobytes on Linux and bytes on macOS.
+#ifdef __APPLE__
+	constexpr long maxrssUnit = 1;
+#else // !__APPLE__
+	constexpr long maxrssUnit = 1024;
+#endif // !__APPLE__
+
+	return { received, static_cast<size_t>(after.ru_maxrss - before.ru_maxrss) * maxrssUnit };
+}
+
+TEST(ResponseCase, StreamJSONToPipe)
+{
+	// ru_maxrss is the peak for the whole process, which the other tests might have already
+	// raised past anything this one allocates. A forked child starts with its current RSS as the
+	// peak, so measure it there and send the results back.
+	int results[2] {};
+
+	ASSERT_EQ(0, pipe(results)) << "should create a pipe";
+
+	const auto child = fork();
+
+	ASSERT_NE(-1, child) << "should fork a child process";
+
+	if (child == 0)
+	{
+		close(results[0]);
+
+		const auto measured = measureStreamJSONToPipe();
+		const auto written = write(results[1], measured.data(), sizeof(measured));
+
+		_exit(written == static_cast<ssize_t>(sizeof(measured)) ? 0 : 1);
+	}
+
+	close(results[1]);
+
+	std::array<size_t, 2> measured {};
+	const auto count = read(results[0], measured.data(), sizeof(measured));
+	int status = 0;
+
+	close(results[0]);
+	waitpid(child, &status, 0);
+
+	ASSERT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0) << "child should exit cleanly";
+	ASSERT_EQ(static_cast<ssize_t>(sizeof(measured)), count) << "should read the results";
+
+	const auto [received, peakGrowth] = measured;
+	const auto payloadSize = size_t { 100 } * (1024 * 1024 + 3) + 1;
+
+	EXPECT_EQ(payloadSize, received) << "should stream the whole response";
+	EXPECT_LT(peakGrowth, payloadSize / 10) << "peak RSS should grow much less than the payload";
+}
+#endif // !_WIN32
@@ -7,6 +7,8 @@
 
 #include "graphqlservice/JSONResponse.h"
 
+#include "graphqlservice/internal/Introspection.h"
+
 #include <chrono>
 
 using namespace graphql;
@@ -295,6 +297,36 @@ TEST_F(TodayServiceCase, QueryAppointmentsWithForceError)
 	}
 }
 
+TEST_F(TodayServiceCase, QueryAppointmentsIntOutOfRange)
+{
+	auto query = R"({
+			appointments(first: 2147483648) {
+				edges {
+					node {
+						id
+					}
+				}
+			}
+		})"_graphql;
+	response::Value variables(response::Type::Map);
+	auto state = std::make_shared<today::RequestState>(2);
+	auto result =
+		_mockService->service->resolve({ query, {}, std::move(variables), {}, state }).get();
+
+	ASSERT_TRUE(result.type() == response::Type::Map);
+	auto errorsItr = result.find("errors");
+	if (errorsItr == result.get<response::MapType>().cend())
+	{
+		FAIL() << response::toJSON(response::Value(result)) << "no errors returned";
+	}
+
+	auto errorsString = response::toJSON(response::Value(errorsItr->second));
+	EXPECT_EQ(
+		R"js([{"message":"Int value out of range: 2147483648","locations":[{"line":2,"column":24}]}])js",
+		errorsString)
+		<< "error should match";
+}
+
 TEST_F(TodayServiceCase, QueryAppointmentsWithForceErrorAsync)
 {
 	auto query = R"({
@@ -371,6 +403,65 @@ TEST_F(TodayServiceCase, QueryAppointmentsWithForceErrorAsync)
 	}
 }
 
+TEST_F(TodayServiceCase, QueryAppointmentsWithForceErrorAsValue)
+{
+	auto query = R"({
+			appointments {
+				edges {
+					node {
+						appointmentId: id
+						forceError
+					}
+				}
+			}
+		})"_graphql;
+	response::Value variables(response::Type::Map);
+	auto state = std::make_shared<today::RequestState>(2);
+
+	state->forceErrorAsValue = true;
+
+	auto result =
+		_mockService->service->resolve({ query, {}, std::move(variables), {}, state }).get();
+
+	try
+	{
+		ASSERT_TRUE(result.type() == response::Type::Map);
+		auto errorsItr = result.find("errors");
+		if (errorsItr == result.get<response::MapType>().cend())
+		{
+			FAIL() << response::toJSON(response::Value(result)) << "no errors returned";
+		}
+
+		auto errorsString = response::toJSON(response::Value(errorsItr->second));
+		EXPECT_EQ(
+			R"js([{"message":"this error was forced","locations":[{"line":6,"column":7}],"path":["appointments","edges",0,"node","forceError"]}])js",
+			errorsString)
+			<< "error should match";
+
+		const auto data = service::ScalarArgument::require("data", result);
+
+		const auto appointments = service::ScalarArgument::require("appointments", data);
+		const auto appointmentEdges =
+			service::ScalarArgument::require<service::TypeModifier::List>("edges", appointments);
+		ASSERT_EQ(size_t { 1 }, appointmentEdges.size()) << "appointments should have 1 entry";
+		ASSERT_TRUE(appointmentEdges[0].type() == response::Type::Map)
+			<< "appointment should be an object";
+		const auto appointmentNode = service::ScalarArgument::require("node", appointmentEdges[0]);
+		EXPECT_EQ(today::getFakeAppointmentId(),
+			service::IdArgument::require("appointmentId", appointmentNode))
+			<< "id should match in base64 encoding";
+		const auto forceError = appointmentNode.find("forceError");
+		ASSERT_TRUE(forceError != appointmentNode.get<response::MapType>().cend())
+			<< "forceError should be present";
+		EXPECT_TRUE(forceError->second.type() == response::Type::Null)
+			<< "forceError should be null";
+	}
+	catch (service::schema_exception& ex)
+	{
+		FAIL() << response::toJSON(ex.getErrors());
+	}
+}
+
 TEST_F(TodayServiceCase, QueryTasks)
 {
 	auto query = R"gql({
@@ -1112,6 +1203,38 @@ TEST_F(TodayServiceCase, NestedFragmentDirectives)
 	}
 }
 
+TEST_F(TodayServiceCase, QueryAppointmentsByIdErrorPaths)
+{
+	auto query = R"(query ($appointmentId: ID!) {
+			appointmentsById(ids: [$appointmentId, $appointmentId]) {
+				appointmentId: id
+				failure: forceError
+			}
+		})"_graphql;
+	response::Value variables(response::Type::Map);
+	variables.emplace_back("appointmentId",
+		response::Value("ZmFrZUFwcG9pbnRtZW50SWQ="s).from_json());
+	auto state = std::make_shared<today::RequestState>(12);
+	auto result =
+		_mockService->service->resolve({ query, {}, std::move(variables), {}, state }).get();
+
+	try
+	{
+		ASSERT_TRUE(result.type() == response::Type::Map);
+		auto errorsItr = result.find("errors");
+		ASSERT_TRUE(errorsItr != result.get<response::MapType>().cend())
+			<< "should return an error for each entry";
+		EXPECT_EQ(
+			R"js([{"message":"Field error name: failure unknown error: this error was forced","locations":[{"line":4,"column":5}],"path":["appointmentsById",0,"failure"]},{"message":"Field error name: failure unknown error: this error was forced","locations":[{"line":4,"column":5}],"path":["appointmentsById",1,"failure"]}])js",
+			response::toJSON(response::Value(errorsItr->second)))
+			<< "each error should include the list index and the alias";
+	}
+	catch (service::schema_exception& ex)
+	{
+		FAIL() << response::toJSON(ex.getErrors());
+	}
+}
+
 TEST_F(TodayServiceCase, QueryAppointmentsById)
 {
 	auto query = R"(query SpecificAppointment($appointmentId: ID!) {
@@ -2084,3 +2207,226 @@ TEST_F(TodayServiceCase, MutateCoerceSetFloat)
 		FAIL() << response::toJSON(ex.getErrors());
 	}
 }
+
+TEST_F(TodayServiceCase, QueryCostEstimate)
+{
+	auto query = R"({
+			appointments(first: 10) {
+				edges {
+					node {
+						id
+						subject
+					}
+				}
+			}
+		})"_graphql;
+
+	service::RequestCostOptions options;
+
+	options.fieldWeights["Appointment.subject"] = 5;
+	_mockService->service->setCostOptions(std::move(options));
+
+	auto errors = _mockService->service->validate(query);
+
+	ASSERT_TRUE(errors.empty()) << "query should be valid";
+
+	const auto itrCost = query.operationCosts.find(""sv);
+
+	ASSERT_TRUE(itrCost != query.operationCosts.end()) << "should estimate the operation cost";
+	// node: 1 + (1 + 5) = 7, edges: 1 + 7 = 8, appointments: 1 + 10 * 8 = 81
+	EXPECT_EQ(size_t { 81 }, itrCost->second) << "should multiply by the first argument";
+}
+
+TEST_F(TodayServiceCase, QueryCostExceedsBudget)
+{
+	auto query = R"({
+			appointments(first: 10) {
+				edges {
+					node {
+						id
+						subject
+					}
+				}
+			}
+		})"_graphql;
+
+	service::RequestCostOptions options;
+
+	options.budget = 40;
+	_mockService->service->setCostOptions(std::move(options));
+
+	response::Value variables(response::Type::Map);
+	auto state = std::make_shared<today::RequestState>(23);
+	auto result =
+		_mockService->service->resolve({ query, {}, std::move(variables), {}, state }).get();
+	EXPECT_EQ(size_t { 0 }, _mockService->getAppointmentsCount)
+		<< "today service should not resolve the appointments";
+	EXPECT_EQ(size_t { 0 }, state->loadAppointmentsCount)
+		<< "today service should not call the loader";
+
+	try
+	{
+		ASSERT_TRUE(result.type() == response::Type::Map);
+		auto errorsItr = result.find("errors");
+		ASSERT_TRUE(errorsItr != result.get<response::MapType>().cend())
+			<< "should return an error";
+		EXPECT_EQ(
+			R"js([{"message":"Operation cost: 41 exceeds budget: 40","locations":[{"line":1,"column":1}]}])js",
+			response::toJSON(response::Value(errorsItr->second)))
+			<< "error should match";
+	}
+	catch (service::schema_exception& ex)
+	{
+		FAIL() << response::toJSON(ex.getErrors());
+	}
+}
+
+TEST_F(TodayServiceCase, QueryCostVariablePageSize)
+{
+	auto query = R"(query ($pageSize: Int) {
+			appointments(first: $pageSize) {
+				edges {
+					node {
+						id
+						subject
+					}
+				}
+			}
+		})"_graphql;
+
+	service::RequestCostOptions options;
+
+	options.maxPageSize = 100;
+	options.budget = 400;
+	_mockService->service->setCostOptions(std::move(options));
+
+	response::Value variables(response::Type::Map);
+	variables.emplace_back("pageSize", response::Value(1));
+	auto state = std::make_shared<today::RequestState>(24);
+	auto result =
+		_mockService->service->resolve({ query, {}, std::move(variables), {}, state }).get();
+	EXPECT_EQ(size_t { 0 }, _mockService->getAppointmentsCount)
+		<< "today service should not resolve the appointments";
+	EXPECT_EQ(size_t { 0 }, state->loadAppointmentsCount)
+		<< "today service should not call the loader";
+
+	try
+	{
+		ASSERT_TRUE(result.type() == response::Type::Map);
+		auto errorsItr = result.find("errors");
+		ASSERT_TRUE(errorsItr != result.get<response::MapType>().cend())
+			<< "should return an error";
+		// node: 1 + (1 + 1) = 3, edges: 1 + 3 = 4, appointments: 1 + 100 * 4 = 401
+		EXPECT_EQ(
+			R"js([{"message":"Operation cost: 401 exceeds budget: 400","locations":[{"line":1,"column":1}]}])js",
+			response::toJSON(response::Value(errorsItr->second)))
+			<< "error should match";
+	}
+	catch (service::schema_exception& ex)
+	{
+		FAIL() << response::toJSON(ex.getErrors());
+	}
+}
+
+TEST_F(TodayServiceCase, SharedIntrospectionWrappers)
+{
+	const auto schema = today::GetSchema();
+	const auto cache = schema->introspectionCache();
+	const auto& appointmentType = schema->LookupType("Appointment"sv);
+
+	ASSERT_TRUE(cache) << "schema should create the introspection cache";
+	EXPECT_EQ(cache, schema->introspectionCache()) << "schema should reuse the cache";
+	EXPECT_EQ(cache->get(appointmentType), cache->get(appointmentType))
+		<< "cache should reuse the wrapper object";
+}
+
+TEST_F(TodayServiceCase, CachedIntrospectionResponse)
+{
+	auto firstQuery = R"({
+			__typename
+			__schema {
+				queryType {
+					name
+				}
+			}
+		})"_graphql;
+	auto secondQuery = R"(
+		# Same document with different formatting.
+		{ __typename, __schema { queryType { name } } })"_graphql;
+	auto errorQuery = R"({
+			__type(name: "NonExistentType") {
+				description
+			}
+		})"_graphql;
+
+	_mockService->service->setIntrospectionCacheSize(2);
+
+	auto firstResult = _mockService->service->resolve({ firstQuery }).get();
+	auto secondResult = _mockService->service->resolve({ secondQuery }).get();
+	auto errorResult = _mockService->service->resolve({ errorQuery }).get();
+	auto repeatErrorResult = _mockService->service->resolve({ errorQuery }).get();
+	const auto stats = _mockService->service->getIntrospectionCacheStats();
+
+	EXPECT_EQ(size_t { 1 }, stats.hits) << "second query should reuse the first response";
+	EXPECT_EQ(size_t { 3 }, stats.misses) << "responses with errors should not be cached";
+	EXPECT_EQ(size_t { 1 }, stats.size) << "only the first response should be cached";
+	EXPECT_TRUE(firstQuery.normalized.empty()) << "resolve should not modify the shared ast";
+	ASSERT_TRUE(firstResult.type() == response::Type::Map);
+	ASSERT_TRUE(secondResult.type() == response::Type::Map);
+	EXPECT_EQ(&std::as_const(firstResult).get<response::MapType>(),
+		&std::as_const(secondResult).get<response::MapType>())
+		<< "cached response should share the same document";
+
+	try
+	{
+		const auto expected =
+			R"js({"data":{"__typename":"Query","__schema":{"queryType":{"name":"Query"}}}})js"s;
+
+		EXPECT_EQ(expected, response::toJSON(std::move(firstResult)))
+			<< "first response should match";
+		EXPECT_EQ(expected, response::toJSON(std::move(secondResult)))
+			<< "cached response should match";
+
+		ASSERT_TRUE(repeatErrorResult.type() == response::Type::Map);
+		EXPECT_EQ(response::toJSON(std::move(errorResult)),
+			response::toJSON(std::move(repeatErrorResult)))
+			<< "responses with errors should be resolved again";
+	}
+	catch (service::schema_exception& ex)
+	{
+		FAIL() << response::toJSON(ex.getErrors());
+	}
+}
+
+TEST_F(TodayServiceCase, CachedIntrospectionEviction)
+{
+	auto typenameQuery = R"({
+			__typename
+		})"_graphql;
+	auto schemaQuery = R"({
+			__schema {
+				queryType {
+					name
+				}
+			}
+		})"_graphql;
+
+	_mockService->service->setIntrospectionCacheSize(1);
+
+	auto firstTypename = _mockService->service->resolve({ typenameQuery }).get();
+	auto firstSchema = _mockService->service->resolve({ schemaQuery }).get();
+	auto secondSchema = _mockService->service->resolve({ schemaQuery }).get();
+	auto secondTypename = _mockService->service->resolve({ typenameQuery }).get();
+	const auto stats = _mockService->service->getIntrospectionCacheStats();
+
+	EXPECT_EQ(size_t { 1 }, stats.hits) << "repeated query should use the cache";
+	EXPECT_EQ(size_t { 3 }, stats.misses) << "evicted query should be resolved again";
+	EXPECT_EQ(size_t { 2 }, stats.evictions) << "least recently used response should be evicted";
+	EXPECT_EQ(size_t { 1 }, stats.size) << "cache should stay within the limit";
+	EXPECT_EQ(&std::as_const(firstSchema).get<response::MapType>(),
+		&std::as_const(secondSchema).get<response::MapType>())
+		<< "cached response should share the same document";
+	EXPECT_EQ(R"js({"data":{"__typename":"Query"}})js",
+		response::toJSON(std::move(secondTypename)))
+		<< "evicted response should match";
+}
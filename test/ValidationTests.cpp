@@ -1666,6 +1666,30 @@ TEST_F(ValidationExamplesCase, CounterExample169)
 		<< "error should match";
 }
 
+TEST_F(ValidationExamplesCase, UndefinedWrappedVariableType)
+{
+	// The wrappers for an undefined type are owned by the schema, so validating the same undefined
+	// variable type again reuses them.
+	for (size_t i = 0; i < 2; ++i)
+	{
+		auto query = R"(query ($v: [[Undefined]]!) {
+			dog {
+				name
+			}
+		})"_graphql;
+
+		auto errors =
+			service::buildErrorValues(_service->validate(query)).release<response::ListType>();
+
+		EXPECT_EQ(errors.size(), size_t { 1 }) << "1 invalid variable type";
+		ASSERT_GE(errors.size(), size_t { 1 });
+		EXPECT_EQ(
+			R"js({"message":"Invalid variable type name: v","locations":[{"line":1,"column":12}]})js",
+			response::toJSON(std::move(errors[0])))
+			<< "error should match";
+	}
+}
+
 TEST_F(ValidationExamplesCase, Example170)
 {
 	// https://spec.graphql.org/October2021/#example-38119
@@ -2037,3 +2061,167 @@ TEST_F(ValidationExamplesCase, Example187)
 
 	ASSERT_TRUE(errors.empty());
 }
+
+TEST_F(ValidationExamplesCase, ParallelValidationMatchesSerial)
+{
+	constexpr auto document = R"(query getDogName {
+			dog {
+				...nameFragment
+			}
+		}
+
+		query getOwnerName {
+			dog {
+				owner {
+					name
+					unknownField
+				}
+			}
+		}
+
+		fragment nameFragment on Dog {
+			name
+			...barkVolumeFragment
+		}
+
+		fragment barkVolumeFragment on Dog {
+			barkVolume
+			...nameFragment
+		}
+
+		query getDogName {
+			dog {
+				...barkVolumeFragment
+			}
+		}
+
+		fragment unusedFragment on Dog {
+			name
+		})"sv;
+	auto serialQuery = peg::parseString(document);
+	auto parallelQuery = peg::parseString(document);
+	auto parallelService = std::make_shared<validation::Operations>(
+		std::make_shared<validation::Query>(),
+		std::make_shared<validation::Mutation>());
+
+	parallelService->setValidationConcurrency(4);
+
+	auto serialErrors = service::buildErrorValues(_service->validate(serialQuery));
+	auto parallelErrors = service::buildErrorValues(parallelService->validate(parallelQuery));
+
+	EXPECT_EQ(serialErrors.size(), size_t { 5 })
+		<< "1 duplicate operation + 1 undefined field + 2 cyclic fragments + 1 unused fragment";
+
+	const auto serialJSON = response::toJSON(std::move(serialErrors));
+
+	EXPECT_EQ(serialJSON, response::toJSON(std::move(parallelErrors)))
+		<< "errors should match in the same order";
+
+	// The worker threads are reused for the next document.
+	auto repeatedQuery = peg::parseString(document);
+	auto repeatedErrors = service::buildErrorValues(parallelService->validate(repeatedQuery));
+
+	EXPECT_EQ(serialJSON, response::toJSON(std::move(repeatedErrors)))
+		<< "errors should match when the worker threads are reused";
+}
+
+TEST_F(ValidationExamplesCase, ValidationCacheHitsAndEvictions)
+{
+	auto cachedService = std::make_shared<validation::Operations>(
+		std::make_shared<validation::Query>(),
+		std::make_shared<validation::Mutation>());
+
+	cachedService->setValidationCacheSize(2);
+
+	auto query1 = peg::parseString(R"(query getDogName { dog { name } })"sv);
+	auto query2 = peg::parseString(R"(# same query, different formatting
+		query getDogName {
+			dog {
+				name,
+			}
+		})"sv);
+
+	EXPECT_TRUE(cachedService->validate(query1).empty());
+	EXPECT_TRUE(cachedService->validate(query2).empty());
+	EXPECT_EQ(query1.hash, query2.hash) << "formatting should not change the hash";
+	EXPECT_EQ(query1.normalized, query2.normalized) << "formatting should not change the tokens";
+
+	auto stats = cachedService->getValidationCacheStats();
+
+	EXPECT_EQ(stats.misses, size_t { 1 });
+	EXPECT_EQ(stats.hits, size_t { 1 });
+	EXPECT_EQ(stats.size, size_t { 1 });
+
+	auto invalid1 = peg::parseString(R"(query getDogName { dog { unknownField } })"sv);
+	auto invalid2 = peg::parseString(R"(query getDogName {
+			dog { unknownField }
+		})"sv);
+
+	auto errors1 = service::buildErrorValues(cachedService->validate(invalid1));
+	auto errors2 = service::buildErrorValues(cachedService->validate(invalid2));
+
+	EXPECT_EQ(
+		R"js([{"message":"Undefined field type: Dog name: unknownField","locations":[{"line":1,"column":26}]}])js",
+		response::toJSON(std::move(errors1)))
+		<< "error should match";
+	EXPECT_EQ(
+		R"js([{"message":"Undefined field type: Dog name: unknownField","locations":[{"line":2,"column":10}]}])js",
+		response::toJSON(std::move(errors2)))
+		<< "errors should not be reused for different source text";
+
+	auto query3 = peg::parseString(R"(query getOwnerName { dog { owner { name } } })"sv);
+
+	EXPECT_TRUE(cachedService->validate(query3).empty());
+
+	stats = cachedService->getValidationCacheStats();
+
+	EXPECT_EQ(stats.misses, size_t { 4 });
+	EXPECT_EQ(stats.hits, size_t { 1 });
+	EXPECT_EQ(stats.evictions, size_t { 1 });
+	EXPECT_EQ(stats.size, size_t { 2 });
+}
+
+TEST_F(ValidationExamplesCase, ValidationCacheHashCollision)
+{
+	auto cachedService = std::make_shared<validation::Operations>(
+		std::make_shared<validation::Query>(),
+		std::make_shared<validation::Mutation>());
+
+	cachedService->setValidationCacheSize(2);
+
+	auto valid = peg::parseString(R"(query getDogName { dog { name } })"sv);
+	auto invalid = peg::parseString(R"(query getDogName { dog { unknownField } })"sv);
+
+	EXPECT_TRUE(cachedService->validate(valid).empty());
+
+	// Simulate a hash collision with the cached document.
+	peg::normalizeDocument(invalid);
+	invalid.hash = valid.hash;
+
+	auto errors = service::buildErrorValues(cachedService->validate(invalid));
+
+	EXPECT_FALSE(invalid.validated) << "should not trust the cached result";
+	EXPECT_EQ(
+		R"js([{"message":"Undefined field type: Dog name: unknownField","locations":[{"line":1,"column":26}]}])js",
+		response::toJSON(std::move(errors)))
+		<< "error should match";
+
+	const auto stats = cachedService->getValidationCacheStats();
+
+	EXPECT_EQ(stats.misses, size_t { 2 });
+	EXPECT_EQ(stats.hits, size_t { 0 });
+}
+
+TEST_F(ValidationExamplesCase, SharedValidateSchema)
+{
+	const auto schema = validation::GetSchema();
+	const auto validateSchema = schema->validateSchema();
+	auto otherService = std::make_shared<validation::Operations>(
+		std::make_shared<validation::Query>(),
+		std::make_shared<validation::Mutation>());
+	auto query = peg::parseString(R"(query getDogName { dog { name } })"sv);
+
+	ASSERT_TRUE(validateSchema) << "schema should build the validation model";
+	EXPECT_EQ(validateSchema, schema->validateSchema()) << "schema should reuse the model";
+	EXPECT_TRUE(otherService->validate(query).empty()) << "model should be shared by services";
+}